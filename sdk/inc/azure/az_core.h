@@ -22,11 +22,16 @@
 #include <azure/core/az_http.h>
 #include <azure/core/az_http_transport.h>
 #include <azure/core/az_json.h>
+#include <azure/core/az_json_document.h>
+#include <azure/core/az_json_keyset.h>
+#include <azure/core/az_json_pointer.h>
 #include <azure/core/az_log.h>
 #include <azure/core/az_platform.h>
 #include <azure/core/az_precondition.h>
 #include <azure/core/az_result.h>
 #include <azure/core/az_span.h>
+#include <azure/core/az_span_arena.h>
+#include <azure/core/az_span_list.h>
 #include <azure/core/az_version.h>
 
 #endif //_az_CORE_H
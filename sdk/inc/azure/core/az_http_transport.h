@@ -17,6 +17,7 @@
 
 #include <azure/core/az_http.h>
 #include <azure/core/az_span.h>
+#include <azure/core/az_span_list.h>
 
 #include <azure/core/_az_cfg_prefix.h>
 
@@ -89,6 +90,7 @@ typedef struct
     int32_t max_headers;
     int32_t retry_headers_start_byte_offset;
     az_span body;
+    az_span_list body_segments; // Set by az_http_request_set_body_span_list(), empty otherwise.
   } _internal;
 } az_http_request;
 
@@ -181,10 +183,30 @@ AZ_NODISCARD az_result az_http_request_get_url(az_http_request const* request, a
  *
  * @return An #az_result value indicating the result of the operation.
  * @retval #AZ_OK Success.
+ * @retval #AZ_ERROR_NOT_SUPPORTED The body is an #az_span_list of more than one segment, which
+ * must be read with az_http_request_get_body_span_list() instead.
  * @retval other Failure.
  */
 AZ_NODISCARD az_result az_http_request_get_body(az_http_request const* request, az_span* out_body);
 
+/**
+ * @brief Get body from an HTTP request as a list of segments, so that it can be sent without
+ * gathering it into one contiguous buffer first.
+ *
+ * @remarks This function is expected to be used by transport layer only. If the body wasn't set
+ * as an #az_span_list, the list is empty, and the body must be read with az_http_request_get_body().
+ *
+ * @param[in] request The HTTP request from which to get the body.
+ * @param[out] out_body Pointer to write the HTTP request body to. Its segments must not be
+ * modified.
+ *
+ * @return An #az_result value indicating the result of the operation.
+ * @retval #AZ_OK Success.
+ * @retval other Failure.
+ */
+AZ_NODISCARD az_result
+az_http_request_get_body_span_list(az_http_request const* request, az_span_list* out_body);
+
 /**
  * @brief This function is expected to be used by transport adapters like curl. Use it to write
  * content from \p source to \p ref_response.
@@ -18,6 +18,7 @@
 
 #include <azure/core/az_result.h>
 #include <azure/core/az_span.h>
+#include <azure/core/az_span_list.h>
 
 #include <stdbool.h>
 #include <stdint.h>
@@ -100,6 +101,18 @@ typedef struct
     /// optimization to avoid redundant checks. It is meaningless for any other token kind.
     bool string_has_escaped_chars;
 
+    /// A flag to indicate whether the JSON number is an integer of at most 19 digits, without a
+    /// fraction or an exponent, whose absolute value was accumulated in number_magnitude while the
+    /// reader validated it, so that it doesn't need to be parsed again. It is meaningless for any
+    /// other token kind.
+    bool number_is_integer;
+
+    /// A flag to indicate whether such a JSON number starts with a '-'.
+    bool number_is_negative;
+
+    /// The absolute value of such a JSON number.
+    uint64_t number_magnitude;
+
     /// This is the first segment in the entire JSON payload, if it was non-contiguous. Otherwise,
     /// its set to #AZ_SPAN_EMPTY.
     az_span* pointer_to_first_buffer;
@@ -236,6 +249,10 @@ AZ_NODISCARD az_result az_json_token_get_double(az_json_token const* json_token,
  * @retval #AZ_OK The string is returned.
  * @retval #AZ_ERROR_JSON_INVALID_STATE The kind is not #AZ_JSON_TOKEN_STRING.
  * @retval #AZ_ERROR_NOT_ENOUGH_SPACE \p destination does not have enough size.
+ *
+ * @remarks `\uXXXX` escape sequences are written as UTF-8, and surrogate pairs are combined into a
+ * single character. A surrogate that isn't part of a pair is written as the replacement character,
+ * U+FFFD.
  */
 AZ_NODISCARD az_result az_json_token_get_string(
     az_json_token const* json_token,
@@ -294,6 +311,19 @@ AZ_NODISCARD AZ_INLINE az_json_writer_options az_json_writer_options_default()
   return options;
 }
 
+/**
+ * @brief Defines the signature of the callback function that a streaming #az_json_writer calls
+ * with each chunk of JSON text it has written, once its buffer is needed for the next chunk.
+ *
+ * @param[in] user_context The user context passed to az_json_writer_stream_init().
+ * @param[in] json_text The chunk of JSON text. Its bytes are overwritten once the callback returns,
+ * so they must be sent, or copied, before then.
+ *
+ * @return An #az_result value indicating the result of the operation. A failure makes the append
+ * that needed the space fail with the same #az_result.
+ */
+typedef az_result (*az_json_writer_flush_fn)(void* user_context, az_span json_text);
+
 /**
  * @brief Provides forward-only, non-cached writing of UTF-8 encoded JSON text into the provided
  * buffer.
@@ -323,6 +353,23 @@ typedef struct
     /// to the #az_span_allocator_fn.
     void* user_context;
 
+    /// The list of destination buffers provided to az_json_writer_span_list_init(), or `NULL`.
+    az_span_list* destination_list;
+
+    /// The destination buffer and the bytes written in it, after the last successful append to a
+    /// destination list, which the writer goes back to if an append runs out of buffers.
+    az_span committed_destination_buffer;
+    int32_t committed_bytes_written;
+
+    /// The number of segments of the destination list after the last successful append.
+    int32_t committed_segment_count;
+
+    /// The callback provided to az_json_writer_stream_init(), or `NULL`.
+    az_json_writer_flush_fn flush_callback;
+
+    /// The failure of the flush callback, which the append that needed the space returns.
+    az_result flush_result;
+
     /// A state to remember when to emit a comma between JSON array and object elements.
     bool need_comma;
 
@@ -385,6 +432,119 @@ AZ_NODISCARD az_result az_json_writer_chunked_init(
     void* user_context,
     az_json_writer_options const* options);
 
+/**
+ * @brief Initializes an #az_json_writer which writes JSON text into a list of destination buffers,
+ * leaving the list referring to exactly the JSON text written.
+ *
+ * @param[out] out_json_writer A pointer to an #az_json_writer the instance to initialize.
+ * @param[in,out] ref_destination_list A pointer to an #az_span_list whose segments are the
+ * destination buffers, in the order in which they are to be filled (e.g. created with
+ * az_span_list_create()). Strings and property names of more than 10 bytes, and JSON text, fill
+ * each buffer to the end, and continue in the next one. Other tokens are never split, so the writer
+ * moves on to the first of the remaining buffers that can contain the whole token, and a buffer
+ * that is too small for it is left for later on.
+ * @param[in] options __[nullable]__ A reference to an #az_json_writer_options
+ * structure which defines custom behavior of the #az_json_writer. If `NULL` is passed, the writer
+ * will use the default options (i.e. #az_json_writer_options_default()).
+ *
+ * @return An #az_result value indicating the result of the operation.
+ * @retval #AZ_OK The #az_json_writer is initialized successfully.
+ * @retval other Failure.
+ *
+ * @remarks After every successful append, \p ref_destination_list contains the buffers written so
+ * far, each trimmed to the bytes written into it, so it can be handed to a scatter-gather transport
+ * or to #az_json_reader_span_list_init() as is. None of them is empty, once anything is written.
+ * The unused buffers remain in the list's storage, past its segment count. Both the list and its
+ * storage must outlive the writer.
+ *
+ * @remarks An append that fails with #AZ_ERROR_NOT_ENOUGH_SPACE leaves \p ref_destination_list as it
+ * was after the last successful append.
+ */
+AZ_NODISCARD az_result az_json_writer_span_list_init(
+    az_json_writer* out_json_writer,
+    az_span_list* ref_destination_list,
+    az_json_writer_options const* options);
+
+/**
+ * @brief Initializes an #az_json_writer which writes the JSON text into a scratch buffer, over and
+ * over again, and discards it, to count the bytes of the JSON text that the same appends would
+ * write. Only its `total_bytes_written` is meaningful.
+ *
+ * @param[out] out_json_writer A pointer to an #az_json_writer the instance to initialize.
+ * @param[in] scratch_buffer An #az_span over a byte buffer that the writer writes into, over and
+ * over again, and whose contents are discarded. It must be at least 64 bytes long, and not be used
+ * by anything else, such as another measuring writer, while the writer is in use.
+ * @param[in] options __[nullable]__ A reference to an #az_json_writer_options
+ * structure which defines custom behavior of the #az_json_writer. If `NULL` is passed, the writer
+ * will use the default options (i.e. #az_json_writer_options_default()).
+ *
+ * @return An #az_result value indicating the result of the operation.
+ * @retval #AZ_OK The #az_json_writer is initialized successfully.
+ * @retval other Failure.
+ *
+ * @remarks After the appends, the writer's `total_bytes_written` is the exact size of the JSON
+ * text. The appends validate their arguments and the writer's state as usual, but never fail with
+ * #AZ_ERROR_NOT_ENOUGH_SPACE. The output in \p scratch_buffer is discarded, so
+ * az_json_writer_get_bytes_used_in_destination() returns nothing meaningful.
+ *
+ * @remarks Writers require up to 64 bytes of slack past the end of the JSON text, as explained in
+ * the notes of the appends that write dynamically sized text, so a buffer of `total_bytes_written`
+ * plus 64 bytes is always large enough for the same appends to succeed.
+ */
+AZ_NODISCARD az_result az_json_writer_measure_init(
+    az_json_writer* out_json_writer,
+    az_span scratch_buffer,
+    az_json_writer_options const* options);
+
+/**
+ * @brief Initializes an #az_json_writer which writes JSON text into a single buffer, over and over
+ * again, handing each chunk of JSON text to a callback before reusing the buffer.
+ *
+ * @param[out] out_json_writer A pointer to an #az_json_writer the instance to initialize.
+ * @param[in] chunk_buffer An #az_span over the byte buffer where each chunk of the JSON text is
+ * written, such as the send buffer of a transport. It must be at least 64 bytes long.
+ * @param[in] flush_callback An #az_json_writer_flush_fn callback function that receives each chunk
+ * of JSON text once the buffer is too small to contain the next token.
+ * @param user_context A context specific user-defined struct or set of fields that is passed
+ * through to calls to the #az_json_writer_flush_fn.
+ * @param[in] options __[nullable]__ A reference to an #az_json_writer_options
+ * structure which defines custom behavior of the #az_json_writer. If `NULL` is passed, the writer
+ * will use the default options (i.e. #az_json_writer_options_default()).
+ *
+ * @return An #az_result value indicating the result of the operation.
+ * @retval #AZ_OK The #az_json_writer is initialized successfully.
+ * @retval other Failure.
+ *
+ * @remarks Call az_json_writer_flush() once done appending, to hand the last chunk to the callback.
+ * The JSON text can then be as large as needed, while only \p chunk_buffer is needed to hold it.
+ * Chunks end where the next token, or the next part of a long string, didn't fit, so they may fall
+ * short of the size of the buffer by up to 64 bytes.
+ *
+ * @remarks If \p flush_callback fails, the append that needed the space fails with the
+ * #az_result that it returned, and the chunk stays in the buffer. \p flush_callback is never
+ * called with an empty chunk, except by az_json_writer_flush().
+ */
+AZ_NODISCARD az_result az_json_writer_stream_init(
+    az_json_writer* out_json_writer,
+    az_span chunk_buffer,
+    az_json_writer_flush_fn flush_callback,
+    void* user_context,
+    az_json_writer_options const* options);
+
+/**
+ * @brief Hands the JSON text written since the last chunk to the callback of a streaming
+ * #az_json_writer.
+ *
+ * @param[in,out] ref_json_writer A pointer to an #az_json_writer instance initialized with
+ * az_json_writer_stream_init().
+ *
+ * @return The #az_result value returned by the #az_json_writer_flush_fn.
+ *
+ * @remarks The callback is called even when no JSON text was written since the last chunk, so that
+ * it always learns where the JSON text ends. More JSON text can still be appended afterwards.
+ */
+AZ_NODISCARD az_result az_json_writer_flush(az_json_writer* ref_json_writer);
+
 /**
  * @brief Returns the #az_span containing the JSON text written to the underlying buffer so far, in
  * the last provided destination buffer.
@@ -467,6 +627,37 @@ AZ_NODISCARD az_result az_json_writer_append_string(az_json_writer* ref_json_wri
 AZ_NODISCARD az_result
 az_json_writer_append_json_text(az_json_writer* ref_json_writer, az_span json_text);
 
+/**
+ * @brief Appends an existing UTF-8 encoded JSON text that is known to be valid, such as a fragment
+ * that was built by an #az_json_writer earlier, without validating it again.
+ *
+ * @param[in,out] ref_json_writer A pointer to an #az_json_writer instance containing the buffer to
+ * append the JSON text to.
+ * @param[in] json_text A single, possibly nested, valid, UTF-8 encoded, JSON value to be written as
+ * is, without leading or trailing whitespace. No modifications are made to this text, including
+ * escaping.
+ *
+ * @note When the #az_json_writer writes into a single buffer, only the space \p json_text takes,
+ * plus the comma, is required within it. Otherwise, the same 64 bytes of slack as for
+ * az_json_writer_append_json_text() are required.
+ *
+ * @remarks Unlike az_json_writer_append_json_text(), which reads every token of \p json_text, only
+ * its first and last bytes are checked, to match each other (`{` and `}`, `[` and `]`, quotes,
+ * literals and numbers) and to keep track of the writer's state. The rest of it is copied as is.
+ * Appending text that isn't valid JSON results in invalid JSON, so \p json_text MUST NOT come from
+ * an untrusted source.
+ *
+ * @return An #az_result value indicating the result of the operation.
+ * @retval #AZ_OK The provided \p json_text was appended successfully.
+ * @retval #AZ_ERROR_NOT_ENOUGH_SPACE The destination is too small for the provided \p json_text.
+ * @retval #AZ_ERROR_JSON_INVALID_STATE The \p ref_json_writer is in a state where the \p json_text
+ * cannot be appended because it would result in invalid JSON.
+ * @retval #AZ_ERROR_UNEXPECTED_CHAR The first and last bytes of \p json_text can't be those of a
+ * single JSON value.
+ */
+AZ_NODISCARD az_result
+az_json_writer_append_json_text_trusted(az_json_writer* ref_json_writer, az_span json_text);
+
 /**
  * @brief Appends the UTF-8 property name (as a JSON string) which is the first part of a name/value
  * pair of a JSON object.
@@ -489,6 +680,85 @@ az_json_writer_append_json_text(az_json_writer* ref_json_writer, az_span json_te
 AZ_NODISCARD az_result
 az_json_writer_append_property_name(az_json_writer* ref_json_writer, az_span name);
 
+/**
+ * @brief A property name whose JSON text, quoted and followed by the ':' separator, is built at
+ * compile time, so that appending it doesn't need to look for characters to escape.
+ *
+ * @details Use #AZ_JSON_NAME_LITERAL or #AZ_JSON_NAME_FROM_STR to create one.
+ */
+typedef struct
+{
+  struct
+  {
+    /// The name, as `"name":`.
+    az_span json_text;
+  } _internal;
+} az_json_name;
+
+/**
+ * @brief Returns a literal #az_json_name over a literal string.
+ *
+ * For example:
+ *
+ * `static az_json_name const max_temp = AZ_JSON_NAME_LITERAL("maxTempSinceLastReboot");`
+ *
+ * @remarks The string is written as is, so it must be valid within a JSON string: any '"', '\' or
+ * control character must already be escaped, as in `AZ_JSON_NAME_LITERAL("a\\\"b")` for the name
+ * `a"b`. Property names that are identifiers, as is usual, are written as is.
+ */
+#define AZ_JSON_NAME_LITERAL(STRING_LITERAL)                            \
+  {                                                                     \
+    ._internal = {                                                      \
+      .json_text = AZ_SPAN_LITERAL_FROM_STR("\"" STRING_LITERAL "\":"), \
+    },                                                                  \
+  }
+
+/**
+ * @brief Returns an #az_json_name expression over a literal string.
+ *
+ * For example:
+ *
+ * `az_json_writer_append_name(&writer, AZ_JSON_NAME_FROM_STR("temperature"));`
+ *
+ * @remarks The same rules as for #AZ_JSON_NAME_LITERAL apply to the string.
+ */
+#define AZ_JSON_NAME_FROM_STR(STRING_LITERAL) (az_json_name) AZ_JSON_NAME_LITERAL(STRING_LITERAL)
+
+/**
+ * @brief Returns the text of the name of \p name, without its quotes and separator, as it is
+ * written in the JSON payload.
+ *
+ * @details It can be compared with the property names read by an #az_json_reader using
+ * az_json_token_is_text_equal(), as long as it has no escaped characters.
+ *
+ * @param[in] name An #az_json_name created with #AZ_JSON_NAME_LITERAL or #AZ_JSON_NAME_FROM_STR.
+ *
+ * @return The text of the name.
+ */
+AZ_NODISCARD AZ_INLINE az_span az_json_name_get_text(az_json_name name)
+{
+  return az_span_slice(name._internal.json_text, 1, az_span_size(name._internal.json_text) - 2);
+}
+
+/**
+ * @brief Appends a property name built at compile time, which is the first part of a name/value
+ * pair of a JSON object.
+ *
+ * @param[in,out] ref_json_writer A pointer to an #az_json_writer instance containing the buffer to
+ * append the property name to.
+ * @param[in] name The property name, created with #AZ_JSON_NAME_LITERAL or #AZ_JSON_NAME_FROM_STR.
+ *
+ * @return An #az_result value indicating the result of the operation.
+ * @retval #AZ_OK The property name was appended successfully.
+ * @retval #AZ_ERROR_NOT_ENOUGH_SPACE The buffer is too small.
+ *
+ * @remarks Unlike az_json_writer_append_property_name(), the name isn't looked at: it is copied as
+ * is, with the preceding ',' if needed. Only the space it takes is required within the output
+ * buffer.
+ */
+AZ_NODISCARD az_result
+az_json_writer_append_name(az_json_writer* ref_json_writer, az_json_name name);
+
 /**
  * @brief Appends a boolean value (as a JSON literal `true` or `false`).
  *
@@ -521,6 +791,41 @@ AZ_NODISCARD az_result az_json_writer_append_bool(az_json_writer* ref_json_write
  */
 AZ_NODISCARD az_result az_json_writer_append_int32(az_json_writer* ref_json_writer, int32_t value);
 
+/**
+ * @brief Appends an `int64_t` number value.
+ *
+ * @param[in,out] ref_json_writer A pointer to an #az_json_writer instance containing the buffer to
+ * append the number to.
+ * @param[in] value The value to be written as a JSON number.
+ *
+ * @return An #az_result value indicating the result of the operation.
+ * @retval #AZ_OK The number was appended successfully.
+ * @retval #AZ_ERROR_NOT_ENOUGH_SPACE The buffer is too small.
+ *
+ * @remarks Every digit is written, so values beyond 2^53, such as epoch times in nanoseconds or
+ * large byte counts, keep their exact value, unlike with az_json_writer_append_double(). Only the
+ * space the number takes is required within the output buffer.
+ */
+AZ_NODISCARD az_result az_json_writer_append_int64(az_json_writer* ref_json_writer, int64_t value);
+
+/**
+ * @brief Appends a `uint64_t` number value.
+ *
+ * @param[in,out] ref_json_writer A pointer to an #az_json_writer instance containing the buffer to
+ * append the number to.
+ * @param[in] value The value to be written as a JSON number.
+ *
+ * @return An #az_result value indicating the result of the operation.
+ * @retval #AZ_OK The number was appended successfully.
+ * @retval #AZ_ERROR_NOT_ENOUGH_SPACE The buffer is too small.
+ *
+ * @remarks Every digit is written, so values beyond 2^53 keep their exact value, unlike with
+ * az_json_writer_append_double(). Only the space the number takes is required within the output
+ * buffer.
+ */
+AZ_NODISCARD az_result
+az_json_writer_append_uint64(az_json_writer* ref_json_writer, uint64_t value);
+
 /**
  * @brief Appends a `double` number value.
  *
@@ -556,6 +861,34 @@ AZ_NODISCARD az_result az_json_writer_append_double(
     double value,
     int32_t fractional_digits);
 
+/**
+ * @brief Appends a `double` number value, using the fewest digits that parse back to the same
+ * value.
+ *
+ * @param[in,out] ref_json_writer A pointer to an #az_json_writer instance containing the buffer to
+ * append the number to.
+ * @param[in] value The value to be written as a JSON number.
+ *
+ * @note If you receive an #AZ_ERROR_NOT_ENOUGH_SPACE result while appending data for which there is
+ * sufficient space, note that the JSON writer requires at least 64 bytes of slack within the
+ * output buffer, above the theoretical minimal space needed. The JSON writer pessimistically
+ * requires this extra space because it tries to write formatted text in chunks rather than one
+ * character at a time, whenever the input data is dynamic in size.
+ *
+ * @return An #az_result value indicating the result of the operation.
+ * @retval #AZ_OK The number was appended successfully.
+ * @retval #AZ_ERROR_NOT_ENOUGH_SPACE The buffer is too small.
+ *
+ * @remark Only finite double values are supported. Values such as `NAN` and `INFINITY` are not
+ * allowed and would lead to invalid JSON being written.
+ *
+ * @remark The number is formatted by az_span_dtoa_shortest(). Unlike
+ * az_json_writer_append_double(), it is never truncated, and there is no limit on the magnitude of
+ * its integer component.
+ */
+AZ_NODISCARD az_result
+az_json_writer_append_double_shortest(az_json_writer* ref_json_writer, double value);
+
 /**
  * @brief Appends the JSON literal `null`.
  *
@@ -704,6 +1037,20 @@ typedef struct
 
     /// A copy of the options provided by the user.
     az_json_reader_options options;
+
+    /// For a reader initialized with az_json_reader_push_init(), the buffer that holds the bytes
+    /// of a token carried over from one chunk to the next. It is empty for other readers.
+    az_span carry_buffer;
+
+    /// The part of the last chunk pushed that hasn't been copied into the carry buffer yet.
+    az_span pending_chunk;
+
+    /// The number of bytes at the start of json_buffer that were carried over from previous
+    /// chunks, when json_buffer is within the carry buffer rather than the last chunk pushed.
+    int32_t carried_size;
+
+    /// Whether the last chunk pushed is the end of the JSON payload.
+    bool is_final_chunk;
   } _internal;
 } az_json_reader;
 
@@ -761,6 +1108,77 @@ AZ_NODISCARD az_result az_json_reader_chunked_init(
     int32_t number_of_buffers,
     az_json_reader_options const* options);
 
+/**
+ * @brief Initializes an #az_json_reader to read the JSON payload contained within the segments of
+ * an #az_span_list.
+ *
+ * @param[out] out_json_reader A pointer to an #az_json_reader instance to initialize.
+ * @param[in] json_segments The #az_span_list containing the JSON text to read.
+ * @param[in] options __[nullable]__ A reference to an #az_json_reader_options
+ * structure which defines custom behavior of the #az_json_reader. If `NULL` is passed, the reader
+ * will use the default options (i.e. #az_json_reader_options_default()).
+ *
+ * @return An #az_result value indicating the result of the operation.
+ * @retval #AZ_OK The #az_json_reader is initialized successfully.
+ * @retval other Initialization failed.
+ *
+ * @remarks The segments are read in place, with the same requirements as
+ * #az_json_reader_chunked_init(): there must be at least one, and none of them can be empty.
+ */
+AZ_NODISCARD az_result az_json_reader_span_list_init(
+    az_json_reader* out_json_reader,
+    az_span_list json_segments,
+    az_json_reader_options const* options);
+
+/**
+ * @brief Initializes an #az_json_reader to read a JSON payload that is pushed to it in chunks, as
+ * they are received, with az_json_reader_push().
+ *
+ * @param[out] out_json_reader A pointer to an #az_json_reader instance to initialize.
+ * @param[in] carry_buffer The buffer that holds the start of a token that straddles the end of a
+ * chunk, until the next chunk is pushed. It must be larger than any token of the payload, together
+ * with the whitespace and the ',' or ':' that come right before it, and remain valid for as long as
+ * the reader is used.
+ * @param[in] options __[nullable]__ A reference to an #az_json_reader_options
+ * structure which defines custom behavior of the #az_json_reader. If `NULL` is passed, the reader
+ * will use the default options (i.e. #az_json_reader_options_default()).
+ *
+ * @return An #az_result value indicating the result of the operation.
+ * @retval #AZ_OK The #az_json_reader is initialized successfully.
+ *
+ * @remarks az_json_reader_next_token() reads the tokens of the chunks pushed so far, in place, and
+ * returns #AZ_ERROR_JSON_READER_NEED_MORE_INPUT when the next token continues past the end of the
+ * last chunk. Push the next chunk and call it again: it carries on from where it left off, without
+ * reading the previous chunks again.
+ *
+ * @remarks Tokens refer to the chunk they were read from, or to \p carry_buffer, so they can only
+ * be used until the next chunk is pushed. Other functions that read more than one token, such as
+ * az_json_reader_skip_children(), can't be carried on from where they left off, so the whole of
+ * what they read must have been pushed first.
+ */
+AZ_NODISCARD az_result az_json_reader_push_init(
+    az_json_reader* out_json_reader,
+    az_span carry_buffer,
+    az_json_reader_options const* options);
+
+/**
+ * @brief Pushes the next chunk of the JSON payload to an #az_json_reader initialized with
+ * az_json_reader_push_init().
+ *
+ * @param[in,out] ref_json_reader A pointer to an #az_json_reader instance, which hasn't been pushed
+ * any chunk yet, or whose last call to az_json_reader_next_token() returned
+ * #AZ_ERROR_JSON_READER_NEED_MORE_INPUT.
+ * @param[in] json_chunk The next chunk of the JSON payload, which can be empty. It must remain
+ * valid, and unchanged, until the next chunk is pushed.
+ * @param[in] is_final_chunk `true` if \p json_chunk is the end of the JSON payload, after which
+ * az_json_reader_next_token() reports the end of the payload as any other reader does.
+ *
+ * @return An #az_result value indicating the result of the operation.
+ * @retval #AZ_OK Success.
+ */
+AZ_NODISCARD az_result
+az_json_reader_push(az_json_reader* ref_json_reader, az_span json_chunk, bool is_final_chunk);
+
 /**
  * @brief Reads the next token in the JSON text and updates the reader state.
  *
@@ -772,6 +1190,11 @@ AZ_NODISCARD az_result az_json_reader_chunked_init(
  * @retval #AZ_ERROR_UNEXPECTED_END The end of the JSON document is reached.
  * @retval #AZ_ERROR_UNEXPECTED_CHAR An invalid character is detected.
  * @retval #AZ_ERROR_JSON_READER_DONE No more JSON text left to process.
+ * @retval #AZ_ERROR_JSON_READER_NEED_MORE_INPUT For a reader initialized with
+ * az_json_reader_push_init(), the next token continues past the end of the last chunk pushed. The
+ * reader is left unchanged, so that it carries on once the next chunk is pushed.
+ * @retval #AZ_ERROR_NOT_ENOUGH_SPACE For a reader initialized with az_json_reader_push_init(), the
+ * next token doesn't fit in its carry buffer.
  */
 AZ_NODISCARD az_result az_json_reader_next_token(az_json_reader* ref_json_reader);
 
@@ -792,6 +1215,32 @@ AZ_NODISCARD az_result az_json_reader_next_token(az_json_reader* ref_json_reader
  */
 AZ_NODISCARD az_result az_json_reader_skip_children(az_json_reader* ref_json_reader);
 
+/**
+ * @brief Skips over any nested JSON elements, like az_json_reader_skip_children(), by matching
+ * brackets rather than reading every token in between.
+ *
+ * @param[in,out] ref_json_reader A pointer to an #az_json_reader instance containing the JSON to
+ * read.
+ *
+ * @return An #az_result value indicating the result of the operation.
+ * @retval #AZ_OK The children of the current JSON token are skipped successfully.
+ * @retval #AZ_ERROR_UNEXPECTED_END The end of the JSON document is reached before the matching end
+ * object or array.
+ * @retval #AZ_ERROR_UNEXPECTED_CHAR A bracket doesn't match the one it closes, or a string has an
+ * unescaped control character.
+ * @retval #AZ_ERROR_JSON_NESTING_OVERFLOW The children are nested too deep.
+ *
+ * @remarks The children are scanned, a vector at a time where available, for quotes and brackets
+ * only. Strings are jumped over, and numbers, literals and separators aren't validated, so use this
+ * for subtrees that are never looked at, such as metadata. Malformed JSON that still has balanced
+ * brackets is only reported when it is outside of the skipped children. If the children are
+ * malformed, the reader is left on the start of the object or array.
+ *
+ * @remarks For a reader initialized with az_json_reader_push_init(), this reads every token, like
+ * az_json_reader_skip_children().
+ */
+AZ_NODISCARD az_result az_json_reader_skip_children_fast(az_json_reader* ref_json_reader);
+
 /**
  * @brief Unescapes the JSON string within the provided #az_span.
  *
@@ -810,8 +1259,12 @@ AZ_NODISCARD az_result az_json_reader_skip_children(az_json_reader* ref_json_rea
  * @remarks This function assumes that the \p destination has a large enough size to hold the
  * unescaped \p json_string.
  *
- * @remarks This API can also be used to perform in place unescaping. However, doing so, is
- * destructive and the input JSON may no longer be valid or parsable.
+ * @remarks This API can also be used to perform in place unescaping, with \p destination starting
+ * at the same address as \p json_string, or before it. However, doing so, is destructive and the
+ * input JSON may no longer be valid or parsable.
+ *
+ * @remarks `\uXXXX` escape sequences are written as UTF-8, like az_json_token_get_string() does.
+ * Unescaping stops at the first malformed escape sequence.
  */
 AZ_NODISCARD az_span az_json_string_unescape(az_span json_string, az_span destination);
 
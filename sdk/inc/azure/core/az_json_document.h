@@ -0,0 +1,250 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ *
+ * @brief Random access to a JSON payload that has been tokenized once into a caller-provided tape.
+ *
+ * @details The #az_json_reader is forward-only, so reading a value that comes before another one,
+ * or reading the same value twice, means reading the payload again. An #az_json_document instead
+ * reads the payload once, validating it, and records every token in a tape (an array of
+ * #az_json_tape_entry owned by the caller). Each entry of the tape knows where its token is in the
+ * payload and where the next sibling starts, so the document can then:
+ *  - skip any object or array in constant time (see az_json_document_get_next_sibling()),
+ *  - look up properties in any order (see az_json_document_find_property()),
+ *  - read any value again with a regular #az_json_reader (see az_json_document_reader_init()),
+ *    for example to pass a sub-object to an API that takes an #az_json_reader.
+ *
+ * Tokens are identified by their index in the tape. The root value is at index 0. Objects and
+ * arrays take one entry for their start and one for their end, and every other token (including
+ * property names) takes one entry.
+ *
+ * The document does not allocate or copy any of the payload, which must remain valid, and
+ * unchanged, for as long as the document is used.
+ *
+ * @note You MUST NOT use any symbols (macros, functions, structures, enums, etc.)
+ * prefixed with an underscore ('_') directly in your application code. These symbols
+ * are part of Azure SDK's internal implementation; we do not document these symbols
+ * and they are subject to change in future versions of the SDK which would break your code.
+ */
+
+#ifndef _az_JSON_DOCUMENT_H
+#define _az_JSON_DOCUMENT_H
+
+#include <azure/core/az_json.h>
+#include <azure/core/az_result.h>
+#include <azure/core/az_span.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <azure/core/_az_cfg_prefix.h>
+
+/**
+ * @brief One token of a JSON payload, as recorded in the tape of an #az_json_document.
+ *
+ * @details Declare an array of these for az_json_document_parse() to fill. There is one entry per
+ * token, plus one for the end of each object or array.
+ */
+typedef struct
+{
+  struct
+  {
+    /// The offset of the token in the JSON payload. For strings and property names, this is the
+    /// offset of the first byte after the opening quote, matching #az_json_token.slice.
+    int32_t offset;
+
+    /// The size of the token, matching #az_json_token.size.
+    int32_t size;
+
+    /// The index of the entry right after this token and, for an object or an array, all of its
+    /// children, including its end. For a property name, this also skips over its value.
+    int32_t next_sibling;
+
+    /// The #az_json_token_kind of the token.
+    uint8_t kind;
+
+    /// Whether the string or property name had escaped characters, matching
+    /// #az_json_token._internal.string_has_escaped_chars.
+    bool string_has_escaped_chars;
+  } _internal;
+} az_json_tape_entry;
+
+/**
+ * @brief A JSON payload that has been tokenized into a tape, for random access.
+ */
+typedef struct
+{
+  struct
+  {
+    az_span json;
+    az_json_tape_entry* tape;
+    int32_t entry_count;
+  } _internal;
+} az_json_document;
+
+/**
+ * @brief Reads all of \p json, validating it, and records its tokens into \p tape.
+ *
+ * @param[out] out_document A pointer to an #az_json_document instance to initialize.
+ * @param[in] json The UTF-8 encoded JSON text to read. It must remain valid, and unchanged, for as
+ * long as the document is used.
+ * @param[out] tape The array of entries that receives the tokens. It must remain valid for as long
+ * as the document is used.
+ * @param[in] tape_capacity The number of entries in \p tape.
+ * @param[in] options __[nullable]__ A reference to an #az_json_reader_options structure which
+ * defines custom behavior of the #az_json_reader used to read \p json. If `NULL` is passed, the
+ * reader will use the default options (i.e. #az_json_reader_options_default()).
+ *
+ * @return An #az_result value indicating the result of the operation.
+ * @retval #AZ_OK The whole of \p json was read.
+ * @retval #AZ_ERROR_NOT_ENOUGH_SPACE \p tape has fewer entries than \p json has tokens.
+ * @retval #AZ_ERROR_UNEXPECTED_CHAR An invalid character was detected.
+ * @retval #AZ_ERROR_UNEXPECTED_END The end of \p json was reached before a complete JSON value.
+ * @retval #AZ_ERROR_JSON_NESTING_OVERFLOW \p json is nested more than 64 levels deep.
+ *
+ * @remarks The document can't be used if this function fails.
+ */
+AZ_NODISCARD az_result az_json_document_parse(
+    az_json_document* out_document,
+    az_span json,
+    az_json_tape_entry tape[],
+    int32_t tape_capacity,
+    az_json_reader_options const* options);
+
+/**
+ * @brief Returns the number of entries of the tape used by \p document.
+ *
+ * @param[in] document A pointer to a parsed #az_json_document.
+ *
+ * @return The number of entries, which can be used to size the tape for similar payloads.
+ */
+AZ_NODISCARD AZ_INLINE int32_t az_json_document_get_entry_count(az_json_document const* document)
+{
+  return document->_internal.entry_count;
+}
+
+/**
+ * @brief Returns the kind of the token at \p index.
+ *
+ * @param[in] document A pointer to a parsed #az_json_document.
+ * @param[in] index The index of the token, between 0 and the entry count - 1.
+ *
+ * @return The #az_json_token_kind of the token.
+ */
+AZ_NODISCARD AZ_INLINE az_json_token_kind
+az_json_document_get_kind(az_json_document const* document, int32_t index)
+{
+  return (az_json_token_kind)document->_internal.tape[index]._internal.kind;
+}
+
+/**
+ * @brief Returns the token at \p index, as an #az_json_reader would have returned it.
+ *
+ * @param[in] document A pointer to a parsed #az_json_document.
+ * @param[in] index The index of the token, between 0 and the entry count - 1.
+ *
+ * @return An #az_json_token, which can be used with any of the az_json_token_* functions (such as
+ * az_json_token_get_int32() or az_json_token_is_text_equal()) for as long as the document is used.
+ */
+AZ_NODISCARD az_json_token
+az_json_document_get_token(az_json_document const* document, int32_t index);
+
+/**
+ * @brief Gets the index of the first child of the object or array at \p index.
+ *
+ * @param[in] document A pointer to a parsed #az_json_document.
+ * @param[in] index The index of an #AZ_JSON_TOKEN_BEGIN_OBJECT or #AZ_JSON_TOKEN_BEGIN_ARRAY token.
+ * @param[out] out_index A pointer to the index that receives the first property name of the
+ * object, or the first value of the array.
+ *
+ * @return An #az_result value indicating the result of the operation.
+ * @retval #AZ_OK Success.
+ * @retval #AZ_ERROR_ITEM_NOT_FOUND The object or array is empty.
+ */
+AZ_NODISCARD az_result az_json_document_get_first_child(
+    az_json_document const* document,
+    int32_t index,
+    int32_t* out_index);
+
+/**
+ * @brief Gets the index of the token that follows the token at \p index, and all of its children,
+ * within the same object or array. This takes constant time.
+ *
+ * @param[in] document A pointer to a parsed #az_json_document.
+ * @param[in] index The index of a property name, or of a value within an array.
+ * @param[out] out_index A pointer to the index that receives the next property name of the object,
+ * or the next value of the array.
+ *
+ * @return An #az_result value indicating the result of the operation.
+ * @retval #AZ_OK Success.
+ * @retval #AZ_ERROR_ITEM_NOT_FOUND The token at \p index is the last one of its object or array, or
+ * it is the root value.
+ */
+AZ_NODISCARD az_result az_json_document_get_next_sibling(
+    az_json_document const* document,
+    int32_t index,
+    int32_t* out_index);
+
+/**
+ * @brief Gets the index of the value of the property called \p name in the object at \p index.
+ *
+ * @param[in] document A pointer to a parsed #az_json_document.
+ * @param[in] index The index of an #AZ_JSON_TOKEN_BEGIN_OBJECT token.
+ * @param[in] name The unescaped name of the property to find.
+ * @param[out] out_index A pointer to the index that receives the value of the first property of the
+ * object called \p name.
+ *
+ * @return An #az_result value indicating the result of the operation.
+ * @retval #AZ_OK Success.
+ * @retval #AZ_ERROR_ITEM_NOT_FOUND The object has no property called \p name.
+ *
+ * @remarks Only the property names of the object itself are compared; the values, including nested
+ * objects, are skipped in constant time.
+ */
+AZ_NODISCARD az_result az_json_document_find_property(
+    az_json_document const* document,
+    int32_t index,
+    az_span name,
+    int32_t* out_index);
+
+/**
+ * @brief Returns the JSON text of the value at \p index, including all of its children.
+ *
+ * @param[in] document A pointer to a parsed #az_json_document.
+ * @param[in] index The index of a value (i.e. neither a property name nor the end of an object or
+ * an array).
+ *
+ * @return A slice of the JSON payload of the document. For a string, it includes the quotes.
+ */
+AZ_NODISCARD az_span
+az_json_document_get_json_text(az_json_document const* document, int32_t index);
+
+/**
+ * @brief Initializes an #az_json_reader to read the value at \p index again, including all of its
+ * children.
+ *
+ * @param[in] document A pointer to a parsed #az_json_document.
+ * @param[in] index The index of a value (i.e. neither a property name nor the end of an object or
+ * an array).
+ * @param[out] out_json_reader A pointer to an #az_json_reader instance to initialize.
+ * @param[in] options __[nullable]__ A reference to an #az_json_reader_options structure which
+ * defines custom behavior of the #az_json_reader. If `NULL` is passed, the reader will use the
+ * default options (i.e. #az_json_reader_options_default()).
+ *
+ * @return An #az_result value indicating the result of the operation.
+ * @retval #AZ_OK Success.
+ *
+ * @remarks The reader starts before the value, as if the value was the whole JSON payload, so
+ * az_json_reader_next_token() must be called first to read it.
+ */
+AZ_NODISCARD az_result az_json_document_reader_init(
+    az_json_document const* document,
+    int32_t index,
+    az_json_reader* out_json_reader,
+    az_json_reader_options const* options);
+
+#include <azure/core/_az_cfg_suffix.h>
+
+#endif // _az_JSON_DOCUMENT_H
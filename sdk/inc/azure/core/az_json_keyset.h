@@ -0,0 +1,142 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ *
+ * @brief A set of property names, indexed once, to find which of them a JSON property name is
+ * without comparing it to each of them in turn.
+ *
+ * @details Code that handles JSON objects with many known properties typically compares each
+ * property name with a chain of az_json_token_is_text_equal() calls, so the cost of reading an
+ * object grows with the number of properties it knows about. An #az_json_keyset instead indexes the
+ * names in a small hash table, keyed on their length and first and last bytes, so that finding a
+ * property name among them usually takes a single comparison.
+ *
+ * A keyset can be used to find one property name (see az_json_keyset_find()), for example to
+ * `switch` on its index, or to read an object once and collect the values of all of its known
+ * properties (see az_json_keyset_extract() and az_json_keyset_extract_from_document()).
+ *
+ * @note You MUST NOT use any symbols (macros, functions, structures, enums, etc.)
+ * prefixed with an underscore ('_') directly in your application code. These symbols
+ * are part of Azure SDK's internal implementation; we do not document these symbols
+ * and they are subject to change in future versions of the SDK which would break your code.
+ */
+
+#ifndef _az_JSON_KEYSET_H
+#define _az_JSON_KEYSET_H
+
+#include <azure/core/az_json.h>
+#include <azure/core/az_json_document.h>
+#include <azure/core/az_result.h>
+#include <azure/core/az_span.h>
+
+#include <stdint.h>
+
+#include <azure/core/_az_cfg_prefix.h>
+
+/**
+ * @brief The maximum number of names in an #az_json_keyset.
+ */
+#define AZ_JSON_KEYSET_MAX_KEYS 32
+
+/**
+ * @brief A set of property names, indexed for lookups.
+ *
+ * @details Use az_json_keyset_init() to initialize it.
+ */
+typedef struct
+{
+  struct
+  {
+    az_span const* keys;
+    int32_t key_count;
+
+    // An open-addressing hash table, twice as large as the maximum number of keys, holding the
+    // index of a key plus one, or 0 for an empty slot.
+    uint8_t slots[AZ_JSON_KEYSET_MAX_KEYS * 2];
+  } _internal;
+} az_json_keyset;
+
+/**
+ * @brief Indexes \p keys for lookups.
+ *
+ * @param[out] out_keyset A pointer to an #az_json_keyset instance to initialize.
+ * @param[in] keys The unescaped property names. A name's index in this array is the index that
+ * lookups return for it. The array must remain valid, and unchanged, for as long as the keyset is
+ * used.
+ * @param[in] key_count The number of names in \p keys.
+ *
+ * @return An #az_result value indicating the result of the operation.
+ * @retval #AZ_OK Success.
+ * @retval #AZ_ERROR_NOT_ENOUGH_SPACE \p key_count is larger than #AZ_JSON_KEYSET_MAX_KEYS.
+ * @retval #AZ_ERROR_ARG \p keys has the same name more than once.
+ */
+AZ_NODISCARD az_result
+az_json_keyset_init(az_json_keyset* out_keyset, az_span const keys[], int32_t key_count);
+
+/**
+ * @brief Finds which of the names of \p keyset the property name \p property_name is.
+ *
+ * @param[in] keyset A pointer to an initialized #az_json_keyset.
+ * @param[in] property_name A pointer to an #AZ_JSON_TOKEN_PROPERTY_NAME token, as read by an
+ * #az_json_reader or returned by az_json_document_get_token().
+ *
+ * @return The index of the name in the keys of \p keyset, or -1 if it isn't one of them.
+ *
+ * @remarks Property names with escaped characters, or that straddle several buffers of a chunked
+ * reader, are compared with each of the names in turn.
+ */
+AZ_NODISCARD int32_t
+az_json_keyset_find(az_json_keyset const* keyset, az_json_token const* property_name);
+
+/**
+ * @brief Reads the object \p ref_json_reader is on, once, and collects the values of the properties
+ * named in \p keyset.
+ *
+ * @param[in] keyset A pointer to an initialized #az_json_keyset.
+ * @param[in,out] ref_json_reader A pointer to an #az_json_reader instance, on an
+ * #AZ_JSON_TOKEN_BEGIN_OBJECT token or the property name of one, or that hasn't read any token yet
+ * and whose JSON payload is an object. It is left on the end of the object.
+ * @param[out] out_values An array with as many tokens as \p keyset has names. Each receives the
+ * value of the property with that name, or an #AZ_JSON_TOKEN_NONE token if the object has no such
+ * property. For an object or an array, it receives its start, and its children are skipped over.
+ *
+ * @return An #az_result value indicating the result of the operation.
+ * @retval #AZ_OK Success.
+ * @retval #AZ_ERROR_UNEXPECTED_CHAR The value isn't an object.
+ * @retval other Failure while reading the JSON payload.
+ *
+ * @remarks When the object has the same property more than once, the last value is kept. Objects
+ * and arrays are skipped over by matching their brackets, without reading their tokens, unless the
+ * reader reads from several buffers.
+ */
+AZ_NODISCARD az_result az_json_keyset_extract(
+    az_json_keyset const* keyset,
+    az_json_reader* ref_json_reader,
+    az_json_token out_values[]);
+
+/**
+ * @brief Collects the indices of the values of the properties named in \p keyset, in the object at
+ * \p index of \p document.
+ *
+ * @param[in] keyset A pointer to an initialized #az_json_keyset.
+ * @param[in] document A pointer to a parsed #az_json_document.
+ * @param[in] index The index of an #AZ_JSON_TOKEN_BEGIN_OBJECT token.
+ * @param[out] out_indices An array with as many indices as \p keyset has names. Each receives the
+ * index of the value of the property with that name, or -1 if the object has no such property.
+ *
+ * @return An #az_result value indicating the result of the operation.
+ * @retval #AZ_OK Success.
+ *
+ * @remarks When the object has the same property more than once, the last value is kept.
+ */
+AZ_NODISCARD az_result az_json_keyset_extract_from_document(
+    az_json_keyset const* keyset,
+    az_json_document const* document,
+    int32_t index,
+    int32_t out_indices[]);
+
+#include <azure/core/_az_cfg_suffix.h>
+
+#endif // _az_JSON_KEYSET_H
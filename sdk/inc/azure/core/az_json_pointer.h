@@ -0,0 +1,128 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ *
+ * @brief Lookup of a value within a JSON payload by its JSON Pointer (RFC 6901), such as
+ * `/desired/schedule/0/at`.
+ *
+ * @details A pointer is parsed once into an #az_json_pointer, which can then be used to find the
+ * value it refers to in any number of payloads, either with an #az_json_reader (see
+ * az_json_pointer_find()) or within an #az_json_document (see az_json_pointer_find_in_document()).
+ *
+ * Each reference token of the pointer is matched against the unescaped property names of an object,
+ * so `/a~1b` finds the property written as either `"a/b"` or `"a\/b"` in the JSON payload.
+ * Within an array, a reference token must be the index of an element, without leading zeros.
+ *
+ * @note You MUST NOT use any symbols (macros, functions, structures, enums, etc.)
+ * prefixed with an underscore ('_') directly in your application code. These symbols
+ * are part of Azure SDK's internal implementation; we do not document these symbols
+ * and they are subject to change in future versions of the SDK which would break your code.
+ */
+
+#ifndef _az_JSON_POINTER_H
+#define _az_JSON_POINTER_H
+
+#include <azure/core/az_json.h>
+#include <azure/core/az_json_document.h>
+#include <azure/core/az_result.h>
+#include <azure/core/az_span.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <azure/core/_az_cfg_prefix.h>
+
+#ifndef AZ_JSON_POINTER_MAX_TOKENS
+/// The maximum number of reference tokens in an #az_json_pointer, i.e. how deep it can point into a
+/// JSON payload. It can be overridden at compile time.
+#define AZ_JSON_POINTER_MAX_TOKENS 8
+#endif // AZ_JSON_POINTER_MAX_TOKENS
+
+/**
+ * @brief A JSON Pointer that has been parsed into its reference tokens.
+ *
+ * @details Use az_json_pointer_parse() to initialize it. It refers to the text of the pointer,
+ * which must remain valid, and unchanged, for as long as the pointer is used.
+ */
+typedef struct
+{
+  struct
+  {
+    struct
+    {
+      /// The reference token, as written in the pointer (i.e. still escaped with '~').
+      az_span name;
+
+      /// The array index written by the reference token, or -1 if it isn't one.
+      int32_t array_index;
+
+      /// Whether the reference token contains '~0' or '~1'.
+      bool has_escapes;
+    } tokens[AZ_JSON_POINTER_MAX_TOKENS];
+
+    int32_t token_count;
+  } _internal;
+} az_json_pointer;
+
+/**
+ * @brief Parses the text of a JSON Pointer.
+ *
+ * @param[out] out_pointer A pointer to an #az_json_pointer instance to initialize.
+ * @param[in] pointer The JSON Pointer, for example `/a/b/0/c`. An empty pointer refers to the whole
+ * JSON payload. It must remain valid, and unchanged, for as long as \p out_pointer is used.
+ *
+ * @return An #az_result value indicating the result of the operation.
+ * @retval #AZ_OK Success.
+ * @retval #AZ_ERROR_UNEXPECTED_CHAR \p pointer doesn't start with '/', or has a '~' that isn't
+ * followed by '0' or '1'.
+ * @retval #AZ_ERROR_NOT_ENOUGH_SPACE \p pointer has more than #AZ_JSON_POINTER_MAX_TOKENS reference
+ * tokens.
+ */
+AZ_NODISCARD az_result az_json_pointer_parse(az_json_pointer* out_pointer, az_span pointer);
+
+/**
+ * @brief Moves \p ref_json_reader to the value that \p pointer refers to.
+ *
+ * @param[in] pointer A pointer to a parsed #az_json_pointer.
+ * @param[in,out] ref_json_reader A pointer to an #az_json_reader instance. If it hasn't read any
+ * token yet, \p pointer is relative to the root of the JSON payload. Otherwise, it is relative to
+ * the value the reader is on, or to the value of the property name it is on.
+ * @param[out] out_token __[nullable]__ A pointer to the #az_json_token that receives the value,
+ * i.e. the token the reader is left on.
+ *
+ * @return An #az_result value indicating the result of the operation.
+ * @retval #AZ_OK The reader is on the value, so it can be read, or its children read with
+ * az_json_reader_next_token().
+ * @retval #AZ_ERROR_ITEM_NOT_FOUND There is no such value. The position of the reader is
+ * unspecified.
+ * @retval other Failure while reading the JSON payload.
+ *
+ * @remarks The objects and arrays that don't lead to the value are skipped over without reading
+ * their tokens, so the JSON payload is only fully validated up to the value.
+ */
+AZ_NODISCARD az_result az_json_pointer_find(
+    az_json_pointer const* pointer,
+    az_json_reader* ref_json_reader,
+    az_json_token* out_token);
+
+/**
+ * @brief Gets the index of the value that \p pointer refers to within \p document.
+ *
+ * @param[in] pointer A pointer to a parsed #az_json_pointer.
+ * @param[in] document A pointer to a parsed #az_json_document. \p pointer is relative to its root.
+ * @param[out] out_index A pointer to the index that receives the value.
+ *
+ * @return An #az_result value indicating the result of the operation.
+ * @retval #AZ_OK Success.
+ * @retval #AZ_ERROR_ITEM_NOT_FOUND There is no such value.
+ */
+AZ_NODISCARD az_result az_json_pointer_find_in_document(
+    az_json_pointer const* pointer,
+    az_json_document const* document,
+    int32_t* out_index);
+
+#include <azure/core/_az_cfg_suffix.h>
+
+#endif // _az_JSON_POINTER_H
@@ -109,6 +109,9 @@ enum az_result_core
   /// No more JSON text left to process.
   AZ_ERROR_JSON_READER_DONE = _az_RESULT_MAKE_ERROR(_az_FACILITY_CORE_JSON, 3),
 
+  /// The next JSON token continues past the end of the JSON text pushed so far.
+  AZ_ERROR_JSON_READER_NEED_MORE_INPUT = _az_RESULT_MAKE_ERROR(_az_FACILITY_CORE_JSON, 4),
+
   // === HTTP error codes ===
   /// The #az_http_response instance is in an invalid state.
   AZ_ERROR_HTTP_INVALID_STATE = _az_RESULT_MAKE_ERROR(_az_FACILITY_CORE_HTTP, 1),
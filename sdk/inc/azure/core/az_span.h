@@ -268,6 +268,67 @@ void az_span_to_str(char* destination, int32_t destination_max_size, az_span sou
  */
 AZ_NODISCARD int32_t az_span_find(az_span source, az_span target);
 
+/**
+ * @brief Searches for \p target in \p source, ignoring the case of ASCII letters.
+ *
+ * @param[in] source The #az_span with the content to be searched on.
+ * @param[in] target The #az_span containing the tokens to be searched within \p source.
+ *
+ * @return The position of \p target in \p source if \p source contains the \p target within it,
+ * comparing ASCII letters in a case-insensitive manner.
+ * @retval 0 \p target is empty (if its size is equal zero).
+ * @retval -1 \p target is not found in `source` OR \p source is empty (if its size is zero) and \p
+ * target is non-empty.
+ * @retval >=0 The position of \p target in \p source.
+ */
+AZ_NODISCARD int32_t az_span_find_ignoring_case(az_span source, az_span target);
+
+/**
+ * @brief A preprocessed search target, which can be used to search for the same target in many
+ * sources with #az_span_searcher_find().
+ *
+ * @details The searcher stores a 64-bit bloom filter of the bytes in the target and the shift to
+ * apply when its last byte matches but the rest of the target does not. This lets the search skip
+ * ahead by up to the size of the target whenever the byte following the current window can't be
+ * part of the target, so the search is usually sublinear in the size of the source.
+ *
+ * @remarks The searcher does not copy the target; the memory backing it must remain valid for as
+ * long as the searcher is used. Creating a searcher is O(size of target) and requires no
+ * additional memory, so it can be created on the stack right before a search.
+ */
+typedef struct
+{
+  struct
+  {
+    az_span target;
+    uint64_t bloom;
+    int32_t skip;
+  } _internal;
+} az_span_searcher;
+
+/**
+ * @brief Creates an #az_span_searcher for \p target.
+ *
+ * @param[in] target The #az_span containing the bytes to search for.
+ *
+ * @return The #az_span_searcher that can be passed to #az_span_searcher_find().
+ */
+AZ_NODISCARD az_span_searcher az_span_searcher_create(az_span target);
+
+/**
+ * @brief Searches for the target of \p searcher in \p source.
+ *
+ * @param[in] searcher A pointer to an #az_span_searcher created by #az_span_searcher_create().
+ * @param[in] source The #az_span with the content to be searched on.
+ *
+ * @return The position of the target in \p source, with the same semantics as #az_span_find().
+ * @retval 0 The target is empty (if its size is equal zero).
+ * @retval -1 The target is not found in `source` OR \p source is empty (if its size is zero) and
+ * the target is non-empty.
+ * @retval >=0 The position of the target in \p source.
+ */
+AZ_NODISCARD int32_t az_span_searcher_find(az_span_searcher const* searcher, az_span source);
+
 /******************************  SPAN COPYING */
 
 /**
@@ -381,6 +442,12 @@ AZ_NODISCARD az_result az_span_atoi32(az_span source, int32_t* out_number);
  *
  * @remark The #az_span being parsed must contain a number that is finite. Values such as `NaN`,
  * `INFINITY`, and those that would overflow a `double` to `+/-inf` are not allowed.
+ *
+ * @remark Only decimal notation, with an optional sign, fraction and exponent, is accepted.
+ * Hexadecimal floating-point numbers such as `0x1p3`, which earlier versions accepted, are not.
+ *
+ * @remark The result is correctly rounded (to nearest, ties to even), and does not depend on the
+ * current C locale.
  */
 AZ_NODISCARD az_result az_span_atod(az_span source, double* out_number);
 
@@ -452,6 +519,32 @@ AZ_NODISCARD az_result az_span_i64toa(az_span destination, int64_t source, az_sp
  */
 AZ_NODISCARD az_result az_span_u64toa(az_span destination, uint64_t source, az_span* out_span);
 
+/**
+ * @brief Returns the number of bytes that az_span_u64toa() writes for \p source, i.e. its number of
+ * digits (base 10).
+ *
+ * @param[in] source The `uint64_t` whose number of digits is returned.
+ *
+ * @return A value between 1 and 20 (inclusive).
+ *
+ * @remark This can be used to size a buffer exactly before writing a number into it. It also
+ * applies to az_span_u32toa(), since a `uint32_t` has the same digits as the equivalent `uint64_t`.
+ */
+AZ_NODISCARD int32_t az_span_u64toa_size(uint64_t source);
+
+/**
+ * @brief Returns the number of bytes that az_span_i64toa() writes for \p source, i.e. its number of
+ * digits (base 10), plus 1 for the minus sign if \p source is negative.
+ *
+ * @param[in] source The `int64_t` whose number of digits is returned.
+ *
+ * @return A value between 1 and 20 (inclusive).
+ *
+ * @remark This can be used to size a buffer exactly before writing a number into it. It also
+ * applies to az_span_i32toa(), since an `int32_t` has the same digits as the equivalent `int64_t`.
+ */
+AZ_NODISCARD int32_t az_span_i64toa_size(int64_t source);
+
 /**
  * @brief Converts a `double` into its digit characters (base 10 decimal notation) and copies them
  * to the \p destination #az_span starting at its 0-th index.
@@ -483,6 +576,37 @@ AZ_NODISCARD az_result az_span_u64toa(az_span destination, uint64_t source, az_s
 AZ_NODISCARD az_result
 az_span_dtoa(az_span destination, double source, int32_t fractional_digits, az_span* out_span);
 
+/**
+ * @brief Converts a `double` into the shortest sequence of digit characters (base 10) that parses
+ * back to the same `double`, and copies them to the \p destination #az_span starting at its 0-th
+ * index.
+ *
+ * @param destination The #az_span where the bytes should be copied to.
+ * @param[in] source The `double` whose number is copied to the \p destination #az_span as ASCII
+ * digits and characters.
+ * @param[out] out_span A pointer to an #az_span that receives the remainder of the \p destination
+ * #az_span after the `double` has been copied.
+ *
+ * @return An #az_result value indicating the result of the operation.
+ * @retval #AZ_OK Success.
+ * @retval #AZ_ERROR_NOT_ENOUGH_SPACE The \p destination is not big enough to contain the copied
+ * bytes.
+ * @retval #AZ_ERROR_NOT_SUPPORTED The \p source is not a finite decimal number.
+ *
+ * @remark Only finite `double` values are supported. Values such as `NaN` and `INFINITY` are not
+ * allowed.
+ *
+ * @remark Unlike az_span_dtoa(), any finite `double` is supported, and no precision is lost: the
+ * result parses back to exactly \p source with az_span_atod(). When more than one representation
+ * with the fewest digits does, the one closest to \p source is used.
+ *
+ * @remark The number is written the way JavaScript formats numbers: in exponential notation
+ * (such as `1e+21` or `1.5e-7`) when its magnitude is at least 1e21 or below 1e-6, and in decimal
+ * notation (such as `123.45` or `0.001`) otherwise. Negative zero is written as `-0`. At most 25
+ * bytes are written.
+ */
+AZ_NODISCARD az_result az_span_dtoa_shortest(az_span destination, double source, az_span* out_span);
+
 /******************************  NON-CONTIGUOUS SPAN  */
 
 /**
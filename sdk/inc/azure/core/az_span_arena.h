@@ -0,0 +1,264 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ *
+ * @brief A bump allocator that hands out #az_span instances from memory owned by the caller.
+ *
+ * @details An #az_span_arena carves spans out of one or more caller provided blocks of memory,
+ * front to back. Individual spans are never freed; instead, everything allocated after a mark (see
+ * #az_span_arena_get_mark()) or everything at once (see #az_span_arena_reset()) is released in
+ * constant time. This suits per-message scratch memory, such as unescaped JSON strings, parsed
+ * manifests or HTTP response buffers, that all become unused at the same time.
+ *
+ * The arena can also be used as the #az_span_allocator_fn of a chunked #az_json_writer, by passing
+ * #az_span_arena_allocator() as the callback and the arena as its user context.
+ *
+ * @note You MUST NOT use any symbols (macros, functions, structures, enums, etc.)
+ * prefixed with an underscore ('_') directly in your application code. These symbols
+ * are part of Azure SDK's internal implementation; we do not document these symbols
+ * and they are subject to change in future versions of the SDK which would break your code.
+ */
+
+#ifndef _az_SPAN_ARENA_H
+#define _az_SPAN_ARENA_H
+
+#include <azure/core/az_result.h>
+#include <azure/core/az_span.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <azure/core/_az_cfg_prefix.h>
+
+/**
+ * @brief The maximum number of memory blocks an #az_span_arena can allocate from.
+ *
+ * @details Define this before including this header to change it. Each block costs the size of an
+ * #az_span within the #az_span_arena structure.
+ */
+#ifndef AZ_SPAN_ARENA_MAX_BLOCKS
+#define AZ_SPAN_ARENA_MAX_BLOCKS 4
+#endif
+
+/**
+ * @brief Allows the user to define custom behavior when allocating from an #az_span_arena.
+ */
+typedef struct
+{
+  /// The alignment, in bytes, of the start of every span returned by az_span_arena_allocate(). It
+  /// must be a power of 2. The default is 1, i.e. no alignment, which suits byte strings. Use
+  /// az_span_arena_allocate_aligned() for individual allocations that need a different alignment.
+  int32_t alignment;
+} az_span_arena_options;
+
+/**
+ * @brief A bump allocator over caller owned memory.
+ */
+typedef struct
+{
+  struct
+  {
+    az_span blocks[AZ_SPAN_ARENA_MAX_BLOCKS];
+    int32_t block_count;
+    int32_t current_block;
+    int32_t offset; // Within the current block.
+    int32_t bytes_used_in_previous_blocks;
+    int32_t high_water_mark;
+    // The size of the span handed out by az_span_arena_allocator() that hasn't been committed yet,
+    // or 0 if there is none.
+    int32_t open_size;
+    az_span_arena_options options;
+  } _internal;
+} az_span_arena;
+
+/**
+ * @brief A position within an #az_span_arena that it can later be reset to.
+ */
+typedef struct
+{
+  struct
+  {
+    int32_t block;
+    int32_t offset;
+    int32_t bytes_used_in_previous_blocks;
+  } _internal;
+} az_span_arena_mark;
+
+/**
+ * @brief Gets the default #az_span_arena_options.
+ *
+ * @return An #az_span_arena_options instance with an alignment of 1.
+ */
+AZ_NODISCARD AZ_INLINE az_span_arena_options az_span_arena_options_default(void)
+{
+  return (az_span_arena_options){ .alignment = 1 };
+}
+
+/**
+ * @brief Initializes an #az_span_arena that allocates from \p buffer.
+ *
+ * @param[out] out_arena A pointer to an #az_span_arena instance to initialize.
+ * @param[in] buffer The first block of memory to allocate from. It may be empty, in which case
+ * blocks must be added with az_span_arena_add_block() before allocating.
+ * @param[in] options __[nullable]__ A reference to an #az_span_arena_options structure which
+ * defines custom behavior of the #az_span_arena. If `NULL` is passed, the arena will use the
+ * default options (i.e. #az_span_arena_options_default()).
+ *
+ * @return An #az_result value indicating the result of the operation.
+ * @retval #AZ_OK Success.
+ *
+ * @remarks The \p buffer must remain valid, and must not be used for anything else, for as long as
+ * the arena or any span it returned is in use.
+ */
+AZ_NODISCARD az_result az_span_arena_init(
+    az_span_arena* out_arena,
+    az_span buffer,
+    az_span_arena_options const* options);
+
+/**
+ * @brief Adds another block of memory for the arena to allocate from once the previous ones are
+ * exhausted.
+ *
+ * @param[in,out] ref_arena A pointer to an #az_span_arena instance.
+ * @param[in] block The block of memory to add.
+ *
+ * @return An #az_result value indicating the result of the operation.
+ * @retval #AZ_OK Success.
+ * @retval #AZ_ERROR_NOT_ENOUGH_SPACE The arena already has #AZ_SPAN_ARENA_MAX_BLOCKS blocks.
+ *
+ * @remarks An allocation never spans two blocks. When it doesn't fit in the rest of the current
+ * block, the remainder of that block is skipped.
+ */
+AZ_NODISCARD az_result az_span_arena_add_block(az_span_arena* ref_arena, az_span block);
+
+/**
+ * @brief Allocates \p size bytes from the arena, aligned as specified by the
+ * #az_span_arena_options::alignment the arena was initialized with.
+ *
+ * @param[in,out] ref_arena A pointer to an #az_span_arena instance.
+ * @param[in] size The number of bytes to allocate. It can be 0.
+ * @param[out] out_span A pointer to an #az_span that receives the allocated memory.
+ *
+ * @return An #az_result value indicating the result of the operation.
+ * @retval #AZ_OK Success.
+ * @retval #AZ_ERROR_NOT_ENOUGH_SPACE None of the remaining blocks has \p size bytes left. The arena
+ * is unchanged.
+ */
+AZ_NODISCARD az_result
+az_span_arena_allocate(az_span_arena* ref_arena, int32_t size, az_span* out_span);
+
+/**
+ * @brief Allocates \p size bytes from the arena, starting at an address that is a multiple of
+ * \p alignment.
+ *
+ * @param[in,out] ref_arena A pointer to an #az_span_arena instance.
+ * @param[in] size The number of bytes to allocate. It can be 0.
+ * @param[in] alignment The required alignment, in bytes. It must be a power of 2.
+ * @param[out] out_span A pointer to an #az_span that receives the allocated memory.
+ *
+ * @return An #az_result value indicating the result of the operation.
+ * @retval #AZ_OK Success.
+ * @retval #AZ_ERROR_NOT_ENOUGH_SPACE None of the remaining blocks has \p size bytes left after
+ * alignment. The arena is unchanged.
+ */
+AZ_NODISCARD az_result az_span_arena_allocate_aligned(
+    az_span_arena* ref_arena,
+    int32_t size,
+    int32_t alignment,
+    az_span* out_span);
+
+/**
+ * @brief Records how much of the span last handed out by az_span_arena_allocator() was used,
+ * returning the rest of it to the arena.
+ *
+ * @param[in,out] ref_arena A pointer to an #az_span_arena instance.
+ * @param[in] bytes_used The number of bytes used at the start of that span, which can be obtained
+ * with az_json_writer_get_bytes_used_in_destination() once the JSON is complete.
+ *
+ * @remarks az_span_arena_allocator() hands out all of the remaining space in a block, and only
+ * learns how much of it was used on its next call. Until this function is called, that span is
+ * considered fully used by any other allocation, mark or statistic.
+ */
+void az_span_arena_commit(az_span_arena* ref_arena, int32_t bytes_used);
+
+/**
+ * @brief Returns the current position of the arena, to reset it to later on with
+ * az_span_arena_reset_to_mark().
+ *
+ * @param[in] arena A pointer to an #az_span_arena instance.
+ *
+ * @return The current position of the arena.
+ */
+AZ_NODISCARD az_span_arena_mark az_span_arena_get_mark(az_span_arena const* arena);
+
+/**
+ * @brief Releases everything allocated since \p mark was obtained.
+ *
+ * @param[in,out] ref_arena A pointer to an #az_span_arena instance.
+ * @param[in] mark A mark obtained from the same arena, with az_span_arena_get_mark(), after the
+ * last reset to an earlier position.
+ *
+ * @remarks Spans allocated after the mark must no longer be used.
+ */
+void az_span_arena_reset_to_mark(az_span_arena* ref_arena, az_span_arena_mark mark);
+
+/**
+ * @brief Releases everything allocated from the arena.
+ *
+ * @param[in,out] ref_arena A pointer to an #az_span_arena instance.
+ *
+ * @remarks Spans allocated from the arena must no longer be used. The blocks and the high-water
+ * mark are kept.
+ */
+void az_span_arena_reset(az_span_arena* ref_arena);
+
+/**
+ * @brief Returns the number of bytes currently allocated from the arena.
+ *
+ * @param[in] arena A pointer to an #az_span_arena instance.
+ *
+ * @return The number of bytes allocated, including alignment padding, the unused ends of blocks
+ * that were skipped because an allocation didn't fit in them, and all of the last span handed out
+ * by az_span_arena_allocator() until it is committed.
+ */
+AZ_NODISCARD int32_t az_span_arena_get_bytes_used(az_span_arena const* arena);
+
+/**
+ * @brief Returns the largest number of bytes that were ever allocated from the arena at once, as
+ * reported by az_span_arena_get_bytes_used(), but only counting the committed part of the spans
+ * handed out by az_span_arena_allocator().
+ *
+ * @param[in] arena A pointer to an #az_span_arena instance.
+ *
+ * @return The high-water mark of the arena, which can be used to size its memory.
+ */
+AZ_NODISCARD int32_t az_span_arena_get_high_water_mark(az_span_arena const* arena);
+
+/**
+ * @brief An #az_span_allocator_fn that allocates from the #az_span_arena passed as the user
+ * context.
+ *
+ * @param[in] allocator_context The allocator context, whose `user_context` must be a pointer to an
+ * #az_span_arena.
+ * @param[out] out_next_destination A pointer to an #az_span that receives all of the remaining
+ * space in the first block that has at least the minimum required size.
+ *
+ * @return An #az_result value indicating the result of the operation.
+ * @retval #AZ_OK Success.
+ * @retval #AZ_ERROR_NOT_ENOUGH_SPACE None of the remaining blocks has enough space left.
+ *
+ * @remarks The bytes used in the previous span handed out by this function are committed on the
+ * next call. Call az_span_arena_commit() once done writing into the last one. When used with
+ * az_json_writer_chunked_init(), pass #AZ_SPAN_EMPTY as the first destination buffer so that the
+ * whole JSON text comes from the arena. It is then contiguous unless it had to continue in another
+ * block.
+ */
+AZ_NODISCARD az_result az_span_arena_allocator(
+    az_span_allocator_context* allocator_context,
+    az_span* out_next_destination);
+
+#include <azure/core/_az_cfg_suffix.h>
+
+#endif // _az_SPAN_ARENA_H
@@ -0,0 +1,178 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ *
+ * @brief An ordered list of #az_span segments that together make up one logical byte sequence.
+ *
+ * @details An #az_span_list describes data that is scattered across several buffers, such as a
+ * topic, a set of properties and a payload, or HTTP headers and a body, without copying it into one
+ * contiguous buffer first. It is the SDK's equivalent of a POSIX `iovec` array: the list only
+ * refers to an array of #az_span instances owned by the caller, which in turn refer to the bytes.
+ *
+ * The #az_json_reader can read from a list (see #az_json_reader_span_list_init()), the
+ * #az_json_writer can write into one (see #az_json_writer_span_list_init()), and an HTTP request
+ * body can be one, in which case transports can send it without gathering it first.
+ *
+ * @note You MUST NOT use any symbols (macros, functions, structures, enums, etc.)
+ * prefixed with an underscore ('_') directly in your application code. These symbols
+ * are part of Azure SDK's internal implementation; we do not document these symbols
+ * and they are subject to change in future versions of the SDK which would break your code.
+ */
+
+#ifndef _az_SPAN_LIST_H
+#define _az_SPAN_LIST_H
+
+#include <azure/core/az_result.h>
+#include <azure/core/az_span.h>
+
+#include <stdint.h>
+
+#include <azure/core/_az_cfg_prefix.h>
+
+/**
+ * @brief An ordered list of #az_span segments, backed by an array owned by the caller.
+ */
+typedef struct
+{
+  struct
+  {
+    az_span* segments;
+    int32_t segment_count;
+    int32_t capacity;
+  } _internal;
+} az_span_list;
+
+/**
+ * @brief Returns an #az_span_list over the \p segment_count segments in \p segments.
+ *
+ * @param[in] segments The array of segments. It must remain valid for as long as the list is used.
+ * @param[in] segment_count The number of segments in \p segments.
+ *
+ * @return An #az_span_list which is full, i.e. can't be appended to.
+ */
+AZ_NODISCARD AZ_INLINE az_span_list az_span_list_create(az_span segments[], int32_t segment_count)
+{
+  return (az_span_list){ ._internal = {
+                             .segments = segments,
+                             .segment_count = segment_count,
+                             .capacity = segment_count,
+                         } };
+}
+
+/**
+ * @brief Returns an empty #az_span_list which can be appended to with az_span_list_append().
+ *
+ * @param[in] storage The array that receives the segments appended to the list. It must remain
+ * valid for as long as the list is used.
+ * @param[in] capacity The number of elements in \p storage.
+ *
+ * @return An empty #az_span_list.
+ */
+AZ_NODISCARD AZ_INLINE az_span_list az_span_list_create_empty(az_span storage[], int32_t capacity)
+{
+  return (az_span_list){ ._internal = {
+                             .segments = storage,
+                             .segment_count = 0,
+                             .capacity = capacity,
+                         } };
+}
+
+/**
+ * @brief Returns the number of segments in \p list.
+ *
+ * @param[in] list The #az_span_list to query.
+ *
+ * @return The number of segments, some of which may be empty.
+ */
+AZ_NODISCARD AZ_INLINE int32_t az_span_list_get_segment_count(az_span_list list)
+{
+  return list._internal.segment_count;
+}
+
+/**
+ * @brief Returns the segment of \p list at \p index.
+ *
+ * @param[in] list The #az_span_list to query.
+ * @param[in] index The index of the segment, between 0 and the number of segments - 1.
+ *
+ * @return The segment at \p index.
+ */
+AZ_NODISCARD AZ_INLINE az_span az_span_list_get_segment(az_span_list list, int32_t index)
+{
+  return list._internal.segments[index];
+}
+
+/**
+ * @brief Appends \p segment to the end of \p ref_list. The bytes it refers to aren't copied.
+ *
+ * @param[in,out] ref_list A pointer to the #az_span_list to append to.
+ * @param[in] segment The segment to append.
+ *
+ * @return An #az_result value indicating the result of the operation.
+ * @retval #AZ_OK Success.
+ * @retval #AZ_ERROR_NOT_ENOUGH_SPACE The list has no room for another segment.
+ */
+AZ_NODISCARD az_result az_span_list_append(az_span_list* ref_list, az_span segment);
+
+/**
+ * @brief Returns the total number of bytes in all of the segments of \p list.
+ *
+ * @param[in] list The #az_span_list to query.
+ *
+ * @return The sum of the sizes of the segments.
+ */
+AZ_NODISCARD int32_t az_span_list_size(az_span_list list);
+
+/**
+ * @brief Copies the bytes of all of the segments of \p source into \p destination, in order.
+ *
+ * @param[in] destination The #az_span to copy the bytes into. It must be at least as large as the
+ * total size of \p source.
+ * @param[in] source The #az_span_list to copy from.
+ *
+ * @return An #az_span that is a slice of \p destination, starting right after the copied bytes.
+ */
+az_span az_span_list_copy(az_span destination, az_span_list source);
+
+/**
+ * @brief Searches for \p target in the bytes of \p source, including occurrences that straddle
+ * segment boundaries.
+ *
+ * @param[in] source The #az_span_list to search in.
+ * @param[in] target The #az_span to search for.
+ *
+ * @return The position of \p target in the bytes of \p source, counting from the start of the first
+ * segment, with the same semantics as #az_span_find().
+ * @retval 0 The target is empty.
+ * @retval -1 The target is not found in \p source.
+ */
+AZ_NODISCARD int32_t az_span_list_find(az_span_list source, az_span target);
+
+/**
+ * @brief Appends the segments that make up the bytes of \p source from \p start_index to
+ * \p end_index (not included) to \p ref_destination, without copying any of the bytes.
+ *
+ * @param[in] source The #az_span_list to slice.
+ * @param[in] start_index The position of the first byte of the slice, across all segments.
+ * @param[in] end_index The position right after the last byte of the slice. It must be at least
+ * \p start_index and at most the total size of \p source.
+ * @param[in,out] ref_destination A pointer to the #az_span_list that receives the segments of the
+ * slice, usually created with az_span_list_create_empty(). Segments that don't overlap the slice
+ * are left out, and the first and last segments are trimmed to it.
+ *
+ * @return An #az_result value indicating the result of the operation.
+ * @retval #AZ_OK Success.
+ * @retval #AZ_ERROR_NOT_ENOUGH_SPACE \p ref_destination has no room for all of the segments. It is
+ * left unchanged.
+ */
+AZ_NODISCARD az_result az_span_list_slice(
+    az_span_list source,
+    int32_t start_index,
+    int32_t end_index,
+    az_span_list* ref_destination);
+
+#include <azure/core/_az_cfg_suffix.h>
+
+#endif // _az_SPAN_LIST_H
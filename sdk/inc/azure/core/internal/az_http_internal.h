@@ -261,6 +261,21 @@ AZ_NODISCARD az_result az_http_request_set_query_parameter(
 AZ_NODISCARD az_result
 az_http_request_append_header(az_http_request* ref_request, az_span name, az_span value);
 
+/**
+ * @brief Sets the body of the request to the bytes of all of the segments of \p body, replacing the
+ * body the request was initialized with.
+ *
+ * @param ref_request HTTP request to set the body of.
+ * @param body The #az_span_list containing the payload. The segments are sent in order, without
+ * being copied into one buffer, by transports that support it. Both the list's storage and the
+ * bytes must remain valid until the request is sent.
+ *
+ * @return An #az_result value indicating the result of the operation.
+ * @retval #AZ_OK Success.
+ */
+AZ_NODISCARD az_result
+az_http_request_set_body_span_list(az_http_request* ref_request, az_span_list body);
+
 #include <azure/core/_az_cfg_suffix.h>
 
 #endif // _az_HTTP_INTERNAL_H
@@ -15,6 +15,7 @@
 #ifndef _az_IOT_CORE_INTERNAL_H
 #define _az_IOT_CORE_INTERNAL_H
 
+#include <azure/core/az_json.h>
 #include <azure/core/az_result.h>
 #include <azure/core/az_span.h>
 
@@ -54,6 +55,15 @@ AZ_NODISCARD int32_t _az_iot_u64toa_size(uint64_t number);
 AZ_NODISCARD az_result
 _az_span_copy_url_encode(az_span destination, az_span source, az_span* out_remainder);
 
+/**
+ * @brief Checks whether the slice of a JSON string or property name token holds all of its text,
+ * unescaped, so that its bytes can be compared directly.
+ *
+ * @param[in] json_token The token to check.
+ * @return `false` if the token straddles several buffers or has escaped characters.
+ */
+AZ_NODISCARD bool _az_iot_json_token_is_contiguous_unescaped(az_json_token const* json_token);
+
 #include <azure/core/_az_cfg_suffix.h>
 
 #endif // _az_IOT_CORE_INTERNAL_H
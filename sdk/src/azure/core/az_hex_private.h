@@ -37,6 +37,21 @@ AZ_NODISCARD AZ_INLINE uint8_t _az_number_to_upper_hex(uint8_t number)
   return (uint8_t)(number + (number < 10 ? '0' : _az_HEX_UPPER_OFFSET));
 }
 
+/**
+ * Converts a hexadecimal digit character (base16), in either case, into a number [0..15], or
+ * returns -1 if it isn't one.
+ */
+AZ_NODISCARD AZ_INLINE int32_t _az_hex_to_number(uint8_t hex)
+{
+  if (hex >= '0' && hex <= '9')
+  {
+    return hex - '0';
+  }
+
+  uint8_t const lower = (uint8_t)(hex | 0x20U);
+  return lower >= 'a' && lower <= 'f' ? lower - _az_HEX_LOWER_OFFSET : -1;
+}
+
 #include <azure/core/_az_cfg_suffix.h>
 
 #endif // _az_HEX_PRIVATE_H
@@ -58,6 +58,7 @@ AZ_NODISCARD az_result az_http_request_init(
                                    / (int32_t)sizeof(_az_http_request_header),
                                .retry_headers_start_byte_offset = 0,
                                .body = body,
+                               .body_segments = az_span_list_create(NULL, 0),
                            } };
 
   return AZ_OK;
@@ -80,40 +81,37 @@ AZ_NODISCARD az_result az_http_request_set_query_parameter(
   az_span url_remainder = az_span_slice_to_end(ref_request->_internal.url, initial_url_length);
 
   // Adding query parameter. Adding +2 to required length to include extra required symbols `=`
-  // and `?` or `&`.
-  int32_t required_length = 2 + az_span_size(name)
-      + (is_value_url_encoded ? az_span_size(value) : _az_span_url_encode_calc_length(value));
-
-  _az_RETURN_IF_NOT_ENOUGH_SIZE(url_remainder, required_length);
+  // and `?` or `&`. When the value still needs to be URL-encoded, this is only a lower bound, and
+  // the encoding itself checks that the rest fits, in the same pass.
+  _az_RETURN_IF_NOT_ENOUGH_SIZE(url_remainder, 2 + az_span_size(name) + az_span_size(value));
 
   // Append either '?' or '&'
-  uint8_t separator = '&';
-  if (ref_request->_internal.query_start == 0)
-  {
-    separator = '?';
-
-    // update QPs starting position when it's 0
-    ref_request->_internal.query_start = initial_url_length + 1;
-  }
-
-  url_remainder = az_span_copy_u8(url_remainder, separator);
+  bool const is_first_query_parameter = ref_request->_internal.query_start == 0;
+  url_remainder = az_span_copy_u8(url_remainder, is_first_query_parameter ? '?' : '&');
   url_remainder = az_span_copy(url_remainder, name);
 
   // Append equal sym
   url_remainder = az_span_copy_u8(url_remainder, '=');
 
   // Parameter value
+  int32_t value_length = az_span_size(value);
   if (is_value_url_encoded)
   {
     az_span_copy(url_remainder, value);
   }
   else
   {
-    int32_t encoding_size = 0;
-    _az_RETURN_IF_FAILED(_az_span_url_encode(url_remainder, value, &encoding_size));
+    _az_RETURN_IF_FAILED(_az_span_url_encode(url_remainder, value, &value_length));
   }
 
-  ref_request->_internal.url_length += required_length;
+  // Only update the request once everything fits, so that a failure leaves it unchanged.
+  if (is_first_query_parameter)
+  {
+    // update QPs starting position when it's 0
+    ref_request->_internal.query_start = initial_url_length + 1;
+  }
+
+  ref_request->_internal.url_length += 2 + az_span_size(name) + value_length;
 
   return AZ_OK;
 }
@@ -198,7 +196,34 @@ AZ_NODISCARD az_result az_http_request_get_body(az_http_request const* request,
   _az_PRECONDITION_NOT_NULL(request);
   _az_PRECONDITION_NOT_NULL(out_body);
 
-  *out_body = request->_internal.body;
+  az_span_list const segments = request->_internal.body_segments;
+  if (az_span_list_get_segment_count(segments) > 1)
+  {
+    return AZ_ERROR_NOT_SUPPORTED;
+  }
+
+  *out_body = az_span_list_get_segment_count(segments) == 1 ? az_span_list_get_segment(segments, 0)
+                                                             : request->_internal.body;
+  return AZ_OK;
+}
+
+AZ_NODISCARD az_result
+az_http_request_get_body_span_list(az_http_request const* request, az_span_list* out_body)
+{
+  _az_PRECONDITION_NOT_NULL(request);
+  _az_PRECONDITION_NOT_NULL(out_body);
+
+  *out_body = request->_internal.body_segments;
+  return AZ_OK;
+}
+
+AZ_NODISCARD az_result
+az_http_request_set_body_span_list(az_http_request* ref_request, az_span_list body)
+{
+  _az_PRECONDITION_NOT_NULL(ref_request);
+
+  ref_request->_internal.body = AZ_SPAN_EMPTY;
+  ref_request->_internal.body_segments = body;
   return AZ_OK;
 }
 
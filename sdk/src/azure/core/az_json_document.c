@@ -0,0 +1,246 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "az_json_private.h"
+#include <azure/core/az_json_document.h>
+#include <azure/core/az_precondition.h>
+#include <azure/core/internal/az_precondition_internal.h>
+#include <azure/core/internal/az_result_internal.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <azure/core/_az_cfg.h>
+
+AZ_NODISCARD AZ_INLINE bool _az_json_document_is_end(az_json_token_kind kind)
+{
+  return kind == AZ_JSON_TOKEN_END_OBJECT || kind == AZ_JSON_TOKEN_END_ARRAY;
+}
+
+// Called once the value that starts at value_index, and ends right before end_index, is complete.
+static void _az_json_document_end_value(
+    az_json_tape_entry tape[],
+    int32_t value_index,
+    int32_t end_index)
+{
+  tape[value_index]._internal.next_sibling = end_index;
+
+  // A property name is always immediately followed by its value, and its next sibling is the one of
+  // its value.
+  if (value_index > 0 && tape[value_index - 1]._internal.kind == AZ_JSON_TOKEN_PROPERTY_NAME)
+  {
+    tape[value_index - 1]._internal.next_sibling = end_index;
+  }
+}
+
+AZ_NODISCARD az_result az_json_document_parse(
+    az_json_document* out_document,
+    az_span json,
+    az_json_tape_entry tape[],
+    int32_t tape_capacity,
+    az_json_reader_options const* options)
+{
+  _az_PRECONDITION_NOT_NULL(out_document);
+  _az_PRECONDITION_VALID_SPAN(json, 1, false);
+  _az_PRECONDITION_NOT_NULL(tape);
+  _az_PRECONDITION(tape_capacity > 0);
+
+  az_json_reader reader = { 0 };
+  _az_RETURN_IF_FAILED(az_json_reader_init(&reader, json, options));
+
+  // The indices of the objects and arrays that haven't ended yet, innermost last. The reader fails
+  // before they are nested any deeper.
+  int32_t open_containers[_az_MAX_JSON_STACK_SIZE] = { 0 };
+  int32_t depth = 0;
+
+  int32_t count = 0;
+  az_result result = AZ_OK;
+  while (az_result_succeeded(result = az_json_reader_next_token(&reader)))
+  {
+    if (count >= tape_capacity)
+    {
+      return AZ_ERROR_NOT_ENOUGH_SPACE;
+    }
+
+    az_json_token const* const token = &reader.token;
+    tape[count] = (az_json_tape_entry){
+      ._internal = {
+        .offset = (int32_t)(az_span_ptr(token->slice) - az_span_ptr(json)),
+        .size = token->size,
+        .next_sibling = count + 1,
+        .kind = (uint8_t)token->kind,
+        .string_has_escaped_chars = token->_internal.string_has_escaped_chars,
+      },
+    };
+
+    switch (token->kind)
+    {
+      case AZ_JSON_TOKEN_BEGIN_OBJECT:
+      case AZ_JSON_TOKEN_BEGIN_ARRAY:
+        open_containers[depth] = count;
+        depth++;
+        break;
+      case AZ_JSON_TOKEN_END_OBJECT:
+      case AZ_JSON_TOKEN_END_ARRAY:
+        depth--;
+        _az_json_document_end_value(tape, open_containers[depth], count + 1);
+        break;
+      case AZ_JSON_TOKEN_PROPERTY_NAME:
+        // Its next sibling is set once its value is complete.
+        break;
+      default:
+        _az_json_document_end_value(tape, count, count + 1);
+        break;
+    }
+
+    count++;
+  }
+
+  if (result != AZ_ERROR_JSON_READER_DONE)
+  {
+    return result;
+  }
+
+  *out_document = (az_json_document){
+    ._internal = {
+      .json = json,
+      .tape = tape,
+      .entry_count = count,
+    },
+  };
+  return AZ_OK;
+}
+
+AZ_NODISCARD az_json_token
+az_json_document_get_token(az_json_document const* document, int32_t index)
+{
+  _az_PRECONDITION_NOT_NULL(document);
+  _az_PRECONDITION_RANGE(0, index, document->_internal.entry_count - 1);
+
+  az_json_tape_entry const entry = document->_internal.tape[index];
+  return (az_json_token){
+    .slice = az_span_slice(
+        document->_internal.json,
+        entry._internal.offset,
+        entry._internal.offset + entry._internal.size),
+    .kind = (az_json_token_kind)entry._internal.kind,
+    .size = entry._internal.size,
+    ._internal = {
+      .is_multisegment = false,
+      .string_has_escaped_chars = entry._internal.string_has_escaped_chars,
+      .pointer_to_first_buffer = NULL,
+      .start_buffer_index = -1,
+      .start_buffer_offset = -1,
+      .end_buffer_index = -1,
+      .end_buffer_offset = -1,
+    },
+  };
+}
+
+AZ_NODISCARD az_result az_json_document_get_first_child(
+    az_json_document const* document,
+    int32_t index,
+    int32_t* out_index)
+{
+  _az_PRECONDITION_NOT_NULL(document);
+  _az_PRECONDITION_RANGE(0, index, document->_internal.entry_count - 1);
+  _az_PRECONDITION(
+      az_json_document_get_kind(document, index) == AZ_JSON_TOKEN_BEGIN_OBJECT
+      || az_json_document_get_kind(document, index) == AZ_JSON_TOKEN_BEGIN_ARRAY);
+  _az_PRECONDITION_NOT_NULL(out_index);
+
+  // A container always has an end, so the entry after its start exists.
+  if (_az_json_document_is_end(az_json_document_get_kind(document, index + 1)))
+  {
+    return AZ_ERROR_ITEM_NOT_FOUND;
+  }
+
+  *out_index = index + 1;
+  return AZ_OK;
+}
+
+AZ_NODISCARD az_result az_json_document_get_next_sibling(
+    az_json_document const* document,
+    int32_t index,
+    int32_t* out_index)
+{
+  _az_PRECONDITION_NOT_NULL(document);
+  _az_PRECONDITION_RANGE(0, index, document->_internal.entry_count - 1);
+  _az_PRECONDITION(!_az_json_document_is_end(az_json_document_get_kind(document, index)));
+  _az_PRECONDITION_NOT_NULL(out_index);
+
+  int32_t const next = document->_internal.tape[index]._internal.next_sibling;
+  if (next >= document->_internal.entry_count
+      || _az_json_document_is_end(az_json_document_get_kind(document, next)))
+  {
+    return AZ_ERROR_ITEM_NOT_FOUND;
+  }
+
+  *out_index = next;
+  return AZ_OK;
+}
+
+AZ_NODISCARD az_result az_json_document_find_property(
+    az_json_document const* document,
+    int32_t index,
+    az_span name,
+    int32_t* out_index)
+{
+  _az_PRECONDITION_NOT_NULL(document);
+  _az_PRECONDITION_RANGE(0, index, document->_internal.entry_count - 1);
+  _az_PRECONDITION(az_json_document_get_kind(document, index) == AZ_JSON_TOKEN_BEGIN_OBJECT);
+  _az_PRECONDITION_NOT_NULL(out_index);
+
+  int32_t property_name = 0;
+  az_result result = az_json_document_get_first_child(document, index, &property_name);
+  while (az_result_succeeded(result))
+  {
+    az_json_token const token = az_json_document_get_token(document, property_name);
+    if (az_json_token_is_text_equal(&token, name))
+    {
+      *out_index = property_name + 1;
+      return AZ_OK;
+    }
+
+    result = az_json_document_get_next_sibling(document, property_name, &property_name);
+  }
+
+  return result;
+}
+
+AZ_NODISCARD az_span
+az_json_document_get_json_text(az_json_document const* document, int32_t index)
+{
+  _az_PRECONDITION_NOT_NULL(document);
+  _az_PRECONDITION_RANGE(0, index, document->_internal.entry_count - 1);
+
+  az_json_tape_entry const* const tape = document->_internal.tape;
+  az_json_token_kind const kind = (az_json_token_kind)tape[index]._internal.kind;
+  _az_PRECONDITION(kind != AZ_JSON_TOKEN_PROPERTY_NAME && !_az_json_document_is_end(kind));
+
+  // The value ends with the last entry before its next sibling, which is its own entry unless it is
+  // an object or an array.
+  az_json_tape_entry const last = tape[tape[index]._internal.next_sibling - 1];
+  int32_t start = tape[index]._internal.offset;
+  int32_t end = last._internal.offset + last._internal.size;
+
+  if (kind == AZ_JSON_TOKEN_STRING)
+  {
+    start--;
+    end++;
+  }
+
+  return az_span_slice(document->_internal.json, start, end);
+}
+
+AZ_NODISCARD az_result az_json_document_reader_init(
+    az_json_document const* document,
+    int32_t index,
+    az_json_reader* out_json_reader,
+    az_json_reader_options const* options)
+{
+  _az_PRECONDITION_NOT_NULL(out_json_reader);
+
+  return az_json_reader_init(
+      out_json_reader, az_json_document_get_json_text(document, index), options);
+}
@@ -0,0 +1,184 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "az_json_private.h"
+#include <azure/core/az_json_keyset.h>
+#include <azure/core/az_precondition.h>
+#include <azure/core/internal/az_precondition_internal.h>
+#include <azure/core/internal/az_result_internal.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <azure/core/_az_cfg.h>
+
+enum
+{
+  _az_JSON_KEYSET_SLOT_COUNT = AZ_JSON_KEYSET_MAX_KEYS * 2,
+};
+
+// Property names of the same object mostly differ in length or in their first or last byte, which
+// are cheap to get at, so the hash only looks at those.
+AZ_NODISCARD AZ_INLINE int32_t _az_json_keyset_hash(az_span name)
+{
+  uint8_t const* const ptr = az_span_ptr(name);
+  int32_t const size = az_span_size(name);
+  uint32_t hash = (uint32_t)size * 131U;
+  if (size > 0)
+  {
+    hash += (uint32_t)ptr[0] * 31U + (uint32_t)ptr[size - 1];
+  }
+  return (int32_t)(hash % _az_JSON_KEYSET_SLOT_COUNT);
+}
+
+// Returns the index of name in the keys of the keyset, or -1, and the slot where it is, or where it
+// would be inserted.
+AZ_NODISCARD static int32_t
+_az_json_keyset_lookup(az_json_keyset const* keyset, az_span name, int32_t* out_slot)
+{
+  // The table is never more than half full, so there is always an empty slot to stop at.
+  int32_t slot = _az_json_keyset_hash(name);
+  while (keyset->_internal.slots[slot] != 0)
+  {
+    int32_t const key_index = keyset->_internal.slots[slot] - 1;
+    if (az_span_is_content_equal(keyset->_internal.keys[key_index], name))
+    {
+      *out_slot = slot;
+      return key_index;
+    }
+
+    slot = slot + 1 < _az_JSON_KEYSET_SLOT_COUNT ? slot + 1 : 0;
+  }
+
+  *out_slot = slot;
+  return -1;
+}
+
+AZ_NODISCARD az_result
+az_json_keyset_init(az_json_keyset* out_keyset, az_span const keys[], int32_t key_count)
+{
+  _az_PRECONDITION_NOT_NULL(out_keyset);
+  _az_PRECONDITION(key_count >= 0);
+  _az_PRECONDITION(key_count == 0 || keys != NULL);
+
+  if (key_count > AZ_JSON_KEYSET_MAX_KEYS)
+  {
+    return AZ_ERROR_NOT_ENOUGH_SPACE;
+  }
+
+  az_json_keyset keyset = { ._internal = { .keys = keys, .key_count = key_count } };
+  for (int32_t i = 0; i < key_count; i++)
+  {
+    int32_t slot = 0;
+    if (_az_json_keyset_lookup(&keyset, keys[i], &slot) != -1)
+    {
+      return AZ_ERROR_ARG;
+    }
+    keyset._internal.slots[slot] = (uint8_t)(i + 1);
+  }
+
+  *out_keyset = keyset;
+  return AZ_OK;
+}
+
+AZ_NODISCARD int32_t
+az_json_keyset_find(az_json_keyset const* keyset, az_json_token const* property_name)
+{
+  _az_PRECONDITION_NOT_NULL(keyset);
+  _az_PRECONDITION_NOT_NULL(property_name);
+
+  // The length and bytes of the name are only those of the key when it is contiguous and has no
+  // escaped characters, which is almost always.
+  if (property_name->_internal.string_has_escaped_chars || property_name->_internal.is_multisegment)
+  {
+    for (int32_t i = 0; i < keyset->_internal.key_count; i++)
+    {
+      if (az_json_token_is_text_equal(property_name, keyset->_internal.keys[i]))
+      {
+        return i;
+      }
+    }
+    return -1;
+  }
+
+  int32_t slot = 0;
+  return _az_json_keyset_lookup(keyset, property_name->slice, &slot);
+}
+
+AZ_NODISCARD az_result az_json_keyset_extract(
+    az_json_keyset const* keyset,
+    az_json_reader* ref_json_reader,
+    az_json_token out_values[])
+{
+  _az_PRECONDITION_NOT_NULL(keyset);
+  _az_PRECONDITION_NOT_NULL(ref_json_reader);
+  _az_PRECONDITION(keyset->_internal.key_count == 0 || out_values != NULL);
+
+  if (ref_json_reader->token.kind == AZ_JSON_TOKEN_NONE
+      || ref_json_reader->token.kind == AZ_JSON_TOKEN_PROPERTY_NAME)
+  {
+    _az_RETURN_IF_FAILED(az_json_reader_next_token(ref_json_reader));
+  }
+
+  if (ref_json_reader->token.kind != AZ_JSON_TOKEN_BEGIN_OBJECT)
+  {
+    return AZ_ERROR_UNEXPECTED_CHAR;
+  }
+
+  for (int32_t i = 0; i < keyset->_internal.key_count; i++)
+  {
+    out_values[i] = _az_JSON_TOKEN_DEFAULT;
+  }
+
+  while (true)
+  {
+    _az_RETURN_IF_FAILED(az_json_reader_next_token(ref_json_reader));
+    if (ref_json_reader->token.kind == AZ_JSON_TOKEN_END_OBJECT)
+    {
+      return AZ_OK;
+    }
+
+    int32_t const key_index = az_json_keyset_find(keyset, &ref_json_reader->token);
+    _az_RETURN_IF_FAILED(az_json_reader_next_token(ref_json_reader));
+    if (key_index != -1)
+    {
+      out_values[key_index] = ref_json_reader->token;
+    }
+    _az_RETURN_IF_FAILED(_az_json_reader_skip_value(ref_json_reader));
+  }
+}
+
+AZ_NODISCARD az_result az_json_keyset_extract_from_document(
+    az_json_keyset const* keyset,
+    az_json_document const* document,
+    int32_t index,
+    int32_t out_indices[])
+{
+  _az_PRECONDITION_NOT_NULL(keyset);
+  _az_PRECONDITION_NOT_NULL(document);
+  _az_PRECONDITION_RANGE(0, index, az_json_document_get_entry_count(document) - 1);
+  _az_PRECONDITION(az_json_document_get_kind(document, index) == AZ_JSON_TOKEN_BEGIN_OBJECT);
+  _az_PRECONDITION(keyset->_internal.key_count == 0 || out_indices != NULL);
+
+  for (int32_t i = 0; i < keyset->_internal.key_count; i++)
+  {
+    out_indices[i] = -1;
+  }
+
+  int32_t property_name = 0;
+  az_result result = az_json_document_get_first_child(document, index, &property_name);
+  while (az_result_succeeded(result))
+  {
+    az_json_token const token = az_json_document_get_token(document, property_name);
+    int32_t const key_index = az_json_keyset_find(keyset, &token);
+    if (key_index != -1)
+    {
+      out_indices[key_index] = property_name + 1;
+    }
+
+    result = az_json_document_get_next_sibling(document, property_name, &property_name);
+  }
+
+  // Reaching the end of the object is how the loop ends.
+  return AZ_OK;
+}
@@ -0,0 +1,313 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "az_json_private.h"
+#include <azure/core/az_json_pointer.h>
+#include <azure/core/az_precondition.h>
+#include <azure/core/internal/az_precondition_internal.h>
+#include <azure/core/internal/az_result_internal.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <azure/core/_az_cfg.h>
+
+// Returns the array index written by the reference token, or -1 if it isn't one. "-", which refers
+// past the last element, never matches an existing value so it isn't one either.
+AZ_NODISCARD static int32_t _az_json_pointer_parse_array_index(az_span reference_token)
+{
+  uint8_t const* const ptr = az_span_ptr(reference_token);
+  int32_t const size = az_span_size(reference_token);
+
+  // Leading zeros aren't allowed.
+  if (size < 1 || (size > 1 && ptr[0] == '0'))
+  {
+    return -1;
+  }
+
+  int32_t value = 0;
+  for (int32_t i = 0; i < size; i++)
+  {
+    if (!_az_json_byte_is(ptr[i], _az_JSON_BYTE_DIGIT))
+    {
+      return -1;
+    }
+
+    int32_t const digit = ptr[i] - '0';
+    if (value > (INT32_MAX - digit) / 10)
+    {
+      return -1;
+    }
+    value = value * 10 + digit;
+  }
+
+  return value;
+}
+
+AZ_NODISCARD az_result az_json_pointer_parse(az_json_pointer* out_pointer, az_span pointer)
+{
+  _az_PRECONDITION_NOT_NULL(out_pointer);
+  _az_PRECONDITION_VALID_SPAN(pointer, 0, true);
+
+  uint8_t const* const ptr = az_span_ptr(pointer);
+  int32_t const size = az_span_size(pointer);
+
+  // Every reference token, including the first one, is prefixed by '/'.
+  if (size > 0 && ptr[0] != '/')
+  {
+    return AZ_ERROR_UNEXPECTED_CHAR;
+  }
+
+  az_json_pointer parsed = { 0 };
+  int32_t token_start = 1;
+  bool has_escapes = false;
+  for (int32_t i = 1; i <= size; i++)
+  {
+    if (i == size || ptr[i] == '/')
+    {
+      if (parsed._internal.token_count >= AZ_JSON_POINTER_MAX_TOKENS)
+      {
+        return AZ_ERROR_NOT_ENOUGH_SPACE;
+      }
+
+      az_span const name = az_span_slice(pointer, token_start, i);
+      parsed._internal.tokens[parsed._internal.token_count].name = name;
+      parsed._internal.tokens[parsed._internal.token_count].array_index
+          = _az_json_pointer_parse_array_index(name);
+      parsed._internal.tokens[parsed._internal.token_count].has_escapes = has_escapes;
+      parsed._internal.token_count++;
+      token_start = i + 1;
+      has_escapes = false;
+    }
+    else if (ptr[i] == '~')
+    {
+      // '~' only escapes itself, as '~0', and '/', as '~1'.
+      if (i + 1 >= size || (ptr[i + 1] != '0' && ptr[i + 1] != '1'))
+      {
+        return AZ_ERROR_UNEXPECTED_CHAR;
+      }
+      has_escapes = true;
+      i++;
+    }
+  }
+
+  *out_pointer = parsed;
+  return AZ_OK;
+}
+
+// Compares the unescaped text of the property name with the reference token, which has '~0' or '~1'
+// in it, unescaping both as it goes.
+AZ_NODISCARD static bool _az_json_pointer_is_escaped_name_equal(
+    az_json_token const* name,
+    az_span reference_token)
+{
+  uint8_t const* const expected = az_span_ptr(reference_token);
+  int32_t const expected_size = az_span_size(reference_token);
+  int32_t expected_index = 0;
+  bool next_byte_escaped = false;
+
+  bool const is_multisegment = name->_internal.is_multisegment;
+  int32_t const first_segment = is_multisegment ? name->_internal.start_buffer_index : 0;
+  int32_t const last_segment = is_multisegment ? name->_internal.end_buffer_index : 0;
+  for (int32_t segment = first_segment; segment <= last_segment; segment++)
+  {
+    az_span source = name->slice;
+    if (is_multisegment)
+    {
+      source = name->_internal.pointer_to_first_buffer[segment];
+      if (segment == first_segment)
+      {
+        source = az_span_slice_to_end(source, name->_internal.start_buffer_offset);
+      }
+      else if (segment == last_segment)
+      {
+        source = az_span_slice(source, 0, name->_internal.end_buffer_offset);
+      }
+    }
+
+    uint8_t const* const ptr = az_span_ptr(source);
+    int32_t const size = az_span_size(source);
+    for (int32_t i = 0; i < size; i++)
+    {
+      uint8_t byte = ptr[i];
+      if (next_byte_escaped)
+      {
+        // As with az_json_token_is_text_equal(), names with \uXXXX escapes never match.
+        if (byte == 'u')
+        {
+          return false;
+        }
+        byte = _az_json_unescape_single_byte(byte);
+        next_byte_escaped = false;
+      }
+      else if (byte == '\\')
+      {
+        next_byte_escaped = true;
+        continue;
+      }
+
+      if (expected_index >= expected_size)
+      {
+        return false;
+      }
+
+      // The pointer was validated when parsed, so '~' is always followed by '0' or '1'.
+      uint8_t expected_byte = expected[expected_index++];
+      if (expected_byte == '~')
+      {
+        expected_byte = expected[expected_index++] == '0' ? '~' : '/';
+      }
+
+      if (byte != expected_byte)
+      {
+        return false;
+      }
+    }
+  }
+
+  return expected_index == expected_size;
+}
+
+AZ_NODISCARD static bool _az_json_pointer_is_name_equal(
+    az_json_pointer const* pointer,
+    int32_t token_index,
+    az_json_token const* name)
+{
+  az_span const reference_token = pointer->_internal.tokens[token_index].name;
+  return pointer->_internal.tokens[token_index].has_escapes
+      ? _az_json_pointer_is_escaped_name_equal(name, reference_token)
+      : az_json_token_is_text_equal(name, reference_token);
+}
+
+AZ_NODISCARD az_result az_json_pointer_find(
+    az_json_pointer const* pointer,
+    az_json_reader* ref_json_reader,
+    az_json_token* out_token)
+{
+  _az_PRECONDITION_NOT_NULL(pointer);
+  _az_PRECONDITION_NOT_NULL(ref_json_reader);
+  _az_PRECONDITION(
+      ref_json_reader->token.kind != AZ_JSON_TOKEN_END_OBJECT
+      && ref_json_reader->token.kind != AZ_JSON_TOKEN_END_ARRAY);
+
+  if (ref_json_reader->token.kind == AZ_JSON_TOKEN_NONE
+      || ref_json_reader->token.kind == AZ_JSON_TOKEN_PROPERTY_NAME)
+  {
+    _az_RETURN_IF_FAILED(az_json_reader_next_token(ref_json_reader));
+  }
+
+  for (int32_t t = 0; t < pointer->_internal.token_count; t++)
+  {
+    if (ref_json_reader->token.kind == AZ_JSON_TOKEN_BEGIN_OBJECT)
+    {
+      while (true)
+      {
+        _az_RETURN_IF_FAILED(az_json_reader_next_token(ref_json_reader));
+        if (ref_json_reader->token.kind == AZ_JSON_TOKEN_END_OBJECT)
+        {
+          return AZ_ERROR_ITEM_NOT_FOUND;
+        }
+
+        bool const found = _az_json_pointer_is_name_equal(pointer, t, &ref_json_reader->token);
+        _az_RETURN_IF_FAILED(az_json_reader_next_token(ref_json_reader));
+        if (found)
+        {
+          break;
+        }
+        _az_RETURN_IF_FAILED(_az_json_reader_skip_value(ref_json_reader));
+      }
+    }
+    else if (ref_json_reader->token.kind == AZ_JSON_TOKEN_BEGIN_ARRAY)
+    {
+      int32_t const array_index = pointer->_internal.tokens[t].array_index;
+      if (array_index < 0)
+      {
+        return AZ_ERROR_ITEM_NOT_FOUND;
+      }
+
+      for (int32_t i = 0; true; i++)
+      {
+        _az_RETURN_IF_FAILED(az_json_reader_next_token(ref_json_reader));
+        if (ref_json_reader->token.kind == AZ_JSON_TOKEN_END_ARRAY)
+        {
+          return AZ_ERROR_ITEM_NOT_FOUND;
+        }
+
+        if (i == array_index)
+        {
+          break;
+        }
+        _az_RETURN_IF_FAILED(_az_json_reader_skip_value(ref_json_reader));
+      }
+    }
+    else
+    {
+      // Strings, numbers and literals have nothing to point into.
+      return AZ_ERROR_ITEM_NOT_FOUND;
+    }
+  }
+
+  if (out_token != NULL)
+  {
+    *out_token = ref_json_reader->token;
+  }
+  return AZ_OK;
+}
+
+AZ_NODISCARD az_result az_json_pointer_find_in_document(
+    az_json_pointer const* pointer,
+    az_json_document const* document,
+    int32_t* out_index)
+{
+  _az_PRECONDITION_NOT_NULL(pointer);
+  _az_PRECONDITION_NOT_NULL(document);
+  _az_PRECONDITION_NOT_NULL(out_index);
+
+  int32_t index = 0;
+  for (int32_t t = 0; t < pointer->_internal.token_count; t++)
+  {
+    az_json_token_kind const kind = az_json_document_get_kind(document, index);
+    if (kind != AZ_JSON_TOKEN_BEGIN_OBJECT && kind != AZ_JSON_TOKEN_BEGIN_ARRAY)
+    {
+      return AZ_ERROR_ITEM_NOT_FOUND;
+    }
+
+    int32_t child = 0;
+    az_result result = az_json_document_get_first_child(document, index, &child);
+    if (kind == AZ_JSON_TOKEN_BEGIN_OBJECT)
+    {
+      while (az_result_succeeded(result))
+      {
+        az_json_token const name = az_json_document_get_token(document, child);
+        if (_az_json_pointer_is_name_equal(pointer, t, &name))
+        {
+          break;
+        }
+        result = az_json_document_get_next_sibling(document, child, &child);
+      }
+
+      _az_RETURN_IF_FAILED(result);
+      index = child + 1;
+    }
+    else
+    {
+      int32_t const array_index = pointer->_internal.tokens[t].array_index;
+      if (array_index < 0)
+      {
+        return AZ_ERROR_ITEM_NOT_FOUND;
+      }
+
+      // Each element, however large, is skipped in constant time.
+      for (int32_t i = 0; i < array_index && az_result_succeeded(result); i++)
+      {
+        result = az_json_document_get_next_sibling(document, child, &child);
+      }
+
+      _az_RETURN_IF_FAILED(result);
+      index = child;
+    }
+  }
+
+  *out_index = index;
+  return AZ_OK;
+}
@@ -15,6 +15,7 @@
 #ifndef _az_JSON_PRIVATE_H
 #define _az_JSON_PRIVATE_H
 
+#include "az_simd_private.h"
 #include <azure/core/az_json.h>
 #include <azure/core/internal/az_precondition_internal.h>
 
@@ -52,6 +53,10 @@ enum
   // [-][0-9]{16}.[0-9]{15}, i.e. 1+16+1+15 since _az_MAX_SUPPORTED_FRACTIONAL_DIGITS is 15
   _az_MAX_SIZE_FOR_WRITING_DOUBLE = 33,
 
+  // The most digits an integer number token can have for the reader to keep its value, i.e. that
+  // always fit in a uint64_t.
+  _az_JSON_MAX_DIGITS_FOR_INTEGER = 19,
+
   // When writing large JSON strings in chunks, ask for at least 64 bytes, to avoid writing one
   // character at a time.
   // This value should be between 12 and 512 (inclusive).
@@ -138,6 +143,277 @@ AZ_NODISCARD AZ_INLINE bool _az_is_valid_escaped_character(uint8_t byte)
   }
 }
 
+AZ_NODISCARD AZ_INLINE uint8_t _az_json_unescape_single_byte(uint8_t ch)
+{
+  switch (ch)
+  {
+    case 'b':
+      return '\b';
+    case 'f':
+      return '\f';
+    case 'n':
+      return '\n';
+    case 'r':
+      return '\r';
+    case 't':
+      return '\t';
+    case '\\':
+    case '"':
+    case '/':
+    default:
+    {
+      // We are assuming the JSON token string has already been validated before this and we won't
+      // have unexpected bytes folowing the back slash (for example \q). Therefore, just return the
+      // same character back for such cases.
+      return ch;
+    }
+  }
+}
+
+/**
+ * @brief Bit flags describing how the JSON tokenizer treats a byte, looked up in
+ * #_az_json_byte_class.
+ */
+enum
+{
+  // ' ', '\t', '\n' or '\r'.
+  _az_JSON_BYTE_WHITESPACE = 0x01,
+
+  // A byte that ends a number within a complex JSON payload: whitespace, ',', '}' or ']'.
+  _az_JSON_BYTE_NUMBER_END = 0x02,
+
+  // '0' to '9'.
+  _az_JSON_BYTE_DIGIT = 0x04,
+
+  // A byte that starts a number: a digit or '-'.
+  _az_JSON_BYTE_NUMBER_START = 0x08,
+
+  // A byte that can't appear as is within a JSON string: '"', '\\' or a control character.
+  _az_JSON_BYTE_STRING_SPECIAL = 0x10,
+
+  // A byte that starts or ends a string, an object or an array: '"', '{', '}', '[' or ']'.
+  _az_JSON_BYTE_STRUCTURAL = 0x20,
+};
+
+// The _az_JSON_BYTE_* flags of every byte, so that the tokenizer classifies a byte with a single
+// lookup rather than a chain of comparisons.
+static uint8_t const _az_json_byte_class[256] = {
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, // 0x00
+  0x10, 0x13, 0x13, 0x10, 0x10, 0x13, 0x10, 0x10, // 0x08
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, // 0x10
+  0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, // 0x18
+  0x03, 0x00, 0x30, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x20
+  0x00, 0x00, 0x00, 0x00, 0x02, 0x08, 0x00, 0x00, // 0x28
+  0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, 0x0C, // 0x30
+  0x0C, 0x0C, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x38
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x40
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x48
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x50
+  0x00, 0x00, 0x00, 0x20, 0x10, 0x22, 0x00, 0x00, // 0x58
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x60
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x68
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x70
+  0x00, 0x00, 0x00, 0x20, 0x00, 0x22, 0x00, 0x00, // 0x78
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x80
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x88
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x90
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0x98
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xA0
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xA8
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xB0
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xB8
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xC0
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xC8
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xD0
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xD8
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xE0
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xE8
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xF0
+  0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, // 0xF8
+};
+
+AZ_NODISCARD AZ_INLINE bool _az_json_byte_is(uint8_t byte, uint8_t byte_class)
+{
+  return (_az_json_byte_class[byte] & byte_class) != 0;
+}
+
+/**
+ * @brief Returns how many of the \p size bytes at \p ptr, from the start, can appear as is within a
+ * JSON string, i.e. the index of the first '"', '\\' or control character, or \p size.
+ *
+ * @details Such bytes need no further checks when reading or writing a string, so they are skipped
+ * a vector (or 8 bytes) at a time.
+ */
+AZ_NODISCARD AZ_INLINE int32_t _az_json_string_count_plain_bytes(uint8_t const* ptr, int32_t size)
+{
+  int32_t i = 0;
+
+#ifdef _az_SIMD_WIDTH
+  _az_simd_vector const quote = _az_simd_broadcast('"');
+  _az_simd_vector const backslash = _az_simd_broadcast('\\');
+  for (; i + _az_SIMD_WIDTH <= size; i += _az_SIMD_WIDTH)
+  {
+    _az_simd_vector const bytes = _az_simd_load(ptr + i);
+    uint64_t const mask = _az_simd_mask(_az_simd_or(
+        _az_simd_or(_az_simd_eq(bytes, quote), _az_simd_eq(bytes, backslash)),
+        _az_simd_less_than(bytes, ' ')));
+    if (mask != 0)
+    {
+      return i + _az_simd_mask_first_lane(mask);
+    }
+  }
+#endif // _az_SIMD_WIDTH
+
+  for (; i + 8 <= size; i += 8)
+  {
+    uint64_t const word = _az_swar_load(ptr + i);
+    if (_az_swar_has_byte(word, '"') || _az_swar_has_byte(word, '\\')
+        || _az_swar_has_less_than(word, ' '))
+    {
+      break;
+    }
+  }
+
+  while (i < size && !_az_json_byte_is(ptr[i], _az_JSON_BYTE_STRING_SPECIAL))
+  {
+    i++;
+  }
+  return i;
+}
+
+/**
+ * @brief Returns how many of the \p size bytes at \p ptr, from the start, are JSON whitespace.
+ */
+AZ_NODISCARD AZ_INLINE int32_t _az_json_count_whitespace(uint8_t const* ptr, int32_t size)
+{
+  // Minified JSON has no whitespace, and pretty-printed JSON often has a single space between
+  // tokens, so look at the first two bytes before paying for wider loads. Those pay off for the
+  // indentation that follows a newline.
+  if (size < 1 || !_az_json_byte_is(ptr[0], _az_JSON_BYTE_WHITESPACE))
+  {
+    return 0;
+  }
+
+  if (size < 2 || !_az_json_byte_is(ptr[1], _az_JSON_BYTE_WHITESPACE))
+  {
+    return 1;
+  }
+
+  int32_t i = 2;
+
+#ifdef _az_SIMD_WIDTH
+  _az_simd_vector const space = _az_simd_broadcast(' ');
+  _az_simd_vector const tab = _az_simd_broadcast('\t');
+  _az_simd_vector const new_line = _az_simd_broadcast('\n');
+  _az_simd_vector const carriage_return = _az_simd_broadcast('\r');
+  for (; i + _az_SIMD_WIDTH <= size; i += _az_SIMD_WIDTH)
+  {
+    _az_simd_vector const bytes = _az_simd_load(ptr + i);
+    uint64_t const mask = _az_simd_mask(_az_simd_or(
+        _az_simd_or(_az_simd_eq(bytes, space), _az_simd_eq(bytes, tab)),
+        _az_simd_or(_az_simd_eq(bytes, new_line), _az_simd_eq(bytes, carriage_return))));
+    if (mask != _az_SIMD_MASK_ALL)
+    {
+      return i + _az_simd_mask_first_lane(~mask & _az_SIMD_MASK_ALL);
+    }
+  }
+#endif // _az_SIMD_WIDTH
+
+  for (; i + 8 <= size; i += 8)
+  {
+    uint64_t const word = _az_swar_load_little_endian(ptr + i);
+    uint64_t const mask = _az_swar_byte_mask(word, ' ') | _az_swar_byte_mask(word, '\t')
+        | _az_swar_byte_mask(word, '\n') | _az_swar_byte_mask(word, '\r');
+    if (mask != _az_SWAR_REPEAT(0x80))
+    {
+      return i + _az_ctz64(~mask & _az_SWAR_REPEAT(0x80)) / 8;
+    }
+  }
+
+  while (i < size && _az_json_byte_is(ptr[i], _az_JSON_BYTE_WHITESPACE))
+  {
+    i++;
+  }
+  return i;
+}
+
+/**
+ * @brief Returns how many of the \p size bytes at \p ptr, from the start, are neither '"' nor a
+ * bracket, i.e. the index of the next byte that changes the nesting when skipping over a container,
+ * or \p size.
+ */
+AZ_NODISCARD AZ_INLINE int32_t _az_json_count_non_structural_bytes(uint8_t const* ptr, int32_t size)
+{
+  int32_t i = 0;
+
+  // Setting the 0x20 bit turns '[' into '{' and ']' into '}', and no other byte into either.
+#ifdef _az_SIMD_WIDTH
+  _az_simd_vector const case_bit = _az_simd_broadcast(0x20);
+  _az_simd_vector const quote = _az_simd_broadcast('"');
+  _az_simd_vector const open_brace = _az_simd_broadcast('{');
+  _az_simd_vector const close_brace = _az_simd_broadcast('}');
+  for (; i + _az_SIMD_WIDTH <= size; i += _az_SIMD_WIDTH)
+  {
+    _az_simd_vector const bytes = _az_simd_load(ptr + i);
+    _az_simd_vector const folded = _az_simd_or(bytes, case_bit);
+    uint64_t const mask = _az_simd_mask(_az_simd_or(
+        _az_simd_eq(bytes, quote),
+        _az_simd_or(_az_simd_eq(folded, open_brace), _az_simd_eq(folded, close_brace))));
+    if (mask != 0)
+    {
+      return i + _az_simd_mask_first_lane(mask);
+    }
+  }
+#endif // _az_SIMD_WIDTH
+
+  for (; i + 8 <= size; i += 8)
+  {
+    uint64_t const word = _az_swar_load(ptr + i);
+    uint64_t const folded = word | _az_SWAR_REPEAT(0x20);
+    if (_az_swar_has_byte(word, '"') || _az_swar_has_byte(folded, '{')
+        || _az_swar_has_byte(folded, '}'))
+    {
+      break;
+    }
+  }
+
+  while (i < size && !_az_json_byte_is(ptr[i], _az_JSON_BYTE_STRUCTURAL))
+  {
+    i++;
+  }
+  return i;
+}
+
+/**
+ * @brief Moves \p ref_json_reader from the start of an object or an array to its end, by matching
+ * brackets and jumping over strings instead of reading every token in between.
+ *
+ * @details The children are only checked for balanced brackets and terminated strings, so this is
+ * meant for subtrees that are never looked at. The reader can't be pushed in chunks, and it is left
+ * unchanged if this fails.
+ */
+AZ_NODISCARD az_result _az_json_reader_skip_container(az_json_reader* ref_json_reader);
+
+/**
+ * @brief Moves \p ref_json_reader past the value it is on, if it is an object or an array, for
+ * lookups that only look at some of the values.
+ *
+ * @details Uses _az_json_reader_skip_container(), unless the payload is pushed in chunks, in which
+ * case every token is read.
+ */
+AZ_NODISCARD AZ_INLINE az_result _az_json_reader_skip_value(az_json_reader* ref_json_reader)
+{
+  az_json_token_kind const kind = ref_json_reader->token.kind;
+  if (kind != AZ_JSON_TOKEN_BEGIN_OBJECT && kind != AZ_JSON_TOKEN_BEGIN_ARRAY)
+  {
+    return AZ_OK;
+  }
+
+  return az_span_size(ref_json_reader->_internal.carry_buffer) == 0
+      ? _az_json_reader_skip_container(ref_json_reader)
+      : az_json_reader_skip_children(ref_json_reader);
+}
+
 #include <azure/core/_az_cfg_suffix.h>
 
-#endif // _az_SPAN_PRIVATE_H
+#endif // _az_JSON_PRIVATE_H
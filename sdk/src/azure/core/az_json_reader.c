@@ -90,6 +90,110 @@ AZ_NODISCARD az_result az_json_reader_chunked_init(
   return AZ_OK;
 }
 
+AZ_NODISCARD az_result az_json_reader_span_list_init(
+    az_json_reader* out_json_reader,
+    az_span_list json_segments,
+    az_json_reader_options const* options)
+{
+  _az_PRECONDITION(az_span_list_get_segment_count(json_segments) >= 1);
+
+  return az_json_reader_chunked_init(
+      out_json_reader,
+      json_segments._internal.segments,
+      az_span_list_get_segment_count(json_segments),
+      options);
+}
+
+AZ_NODISCARD az_result az_json_reader_push_init(
+    az_json_reader* out_json_reader,
+    az_span carry_buffer,
+    az_json_reader_options const* options)
+{
+  _az_PRECONDITION_NOT_NULL(out_json_reader);
+  _az_PRECONDITION_VALID_SPAN(carry_buffer, 1, false);
+
+  // Until the first chunk is pushed, the reader reads an empty buffer, as if it had carried over
+  // nothing from a previous chunk.
+  *out_json_reader = (az_json_reader){
+    .token = (az_json_token){
+      .kind = AZ_JSON_TOKEN_NONE,
+      .slice = AZ_SPAN_EMPTY,
+      .size = 0,
+      ._internal = {
+        .is_multisegment = false,
+        .string_has_escaped_chars = false,
+        .pointer_to_first_buffer = &AZ_SPAN_EMPTY,
+        .start_buffer_index = -1,
+        .start_buffer_offset = -1,
+        .end_buffer_index = -1,
+        .end_buffer_offset = -1,
+      },
+    },
+    .current_depth = 0,
+    ._internal = {
+      .json_buffer = az_span_slice(carry_buffer, 0, 0),
+      .json_buffers = &AZ_SPAN_EMPTY,
+      .number_of_buffers = 1,
+      .buffer_index = 0,
+      .bytes_consumed = 0,
+      .total_bytes_consumed = 0,
+      .is_complex_json = false,
+      .bit_stack = { 0 },
+      .options = options == NULL ? az_json_reader_options_default() : *options,
+      .carry_buffer = carry_buffer,
+      .pending_chunk = AZ_SPAN_EMPTY,
+      .carried_size = 0,
+      .is_final_chunk = false,
+    },
+  };
+  return AZ_OK;
+}
+
+// Appends as much of the pending chunk as fits after the unread bytes of the carry buffer.
+static void _az_json_reader_fill_carry_buffer(az_json_reader* ref_json_reader)
+{
+  az_span const carry_buffer = ref_json_reader->_internal.carry_buffer;
+  az_span const pending_chunk = ref_json_reader->_internal.pending_chunk;
+  int32_t const unread_size = az_span_size(ref_json_reader->_internal.json_buffer);
+  int32_t copied_size = az_span_size(carry_buffer) - unread_size;
+  if (copied_size > az_span_size(pending_chunk))
+  {
+    copied_size = az_span_size(pending_chunk);
+  }
+
+  az_span_copy(
+      az_span_slice_to_end(carry_buffer, unread_size),
+      az_span_slice(pending_chunk, 0, copied_size));
+  ref_json_reader->_internal.json_buffer
+      = az_span_slice(carry_buffer, 0, unread_size + copied_size);
+  ref_json_reader->_internal.pending_chunk = az_span_slice_to_end(pending_chunk, copied_size);
+}
+
+AZ_NODISCARD az_result
+az_json_reader_push(az_json_reader* ref_json_reader, az_span json_chunk, bool is_final_chunk)
+{
+  _az_PRECONDITION_NOT_NULL(ref_json_reader);
+  _az_PRECONDITION_VALID_SPAN(ref_json_reader->_internal.carry_buffer, 1, false);
+  _az_PRECONDITION_VALID_SPAN(json_chunk, 0, true);
+  _az_PRECONDITION(!ref_json_reader->_internal.is_final_chunk);
+  _az_PRECONDITION(ref_json_reader->_internal.bytes_consumed == 0);
+  _az_PRECONDITION(az_span_size(ref_json_reader->_internal.pending_chunk) == 0);
+
+  ref_json_reader->_internal.is_final_chunk = is_final_chunk;
+
+  // Read the chunk in place, unless the start of a token was carried over, in which case the token
+  // is completed in the carry buffer.
+  if (ref_json_reader->_internal.carried_size == 0)
+  {
+    ref_json_reader->_internal.json_buffer = json_chunk;
+    return AZ_OK;
+  }
+
+  ref_json_reader->_internal.pending_chunk = json_chunk;
+  _az_json_reader_fill_carry_buffer(ref_json_reader);
+  return AZ_OK;
+}
+
 AZ_NODISCARD static az_span _get_remaining_json(az_json_reader* json_reader)
 {
   _az_PRECONDITION_NOT_NULL(json_reader);
@@ -181,10 +285,9 @@ AZ_NODISCARD static az_span _az_json_reader_skip_whitespace(az_json_reader* ref_
 
   while (true)
   {
-    json = _az_span_trim_whitespace_from_start(remaining);
-
-    // Find out how many whitespace characters were trimmed.
-    int32_t consumed = _az_span_diff(json, remaining);
+    int32_t const consumed
+        = _az_json_count_whitespace(az_span_ptr(remaining), az_span_size(remaining));
+    json = az_span_slice_to_end(remaining, consumed);
 
     ref_json_reader->_internal.bytes_consumed += consumed;
     ref_json_reader->_internal.total_bytes_consumed += consumed;
@@ -254,13 +357,30 @@ AZ_NODISCARD static az_result _az_json_reader_process_string(az_json_reader* ref
   int32_t current_index = 0;
   int32_t string_length = 0;
   uint8_t* token_ptr = az_span_ptr(token);
-  uint8_t next_byte = token_ptr[0];
+  uint8_t next_byte = 0;
 
   // Clear the state of any previous string token.
   ref_json_reader->token._internal.string_has_escaped_chars = false;
 
   while (true)
   {
+    // Skip past the bytes that need no further checks, many at a time, stopping at a '"', '\\' or
+    // control character, or at the end of the segment.
+    int32_t const plain_bytes = _az_json_string_count_plain_bytes(
+        token_ptr + current_index, remaining_size - current_index);
+    current_index += plain_bytes;
+    string_length += plain_bytes;
+
+    if (current_index >= remaining_size)
+    {
+      _az_RETURN_IF_FAILED(_az_json_reader_get_next_buffer(ref_json_reader, &token, false));
+      current_index = 0;
+      token_ptr = az_span_ptr(token);
+      remaining_size = az_span_size(token);
+      continue;
+    }
+
+    next_byte = token_ptr[current_index];
     if (next_byte == '"')
     {
       break;
@@ -321,23 +441,11 @@ AZ_NODISCARD static az_result _az_json_reader_process_string(az_json_reader* ref
     else
     {
       // Control characters are invalid within a JSON string and should be correctly escaped.
-      if (next_byte < _az_ASCII_SPACE_CHARACTER)
-      {
-        return AZ_ERROR_UNEXPECTED_CHAR;
-      }
+      return AZ_ERROR_UNEXPECTED_CHAR;
     }
 
     current_index++;
     string_length++;
-
-    if (current_index >= remaining_size)
-    {
-      _az_RETURN_IF_FAILED(_az_json_reader_get_next_buffer(ref_json_reader, &token, false));
-      current_index = 0;
-      token_ptr = az_span_ptr(token);
-      remaining_size = az_span_size(token);
-    }
-    next_byte = token_ptr[current_index];
   }
 
   _az_json_reader_update_state(
@@ -381,21 +489,15 @@ AZ_NODISCARD static az_result _az_json_reader_process_property_name(az_json_read
   return AZ_OK;
 }
 
-// Used to search for possible valid end of a number character, when we have complex JSON payloads
-// (i.e. not a single JSON value).
-// Whitespace characters, comma, or a container end character indicate the end of a JSON number.
-static const az_span json_delimiters = AZ_SPAN_LITERAL_FROM_STR(",}] \n\r\t");
-
 AZ_NODISCARD static bool _az_finished_consuming_json_number(
     uint8_t next_byte,
     az_span expected_next_bytes,
     az_result* out_result)
 {
-  az_span next_byte_span = az_span_create(&next_byte, 1);
-
-  // Checking if we are done processing a JSON number
-  int32_t index = az_span_find(json_delimiters, next_byte_span);
-  if (index != -1)
+  // Checking if we are done processing a JSON number, when we have complex JSON payloads (i.e. not
+  // a single JSON value). Whitespace characters, comma, or a container end character indicate the
+  // end of a JSON number.
+  if (_az_json_byte_is(next_byte, _az_JSON_BYTE_NUMBER_END))
   {
     *out_result = AZ_OK;
     return true;
@@ -405,8 +507,7 @@ AZ_NODISCARD static bool _az_finished_consuming_json_number(
   // indicate scientific notation. For example "01" or "123f" is invalid.
   // The next character after "[-][digits].[digits]" must be 'e'/'E' if we haven't reached the end
   // of the number yet. For example, "1.1f" or "1.1-" are invalid.
-  index = az_span_find(expected_next_bytes, next_byte_span);
-  if (index == -1)
+  if (az_span_find(expected_next_bytes, az_span_create(&next_byte, 1)) == -1)
   {
     *out_result = AZ_ERROR_UNEXPECTED_CHAR;
     return true;
@@ -415,12 +516,15 @@ AZ_NODISCARD static bool _az_finished_consuming_json_number(
   return false;
 }
 
-static void _az_json_reader_consume_digits(
+// Consumes a run of digits, and returns their value, modulo 2^64, which is exact for up to 19 of
+// them.
+static uint64_t _az_json_reader_consume_digits(
     az_json_reader* ref_json_reader,
     az_span* token,
     int32_t* current_consumed,
     int32_t* total_consumed)
 {
+  uint64_t value = 0;
   int32_t counter = 0;
   az_span current = az_span_slice_to_end(*token, *current_consumed);
   while (true)
@@ -430,8 +534,9 @@ static void _az_json_reader_consume_digits(
 
     while (counter < token_size)
     {
-      if (isdigit(*next_byte_ptr))
+      if (_az_json_byte_is(*next_byte_ptr, _az_JSON_BYTE_DIGIT))
       {
+        value = value * 10U + (uint64_t)(*next_byte_ptr - '0');
         counter++;
         next_byte_ptr++;
       }
@@ -454,6 +559,22 @@ static void _az_json_reader_consume_digits(
 
   *total_consumed += counter;
   *current_consumed += counter;
+  return value;
+}
+
+// Records the value of an integer number token, accumulated while validating it, so that the
+// integer getters don't need to parse the number again. Those with more digits than are always
+// exact in 64 bits are parsed again.
+static void _az_json_reader_set_integer_value(
+    az_json_reader* ref_json_reader,
+    bool is_negative,
+    uint64_t magnitude,
+    int32_t digit_count)
+{
+  ref_json_reader->token._internal.number_is_integer
+      = digit_count <= _az_JSON_MAX_DIGITS_FOR_INTEGER;
+  ref_json_reader->token._internal.number_is_negative = is_negative;
+  ref_json_reader->token._internal.number_magnitude = magnitude;
 }
 
 AZ_NODISCARD static az_result _az_json_reader_update_number_state_if_single_value(
@@ -486,7 +607,7 @@ AZ_NODISCARD static az_result _az_validate_next_byte_is_digit(
     *current_consumed = 0;
   }
 
-  if (!isdigit(az_span_ptr(current)[0]))
+  if (!_az_json_byte_is(az_span_ptr(current)[0], _az_JSON_BYTE_DIGIT))
   {
     return AZ_ERROR_UNEXPECTED_CHAR;
   }
@@ -501,8 +622,12 @@ AZ_NODISCARD static az_result _az_json_reader_process_number(az_json_reader* ref
   int32_t total_consumed = 0;
   int32_t current_consumed = 0;
 
+  // Until the number turns out to be an integer.
+  ref_json_reader->token._internal.number_is_integer = false;
+
   uint8_t next_byte = az_span_ptr(token)[0];
-  if (next_byte == '-')
+  bool const is_negative = next_byte == '-';
+  if (is_negative)
   {
     total_consumed++;
     current_consumed++;
@@ -518,6 +643,7 @@ AZ_NODISCARD static az_result _az_json_reader_process_number(az_json_reader* ref
   {
     total_consumed++;
     current_consumed++;
+    _az_json_reader_set_integer_value(ref_json_reader, is_negative, 0, 1);
 
     if (current_consumed >= az_span_size(token))
     {
@@ -553,10 +679,14 @@ AZ_NODISCARD static az_result _az_json_reader_process_number(az_json_reader* ref
   }
   else
   {
-    _az_PRECONDITION(isdigit(next_byte));
+    _az_PRECONDITION(_az_json_byte_is(next_byte, _az_JSON_BYTE_DIGIT));
 
     // Integer part before decimal
-    _az_json_reader_consume_digits(ref_json_reader, &token, &current_consumed, &total_consumed);
+    int32_t const integer_start = total_consumed;
+    uint64_t const magnitude = _az_json_reader_consume_digits(
+        ref_json_reader, &token, &current_consumed, &total_consumed);
+    _az_json_reader_set_integer_value(
+        ref_json_reader, is_negative, magnitude, total_consumed - integer_start);
 
     if (current_consumed >= az_span_size(token))
     {
@@ -591,6 +721,9 @@ AZ_NODISCARD static az_result _az_json_reader_process_number(az_json_reader* ref
     }
   }
 
+  // The number has a fraction or an exponent.
+  ref_json_reader->token._internal.number_is_integer = false;
+
   if (next_byte == '.')
   {
     total_consumed++;
@@ -680,8 +813,7 @@ AZ_NODISCARD static az_result _az_json_reader_process_number(az_json_reader* ref
 
   // Checking if we are done processing a JSON number
   next_byte = az_span_ptr(token)[current_consumed];
-  int32_t index = az_span_find(json_delimiters, az_span_create(&next_byte, 1));
-  if (index == -1)
+  if (!_az_json_byte_is(next_byte, _az_JSON_BYTE_NUMBER_END))
   {
     return AZ_ERROR_UNEXPECTED_CHAR;
   }
@@ -743,47 +875,32 @@ AZ_NODISCARD static az_result _az_json_reader_process_value(
     az_json_reader* ref_json_reader,
     uint8_t const next_byte)
 {
-  if (next_byte == '"')
-  {
-    return _az_json_reader_process_string(ref_json_reader);
-  }
-
-  if (next_byte == '{')
-  {
-    return _az_json_reader_process_container_start(
-        ref_json_reader, AZ_JSON_TOKEN_BEGIN_OBJECT, _az_JSON_STACK_OBJECT);
-  }
-
-  if (next_byte == '[')
-  {
-    return _az_json_reader_process_container_start(
-        ref_json_reader, AZ_JSON_TOKEN_BEGIN_ARRAY, _az_JSON_STACK_ARRAY);
-  }
-
-  if (isdigit(next_byte) || next_byte == '-')
-  {
-    return _az_json_reader_process_number(ref_json_reader);
-  }
-
-  if (next_byte == 'f')
-  {
-    return _az_json_reader_process_literal(
-        ref_json_reader, AZ_SPAN_FROM_STR("false"), AZ_JSON_TOKEN_FALSE);
-  }
-
-  if (next_byte == 't')
-  {
-    return _az_json_reader_process_literal(
-        ref_json_reader, AZ_SPAN_FROM_STR("true"), AZ_JSON_TOKEN_TRUE);
-  }
-
-  if (next_byte == 'n')
+  switch (next_byte)
   {
-    return _az_json_reader_process_literal(
-        ref_json_reader, AZ_SPAN_FROM_STR("null"), AZ_JSON_TOKEN_NULL);
+    case '"':
+      return _az_json_reader_process_string(ref_json_reader);
+    case '{':
+      return _az_json_reader_process_container_start(
+          ref_json_reader, AZ_JSON_TOKEN_BEGIN_OBJECT, _az_JSON_STACK_OBJECT);
+    case '[':
+      return _az_json_reader_process_container_start(
+          ref_json_reader, AZ_JSON_TOKEN_BEGIN_ARRAY, _az_JSON_STACK_ARRAY);
+    case 'f':
+      return _az_json_reader_process_literal(
+          ref_json_reader, AZ_SPAN_FROM_STR("false"), AZ_JSON_TOKEN_FALSE);
+    case 't':
+      return _az_json_reader_process_literal(
+          ref_json_reader, AZ_SPAN_FROM_STR("true"), AZ_JSON_TOKEN_TRUE);
+    case 'n':
+      return _az_json_reader_process_literal(
+          ref_json_reader, AZ_SPAN_FROM_STR("null"), AZ_JSON_TOKEN_NULL);
+    default:
+      if (_az_json_byte_is(next_byte, _az_JSON_BYTE_NUMBER_START))
+      {
+        return _az_json_reader_process_number(ref_json_reader);
+      }
+      return AZ_ERROR_UNEXPECTED_CHAR;
   }
-
-  return AZ_ERROR_UNEXPECTED_CHAR;
 }
 
 AZ_NODISCARD static az_result _az_json_reader_read_first_token(
@@ -871,10 +988,8 @@ AZ_NODISCARD static az_result _az_json_reader_process_next_byte(
   return AZ_ERROR_UNEXPECTED_CHAR;
 }
 
-AZ_NODISCARD az_result az_json_reader_next_token(az_json_reader* ref_json_reader)
+AZ_NODISCARD static az_result _az_json_reader_read_next_token(az_json_reader* ref_json_reader)
 {
-  _az_PRECONDITION_NOT_NULL(ref_json_reader);
-
   az_span json = _az_json_reader_skip_whitespace(ref_json_reader);
 
   if (az_span_size(json) < 1)
@@ -943,6 +1058,96 @@ AZ_NODISCARD az_result az_json_reader_next_token(az_json_reader* ref_json_reader
   }
 }
 
+// Reads the next token of a reader initialized with az_json_reader_push_init(), turning the end of
+// the input pushed so far into AZ_ERROR_JSON_READER_NEED_MORE_INPUT, unless it is the end of the
+// payload.
+AZ_NODISCARD static az_result _az_json_reader_push_next_token(az_json_reader* ref_json_reader)
+{
+  while (true)
+  {
+    az_json_reader const before = *ref_json_reader;
+    az_result const result = _az_json_reader_read_next_token(ref_json_reader);
+
+    // A number is the only token that can end at the end of the input, and still go on in the next
+    // chunk, which is only possible when it is the whole payload.
+    bool const reached_end = result == AZ_ERROR_UNEXPECTED_END
+        || result == AZ_ERROR_JSON_READER_DONE
+        || (result == AZ_OK && ref_json_reader->token.kind == AZ_JSON_TOKEN_NUMBER
+            && ref_json_reader->_internal.bytes_consumed
+                == az_span_size(ref_json_reader->_internal.json_buffer));
+    if (!reached_end
+        || (before._internal.is_final_chunk && az_span_size(before._internal.pending_chunk) == 0))
+    {
+      return result;
+    }
+
+    // Go back to before the token, past any whitespace, which is skipped before any token.
+    *ref_json_reader = before;
+    az_span unread = _get_remaining_json(ref_json_reader);
+    int32_t const whitespace_size
+        = _az_json_count_whitespace(az_span_ptr(unread), az_span_size(unread));
+    unread = az_span_slice_to_end(unread, whitespace_size);
+    int32_t const read_size = ref_json_reader->_internal.bytes_consumed + whitespace_size;
+    ref_json_reader->_internal.total_bytes_consumed += whitespace_size;
+    ref_json_reader->_internal.bytes_consumed = 0;
+
+    int32_t const carried_size = ref_json_reader->_internal.carried_size;
+    if (az_span_size(ref_json_reader->_internal.pending_chunk) > 0)
+    {
+      // Once the token starts past the bytes carried over, the rest of the chunk is read in place.
+      if (read_size >= carried_size)
+      {
+        int32_t const copied_size
+            = az_span_size(ref_json_reader->_internal.json_buffer) - carried_size;
+        az_span const pending_chunk = ref_json_reader->_internal.pending_chunk;
+        ref_json_reader->_internal.json_buffer = az_span_slice_to_end(
+            az_span_create(
+                az_span_ptr(pending_chunk) - copied_size,
+                copied_size + az_span_size(pending_chunk)),
+            read_size - carried_size);
+        ref_json_reader->_internal.pending_chunk = AZ_SPAN_EMPTY;
+        ref_json_reader->_internal.carried_size = 0;
+        continue;
+      }
+
+      // Otherwise, make room in the carry buffer for more of the chunk.
+      if (az_span_size(unread) == az_span_size(ref_json_reader->_internal.carry_buffer))
+      {
+        return AZ_ERROR_NOT_ENOUGH_SPACE;
+      }
+      az_span_copy(ref_json_reader->_internal.carry_buffer, unread);
+      ref_json_reader->_internal.json_buffer
+          = az_span_slice(ref_json_reader->_internal.carry_buffer, 0, az_span_size(unread));
+      ref_json_reader->_internal.carried_size = carried_size - read_size;
+      _az_json_reader_fill_carry_buffer(ref_json_reader);
+      continue;
+    }
+
+    // Everything pushed so far has been read: carry the start of the token over to the next chunk.
+    if (az_span_size(unread) > az_span_size(ref_json_reader->_internal.carry_buffer))
+    {
+      return AZ_ERROR_NOT_ENOUGH_SPACE;
+    }
+    az_span_copy(ref_json_reader->_internal.carry_buffer, unread);
+    ref_json_reader->_internal.json_buffer
+        = az_span_slice(ref_json_reader->_internal.carry_buffer, 0, az_span_size(unread));
+    ref_json_reader->_internal.carried_size = az_span_size(unread);
+    return AZ_ERROR_JSON_READER_NEED_MORE_INPUT;
+  }
+}
+
+AZ_NODISCARD az_result az_json_reader_next_token(az_json_reader* ref_json_reader)
+{
+  _az_PRECONDITION_NOT_NULL(ref_json_reader);
+
+  if (az_span_size(ref_json_reader->_internal.carry_buffer) > 0)
+  {
+    return _az_json_reader_push_next_token(ref_json_reader);
+  }
+
+  return _az_json_reader_read_next_token(ref_json_reader);
+}
+
 AZ_NODISCARD az_result az_json_reader_skip_children(az_json_reader* ref_json_reader)
 {
   _az_PRECONDITION_NOT_NULL(ref_json_reader);
@@ -964,3 +1169,136 @@ AZ_NODISCARD az_result az_json_reader_skip_children(az_json_reader* ref_json_rea
   }
   return AZ_OK;
 }
+
+AZ_NODISCARD az_result az_json_reader_skip_children_fast(az_json_reader* ref_json_reader)
+{
+  _az_PRECONDITION_NOT_NULL(ref_json_reader);
+
+  if (ref_json_reader->token.kind == AZ_JSON_TOKEN_PROPERTY_NAME)
+  {
+    _az_RETURN_IF_FAILED(az_json_reader_next_token(ref_json_reader));
+  }
+
+  return _az_json_reader_skip_value(ref_json_reader);
+}
+
+AZ_NODISCARD az_result _az_json_reader_skip_container(az_json_reader* ref_json_reader)
+{
+  _az_PRECONDITION_NOT_NULL(ref_json_reader);
+  _az_PRECONDITION(
+      ref_json_reader->token.kind == AZ_JSON_TOKEN_BEGIN_OBJECT
+      || ref_json_reader->token.kind == AZ_JSON_TOKEN_BEGIN_ARRAY);
+  _az_PRECONDITION(az_span_size(ref_json_reader->_internal.carry_buffer) == 0);
+
+  // Track the nesting and the position on copies, so that the reader is left unchanged if the JSON
+  // is malformed.
+  _az_json_bit_stack bit_stack = ref_json_reader->_internal.bit_stack;
+  int32_t const depth = bit_stack._internal.current_depth;
+  int32_t buffer_index = ref_json_reader->_internal.buffer_index;
+  az_span buffer = ref_json_reader->_internal.json_buffer;
+  int32_t i = ref_json_reader->_internal.bytes_consumed;
+  int32_t skipped_size = -i;
+
+  // A string, or the character after a backslash, can go on in the next buffer.
+  bool in_string = false;
+  bool in_escape = false;
+
+  while (true)
+  {
+    uint8_t const* const json = az_span_ptr(buffer);
+    int32_t const size = az_span_size(buffer);
+    while (i < size)
+    {
+      if (in_escape)
+      {
+        in_escape = false;
+        i++;
+        continue;
+      }
+
+      if (in_string)
+      {
+        // Jump to the closing quote, or to the next escaped character.
+        i += _az_json_string_count_plain_bytes(json + i, size - i);
+        if (i >= size)
+        {
+          break;
+        }
+
+        // Control characters must be escaped within strings.
+        if (json[i] != '"' && json[i] != '\\')
+        {
+          return AZ_ERROR_UNEXPECTED_CHAR;
+        }
+        in_string = json[i] != '"';
+        in_escape = in_string;
+        i++;
+        continue;
+      }
+
+      // Numbers, literals, separators and whitespace are only skipped over, a vector at a time.
+      i += _az_json_count_non_structural_bytes(json + i, size - i);
+      if (i >= size)
+      {
+        break;
+      }
+
+      uint8_t const byte = json[i];
+      if (byte == '"')
+      {
+        in_string = true;
+      }
+      else if (byte == '{' || byte == '[')
+      {
+        if (bit_stack._internal.current_depth >= _az_MAX_JSON_STACK_SIZE)
+        {
+          return AZ_ERROR_JSON_NESTING_OVERFLOW;
+        }
+        _az_json_stack_push(
+            &bit_stack, byte == '{' ? _az_JSON_STACK_OBJECT : _az_JSON_STACK_ARRAY);
+      }
+      else
+      {
+        if (_az_json_stack_peek(&bit_stack)
+            != (byte == '}' ? _az_JSON_STACK_OBJECT : _az_JSON_STACK_ARRAY))
+        {
+          return AZ_ERROR_UNEXPECTED_CHAR;
+        }
+        _az_json_stack_pop(&bit_stack);
+
+        if (bit_stack._internal.current_depth < depth)
+        {
+          ref_json_reader->_internal.bit_stack = bit_stack;
+          ref_json_reader->_internal.buffer_index = buffer_index;
+          ref_json_reader->_internal.json_buffer = buffer;
+          ref_json_reader->_internal.bytes_consumed = i;
+          ref_json_reader->_internal.total_bytes_consumed += skipped_size + i;
+          ref_json_reader->token._internal.start_buffer_index = -1;
+          ref_json_reader->token._internal.start_buffer_offset = -1;
+          _az_json_reader_update_state(
+              ref_json_reader,
+              byte == '}' ? AZ_JSON_TOKEN_END_OBJECT : AZ_JSON_TOKEN_END_ARRAY,
+              az_span_slice(buffer, i, i + 1),
+              1,
+              1);
+          return AZ_OK;
+        }
+      }
+      i++;
+    }
+
+    // Carry on in the next buffer, if any. Empty buffers aren't allowed.
+    if (buffer_index >= ref_json_reader->_internal.number_of_buffers - 1)
+    {
+      return AZ_ERROR_UNEXPECTED_END;
+    }
+    skipped_size += size;
+    buffer_index++;
+    buffer = ref_json_reader->_internal.json_buffers[buffer_index];
+    i = 0;
+    if (az_span_size(buffer) < 1)
+    {
+      return AZ_ERROR_UNEXPECTED_END;
+    }
+  }
+}
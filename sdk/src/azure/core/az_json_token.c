@@ -5,11 +5,18 @@
 #include <azure/core/internal/az_result_internal.h>
 #include <azure/core/internal/az_span_internal.h>
 
+#include "az_hex_private.h"
 #include "az_json_private.h"
 
 #include "az_span_private.h"
+
+#include <string.h>
+
 #include <azure/core/_az_cfg.h>
 
+// 2^53, up to which all integers are exactly representable as a double.
+#define _az_JSON_MAX_EXACT_INTEGER_FOR_DOUBLE (UINT64_C(1) << 53U)
+
 static az_span _az_json_token_copy_into_span_helper(
     az_json_token const* json_token,
     az_span destination)
@@ -56,33 +63,6 @@ az_span az_json_token_copy_into_span(az_json_token const* json_token, az_span de
   return _az_json_token_copy_into_span_helper(json_token, destination);
 }
 
-AZ_NODISCARD static uint8_t _az_json_unescape_single_byte(uint8_t ch)
-{
-  switch (ch)
-  {
-    case 'b':
-      return '\b';
-    case 'f':
-      return '\f';
-    case 'n':
-      return '\n';
-    case 'r':
-      return '\r';
-    case 't':
-      return '\t';
-    case '\\':
-    case '"':
-    case '/':
-    default:
-    {
-      // We are assuming the JSON token string has already been validated before this and we won't
-      // have unexpected bytes folowing the back slash (for example \q). Therefore, just return the
-      // same character back for such cases.
-      return ch;
-    }
-  }
-}
-
 AZ_NODISCARD static bool _az_json_token_is_text_equal_helper(
     az_span token_slice,
     az_span* expected_text,
@@ -274,107 +254,365 @@ AZ_NODISCARD az_result az_json_token_get_boolean(az_json_token const* json_token
   return AZ_OK;
 }
 
-AZ_NODISCARD static az_result _az_json_token_get_string_helper(
+enum
+{
+  // The size of a \uXXXX escape sequence.
+  _az_JSON_UNICODE_ESCAPE_SIZE = 6,
+
+  // The size of the longest escape sequence: a surrogate pair, as \uXXXX\uXXXX.
+  _az_JSON_MAX_ESCAPE_SEQUENCE_SIZE = 2 * _az_JSON_UNICODE_ESCAPE_SIZE,
+
+  // The number of bytes between escape sequences that are copied one at a time, before looking for
+  // the next escape sequence in bulk.
+  _az_JSON_SHORT_RUN_SIZE = 32,
+
+  _az_UNICODE_REPLACEMENT_CHARACTER = 0xFFFD,
+};
+
+// Reads the 4 hexadecimal digits of a \uXXXX escape sequence, or returns -1 if they aren't.
+AZ_NODISCARD static int32_t _az_json_read_utf16_code_unit(uint8_t const* escape_sequence)
+{
+  if (escape_sequence[0] != '\\' || escape_sequence[1] != 'u')
+  {
+    return -1;
+  }
+
+  int32_t code_unit = 0;
+  for (int32_t i = 2; i < _az_JSON_UNICODE_ESCAPE_SIZE; i++)
+  {
+    int32_t const digit = _az_hex_to_number(escape_sequence[i]);
+    if (digit < 0)
+    {
+      return -1;
+    }
+    code_unit = (code_unit << 4) | digit;
+  }
+  return code_unit;
+}
+
+// Writes a code point as UTF-8, and returns the number of bytes written, which is at most 4.
+static int32_t _az_json_write_utf8(uint32_t code_point, uint8_t* destination)
+{
+  if (code_point < 0x80U)
+  {
+    destination[0] = (uint8_t)code_point;
+    return 1;
+  }
+
+  if (code_point < 0x800U)
+  {
+    destination[0] = (uint8_t)(0xC0U | (code_point >> 6U));
+    destination[1] = (uint8_t)(0x80U | (code_point & 0x3FU));
+    return 2;
+  }
+
+  if (code_point < 0x10000U)
+  {
+    destination[0] = (uint8_t)(0xE0U | (code_point >> 12U));
+    destination[1] = (uint8_t)(0x80U | ((code_point >> 6U) & 0x3FU));
+    destination[2] = (uint8_t)(0x80U | (code_point & 0x3FU));
+    return 3;
+  }
+
+  destination[0] = (uint8_t)(0xF0U | (code_point >> 18U));
+  destination[1] = (uint8_t)(0x80U | ((code_point >> 12U) & 0x3FU));
+  destination[2] = (uint8_t)(0x80U | ((code_point >> 6U) & 0x3FU));
+  destination[3] = (uint8_t)(0x80U | (code_point & 0x3FU));
+  return 4;
+}
+
+// The byte that a backslash followed by each byte stands for, or 0 if that isn't a two byte escape
+// sequence, i.e. if it is \uXXXX, or malformed. A lookup, rather than a switch, keeps the hot loop
+// of _az_json_unescape() free of branches that depend on which escape sequence it is.
+static uint8_t const _az_json_unescaped_byte[256] = {
+  ['"'] = '"', ['\\'] = '\\', ['/'] = '/', ['b'] = '\b',
+  ['f'] = '\f', ['n'] = '\n', ['r'] = '\r', ['t'] = '\t',
+};
+
+// Unescapes the escape sequence at the start of source that isn't a two byte one, which must be
+// a \uXXXX escape sequence, or the surrogate pair written as \uXXXX\uXXXX, as UTF-8. A surrogate
+// that isn't part of a pair is written as the replacement character, U+FFFD. Sets
+// out_sequence_size to 0, without writing anything, when the sequence may continue past the end of
+// source, and is_last is false.
+AZ_NODISCARD static az_result _az_json_unescape_utf16(
     az_span source,
-    char* destination,
-    int32_t destination_max_size,
-    int32_t* dest_idx,
-    bool* next_char_escaped)
+    bool is_last,
+    uint8_t* destination,
+    int32_t destination_size,
+    int32_t* ref_written,
+    int32_t* out_sequence_size)
 {
-  int32_t source_size = az_span_size(source);
-  uint8_t* source_ptr = az_span_ptr(source);
-  for (int32_t i = 0; i < source_size; i++)
+  uint8_t const* const source_ptr = az_span_ptr(source);
+  int32_t const source_size = az_span_size(source);
+  *out_sequence_size = 0;
+
+  if (source_size >= 2 && source_ptr[1] != 'u')
+  {
+    return AZ_ERROR_UNEXPECTED_CHAR;
+  }
+
+  if (source_size < _az_JSON_UNICODE_ESCAPE_SIZE)
+  {
+    return is_last ? AZ_ERROR_UNEXPECTED_END : AZ_OK;
+  }
+
+  int32_t const code_unit = _az_json_read_utf16_code_unit(source_ptr);
+  if (code_unit < 0)
+  {
+    return AZ_ERROR_UNEXPECTED_CHAR;
+  }
+
+  int32_t sequence_size = _az_JSON_UNICODE_ESCAPE_SIZE;
+  uint32_t code_point = (uint32_t)code_unit;
+  if (code_unit >= 0xD800 && code_unit <= 0xDBFF)
   {
-    if (*dest_idx >= destination_max_size)
+    int32_t low_surrogate = -1;
+    if (source_size >= _az_JSON_MAX_ESCAPE_SEQUENCE_SIZE)
     {
-      return AZ_ERROR_NOT_ENOUGH_SPACE;
+      low_surrogate = _az_json_read_utf16_code_unit(source_ptr + _az_JSON_UNICODE_ESCAPE_SIZE);
+    }
+    else if (!is_last)
+    {
+      // The low surrogate that completes the pair may be past the end of the source.
+      return AZ_OK;
     }
-    uint8_t token_byte = source_ptr[i];
 
-    if (token_byte == '\\' || *next_char_escaped)
+    if (low_surrogate >= 0xDC00 && low_surrogate <= 0xDFFF)
     {
-      if (*next_char_escaped)
-      {
-        token_byte = _az_json_unescape_single_byte(token_byte);
-      }
-      else
+      sequence_size = _az_JSON_MAX_ESCAPE_SEQUENCE_SIZE;
+      code_point = 0x10000U + (((uint32_t)code_unit - 0xD800U) << 10U)
+          + ((uint32_t)low_surrogate - 0xDC00U);
+    }
+    else
+    {
+      code_point = _az_UNICODE_REPLACEMENT_CHARACTER;
+    }
+  }
+  else if (code_unit >= 0xDC00 && code_unit <= 0xDFFF)
+  {
+    code_point = _az_UNICODE_REPLACEMENT_CHARACTER;
+  }
+
+  // The sequence is decoded before writing, since in place the bytes written can overlap it.
+  uint8_t utf8[4];
+  int32_t const utf8_size = _az_json_write_utf8(code_point, utf8);
+  if (utf8_size > destination_size - *ref_written)
+  {
+    return AZ_ERROR_NOT_ENOUGH_SPACE;
+  }
+
+  for (int32_t i = 0; i < utf8_size; i++)
+  {
+    destination[*ref_written + i] = utf8[i];
+  }
+  *ref_written += utf8_size;
+  *out_sequence_size = sequence_size;
+  return AZ_OK;
+}
+
+// Unescapes source into destination, after the ref_written bytes already there. Unescaping never
+// writes more bytes than it reads, so destination can be source itself, or start before it.
+//
+// Unless is_last, the source is followed by more of the same string, so the bytes from an escape
+// sequence that may continue past its end are left for the caller, who gets the number of bytes
+// consumed in out_consumed.
+AZ_NODISCARD static az_result _az_json_unescape(
+    az_span source,
+    bool is_last,
+    uint8_t* destination,
+    int32_t destination_size,
+    int32_t* ref_written,
+    int32_t* out_consumed)
+{
+  uint8_t const* const source_ptr = az_span_ptr(source);
+  int32_t const source_size = az_span_size(source);
+  int32_t written = *ref_written;
+  int32_t run_size = 0;
+  az_result result = AZ_OK;
+
+  int32_t i = 0;
+  for (; i < source_size; i++)
+  {
+    uint8_t byte = source_ptr[i];
+    if (byte == '\\')
+    {
+      run_size = 0;
+      byte = i + 1 < source_size ? _az_json_unescaped_byte[source_ptr[i + 1]] : 0;
+      if (byte == 0)
       {
-        i++;
-        if (i >= source_size)
+        int32_t sequence_size = 0;
+        result = _az_json_unescape_utf16(
+            az_span_slice_to_end(source, i),
+            is_last,
+            destination,
+            destination_size,
+            &written,
+            &sequence_size);
+        if (az_result_failed(result) || sequence_size == 0)
         {
-          *next_char_escaped = true;
           break;
         }
-        token_byte = _az_json_unescape_single_byte(source_ptr[i]);
+
+        i += sequence_size - 1;
+        continue;
       }
-      *next_char_escaped = false;
 
-      // TODO: Characters escaped in the form of \uXXXX where XXXX is the UTF-16 code point, is
-      // not currently supported.
-      // To do this, we need to encode UTF-16 codepoints (including surrogate pairs) into UTF-8.
-      if (token_byte == 'u')
+      i++;
+    }
+    else if (++run_size == _az_JSON_SHORT_RUN_SIZE)
+    {
+      // Runs between escape sequences are mostly short in escaped JSON text, so their bytes are
+      // copied one at a time. Once a run gets longer, the rest of it is looked through in bulk,
+      // with memchr(), which C libraries vectorize, and copied at once.
+      uint8_t const* const backslash
+          = (uint8_t const*)memchr(source_ptr + i, '\\', (size_t)(source_size - i));
+      run_size = backslash == NULL ? source_size - i : (int32_t)(backslash - (source_ptr + i));
+      if (run_size > destination_size - written)
       {
-        return AZ_ERROR_NOT_IMPLEMENTED;
+        result = AZ_ERROR_NOT_ENOUGH_SPACE;
+        break;
       }
+
+      // The source and destination may overlap when unescaping in place.
+      memmove(destination + written, source_ptr + i, (size_t)run_size);
+      written += run_size;
+      i += run_size - 1;
+      run_size = 0;
+      continue;
+    }
+
+    if (written == destination_size)
+    {
+      result = AZ_ERROR_NOT_ENOUGH_SPACE;
+      break;
     }
 
-    destination[*dest_idx] = (char)token_byte;
-    *dest_idx = *dest_idx + 1;
+    destination[written++] = byte;
   }
 
-  return AZ_OK;
+  *ref_written = written;
+  *out_consumed = i;
+  return result;
 }
 
-AZ_NODISCARD az_span az_json_string_unescape(az_span json_string, az_span destination)
+// Unescapes a string token that straddles several buffers. The escape sequences that straddle two
+// or more of them are gathered into a small buffer first.
+AZ_NODISCARD static az_result _az_json_token_unescape_multisegment(
+    az_json_token const* json_token,
+    uint8_t* destination,
+    int32_t destination_size,
+    int32_t* ref_written)
 {
-  _az_PRECONDITION_VALID_SPAN(json_string, 1, false);
-
-  int32_t span_size = az_span_size(json_string);
+  _az_PRECONDITION(json_token->_internal.is_multisegment);
 
-  // The destination needs to be at least as large as the input, in the worst case.
-  _az_PRECONDITION_VALID_SPAN(destination, span_size, false);
+  int32_t index = json_token->_internal.start_buffer_index;
+  int32_t offset = json_token->_internal.start_buffer_offset;
+  int32_t const end_index = json_token->_internal.end_buffer_index;
 
-  int32_t position = 0;
-  uint8_t* span_ptr = az_span_ptr(json_string);
-  uint8_t* destination_ptr = az_span_ptr(destination);
-  int32_t destination_size = az_span_size(destination);
-  for (int32_t i = 0; i < span_size; i++)
+  while (true)
   {
-    uint8_t current_char = span_ptr[i];
-    if (current_char == '\\' && i < span_size - 1)
+    az_span buffer = json_token->_internal.pointer_to_first_buffer[index];
+    if (index == end_index)
     {
-      uint8_t next_char = span_ptr[i + 1];
-      // check that we have something to escape
-      if (_az_is_valid_escaped_character(next_char))
+      buffer = az_span_slice(buffer, 0, json_token->_internal.end_buffer_offset);
+    }
+
+    int32_t consumed = 0;
+    _az_RETURN_IF_FAILED(_az_json_unescape(
+        az_span_slice_to_end(buffer, offset),
+        index == end_index,
+        destination,
+        destination_size,
+        ref_written,
+        &consumed));
+    offset += consumed;
+
+    if (offset == az_span_size(buffer))
+    {
+      if (index == end_index)
+      {
+        return AZ_OK;
+      }
+      index++;
+      offset = 0;
+      continue;
+    }
+
+    // An escape sequence continues in the next buffers.
+    uint8_t sequence[_az_JSON_MAX_ESCAPE_SEQUENCE_SIZE];
+    int32_t sequence_size = 0;
+    int32_t gather_index = index;
+    int32_t gather_offset = offset;
+    while (sequence_size < _az_JSON_MAX_ESCAPE_SEQUENCE_SIZE)
+    {
+      az_span gather_buffer = json_token->_internal.pointer_to_first_buffer[gather_index];
+      if (gather_index == end_index)
+      {
+        gather_buffer = az_span_slice(gather_buffer, 0, json_token->_internal.end_buffer_offset);
+      }
+
+      if (gather_offset < az_span_size(gather_buffer))
       {
-        current_char = _az_json_unescape_single_byte(next_char);
-        i++;
+        sequence[sequence_size++] = az_span_ptr(gather_buffer)[gather_offset++];
+      }
+      else if (gather_index < end_index)
+      {
+        gather_index++;
+        gather_offset = 0;
       }
       else
       {
-        // We assume that the input json is well-formed, but stop processing, in-case it isn't.
-        return az_span_slice(destination, 0, position);
+        break;
       }
     }
-    else if (current_char == '\\')
-    {
-      // At this point, we are at the last character, i == span_size - 1
-      // We assume that the input json is well-formed, but stop processing, in-case it isn't.
-      return az_span_slice(destination, 0, position);
-    }
 
-    if (position > destination_size)
+    _az_RETURN_IF_FAILED(_az_json_unescape(
+        az_span_create(sequence, sequence_size),
+        sequence_size < _az_JSON_MAX_ESCAPE_SEQUENCE_SIZE,
+        destination,
+        destination_size,
+        ref_written,
+        &consumed));
+
+    // Move past the bytes of the sequence that were consumed, across buffers.
+    while (consumed > 0)
     {
-      // We assume that the destination buffer is large enough, but stop processing, in-case it
-      // isn't.
-      return az_span_slice(destination, 0, position);
+      az_span const current = json_token->_internal.pointer_to_first_buffer[index];
+      int32_t const current_size
+          = index == end_index ? json_token->_internal.end_buffer_offset : az_span_size(current);
+      int32_t const step = consumed < current_size - offset ? consumed : current_size - offset;
+      offset += step;
+      consumed -= step;
+      if (consumed > 0)
+      {
+        index++;
+        offset = 0;
+      }
     }
-
-    destination_ptr[position] = current_char;
-    position++;
   }
+}
+
+AZ_NODISCARD az_span az_json_string_unescape(az_span json_string, az_span destination)
+{
+  _az_PRECONDITION_VALID_SPAN(json_string, 1, false);
 
-  return az_span_slice(destination, 0, position);
+  // The destination needs to be at least as large as the input, in the worst case.
+  _az_PRECONDITION_VALID_SPAN(destination, az_span_size(json_string), false);
+
+  // We assume that the input json is well-formed, and that the destination is large enough, but
+  // stop processing, in-case they aren't, and return what was unescaped up to there.
+  int32_t written = 0;
+  int32_t consumed = 0;
+  az_result const result = _az_json_unescape(
+      json_string,
+      true,
+      az_span_ptr(destination),
+      az_span_size(destination),
+      &written,
+      &consumed);
+  (void)result;
+
+  return az_span_slice(destination, 0, written);
 }
 
 AZ_NODISCARD az_result az_json_token_get_string(
@@ -435,41 +673,25 @@ AZ_NODISCARD az_result az_json_token_get_string(
     return AZ_ERROR_NOT_ENOUGH_SPACE;
   }
 
+  // Keep the last byte for the null terminator.
+  uint8_t* const destination_ptr = (uint8_t*)destination;
+  int32_t const destination_size = destination_max_size - 1;
   int32_t dest_idx = 0;
-  bool next_char_escaped = false;
 
   // Contiguous token
   if (!json_token->_internal.is_multisegment)
   {
-    _az_RETURN_IF_FAILED(_az_json_token_get_string_helper(
-        token_slice, destination, destination_max_size, &dest_idx, &next_char_escaped));
+    int32_t consumed = 0;
+    _az_RETURN_IF_FAILED(_az_json_unescape(
+        token_slice, true, destination_ptr, destination_size, &dest_idx, &consumed));
   }
   else
   {
     // Token straddles more than one segment
-    for (int32_t i = json_token->_internal.start_buffer_index;
-         i <= json_token->_internal.end_buffer_index;
-         i++)
-    {
-      az_span source = json_token->_internal.pointer_to_first_buffer[i];
-      if (i == json_token->_internal.start_buffer_index)
-      {
-        source = az_span_slice_to_end(source, json_token->_internal.start_buffer_offset);
-      }
-      else if (i == json_token->_internal.end_buffer_index)
-      {
-        source = az_span_slice(source, 0, json_token->_internal.end_buffer_offset);
-      }
-
-      _az_RETURN_IF_FAILED(_az_json_token_get_string_helper(
-          source, destination, destination_max_size, &dest_idx, &next_char_escaped));
-    }
+    _az_RETURN_IF_FAILED(_az_json_token_unescape_multisegment(
+        json_token, destination_ptr, destination_size, &dest_idx));
   }
 
-  if (dest_idx >= destination_max_size)
-  {
-    return AZ_ERROR_NOT_ENOUGH_SPACE;
-  }
   destination[dest_idx] = 0;
 
   if (out_string_length != NULL)
@@ -491,6 +713,18 @@ az_json_token_get_uint64(az_json_token const* json_token, uint64_t* out_value)
     return AZ_ERROR_JSON_INVALID_STATE;
   }
 
+  // The reader kept the value of integers of up to 19 digits, while validating them.
+  if (json_token->_internal.number_is_integer)
+  {
+    if (json_token->_internal.number_is_negative)
+    {
+      return AZ_ERROR_UNEXPECTED_CHAR;
+    }
+
+    *out_value = json_token->_internal.number_magnitude;
+    return AZ_OK;
+  }
+
   az_span token_slice = json_token->slice;
 
   // Contiguous token
@@ -526,6 +760,19 @@ az_json_token_get_uint32(az_json_token const* json_token, uint32_t* out_value)
     return AZ_ERROR_JSON_INVALID_STATE;
   }
 
+  // The reader kept the value of integers of up to 19 digits, while validating them.
+  if (json_token->_internal.number_is_integer)
+  {
+    if (json_token->_internal.number_is_negative
+        || json_token->_internal.number_magnitude > UINT32_MAX)
+    {
+      return AZ_ERROR_UNEXPECTED_CHAR;
+    }
+
+    *out_value = (uint32_t)json_token->_internal.number_magnitude;
+    return AZ_OK;
+  }
+
   az_span token_slice = json_token->slice;
 
   // Contiguous token
@@ -560,6 +807,23 @@ AZ_NODISCARD az_result az_json_token_get_int64(az_json_token const* json_token,
     return AZ_ERROR_JSON_INVALID_STATE;
   }
 
+  // The reader kept the value of integers of up to 19 digits, while validating them.
+  if (json_token->_internal.number_is_integer)
+  {
+    bool const is_negative = json_token->_internal.number_is_negative;
+    uint64_t const magnitude = json_token->_internal.number_magnitude;
+
+    // The absolute value of INT64_MIN is 1 more than the absolute value of INT64_MAX.
+    if (magnitude > (uint64_t)INT64_MAX + (is_negative ? 1U : 0U))
+    {
+      return AZ_ERROR_UNEXPECTED_CHAR;
+    }
+
+    // Negate as an unsigned value, so that INT64_MIN doesn't overflow.
+    *out_value = (int64_t)(is_negative ? 0U - magnitude : magnitude);
+    return AZ_OK;
+  }
+
   az_span token_slice = json_token->slice;
 
   // Contiguous token
@@ -594,6 +858,22 @@ AZ_NODISCARD az_result az_json_token_get_int32(az_json_token const* json_token,
     return AZ_ERROR_JSON_INVALID_STATE;
   }
 
+  // The reader kept the value of integers of up to 19 digits, while validating them.
+  if (json_token->_internal.number_is_integer)
+  {
+    bool const is_negative = json_token->_internal.number_is_negative;
+    uint64_t const magnitude = json_token->_internal.number_magnitude;
+
+    // The absolute value of INT32_MIN is 1 more than the absolute value of INT32_MAX.
+    if (magnitude > (uint64_t)INT32_MAX + (is_negative ? 1U : 0U))
+    {
+      return AZ_ERROR_UNEXPECTED_CHAR;
+    }
+
+    *out_value = is_negative ? (int32_t)(0 - (int64_t)magnitude) : (int32_t)magnitude;
+    return AZ_OK;
+  }
+
   az_span token_slice = json_token->slice;
 
   // Contiguous token
@@ -628,6 +908,16 @@ AZ_NODISCARD az_result az_json_token_get_double(az_json_token const* json_token,
     return AZ_ERROR_JSON_INVALID_STATE;
   }
 
+  // The reader kept the value of integers of up to 19 digits, while validating them, which is exact
+  // as a double up to 2^53.
+  if (json_token->_internal.number_is_integer
+      && json_token->_internal.number_magnitude <= _az_JSON_MAX_EXACT_INTEGER_FOR_DOUBLE)
+  {
+    double const value = (double)json_token->_internal.number_magnitude;
+    *out_value = json_token->_internal.number_is_negative ? -value : value;
+    return AZ_OK;
+  }
+
   az_span token_slice = json_token->slice;
 
   // Contiguous token
@@ -25,6 +25,9 @@ AZ_NODISCARD az_result az_json_writer_init(
       .destination_buffer = destination_buffer,
       .allocator_callback = NULL,
       .user_context = NULL,
+      .destination_list = NULL,
+      .flush_callback = NULL,
+      .flush_result = AZ_OK,
       .bytes_written = 0,
       .need_comma = false,
       .token_kind = AZ_JSON_TOKEN_NONE,
@@ -51,6 +54,9 @@ AZ_NODISCARD az_result az_json_writer_chunked_init(
       .destination_buffer = first_destination_buffer,
       .allocator_callback = allocator_callback,
       .user_context = user_context,
+      .destination_list = NULL,
+      .flush_callback = NULL,
+      .flush_result = AZ_OK,
       .bytes_written = 0,
       .need_comma = false,
       .token_kind = AZ_JSON_TOKEN_NONE,
@@ -61,6 +67,165 @@ AZ_NODISCARD az_result az_json_writer_chunked_init(
   return AZ_OK;
 }
 
+AZ_NODISCARD az_result az_json_writer_span_list_init(
+    az_json_writer* out_json_writer,
+    az_span_list* ref_destination_list,
+    az_json_writer_options const* options)
+{
+  _az_PRECONDITION_NOT_NULL(out_json_writer);
+  _az_PRECONDITION_NOT_NULL(ref_destination_list);
+  _az_PRECONDITION(az_span_list_get_segment_count(*ref_destination_list) >= 1);
+
+  az_span_list* const list = ref_destination_list;
+
+  // From here on, the segment count is the number of buffers written to, and the unused buffers
+  // wait in the storage past it.
+  list->_internal.capacity = list->_internal.segment_count;
+  list->_internal.segment_count = 1;
+  az_span const first_destination_buffer = list->_internal.segments[0];
+  list->_internal.segments[0] = az_span_slice(first_destination_buffer, 0, 0);
+
+  *out_json_writer = (az_json_writer){
+    .total_bytes_written = 0,
+    ._internal = {
+      .destination_buffer = first_destination_buffer,
+      .allocator_callback = NULL,
+      .user_context = NULL,
+      .destination_list = list,
+      .committed_destination_buffer = first_destination_buffer,
+      .committed_bytes_written = 0,
+      .committed_segment_count = 1,
+      .flush_callback = NULL,
+      .flush_result = AZ_OK,
+      .bytes_written = 0,
+      .need_comma = false,
+      .token_kind = AZ_JSON_TOKEN_NONE,
+      .bit_stack = { 0 },
+      .options = options == NULL ? az_json_writer_options_default() : *options,
+    },
+  };
+  return AZ_OK;
+}
+
+// Lets a measuring writer write over its scratch buffer again once it is full.
+static az_result _az_json_writer_discard_chunk(void* user_context, az_span json_text)
+{
+  (void)user_context;
+  (void)json_text;
+  return AZ_OK;
+}
+
+AZ_NODISCARD az_result az_json_writer_measure_init(
+    az_json_writer* out_json_writer,
+    az_span scratch_buffer,
+    az_json_writer_options const* options)
+{
+  return az_json_writer_stream_init(
+      out_json_writer, scratch_buffer, _az_json_writer_discard_chunk, NULL, options);
+}
+
+AZ_NODISCARD az_result az_json_writer_stream_init(
+    az_json_writer* out_json_writer,
+    az_span chunk_buffer,
+    az_json_writer_flush_fn flush_callback,
+    void* user_context,
+    az_json_writer_options const* options)
+{
+  _az_PRECONDITION_NOT_NULL(out_json_writer);
+  _az_PRECONDITION_VALID_SPAN(chunk_buffer, _az_MINIMUM_STRING_CHUNK_SIZE, false);
+  _az_PRECONDITION_NOT_NULL(flush_callback);
+
+  *out_json_writer = (az_json_writer){
+    .total_bytes_written = 0,
+    ._internal = {
+      .destination_buffer = chunk_buffer,
+      .allocator_callback = NULL,
+      .user_context = user_context,
+      .destination_list = NULL,
+      .flush_callback = flush_callback,
+      .flush_result = AZ_OK,
+      .bytes_written = 0,
+      .need_comma = false,
+      .token_kind = AZ_JSON_TOKEN_NONE,
+      .bit_stack = { 0 },
+      .options = options == NULL ? az_json_writer_options_default() : *options,
+    },
+  };
+  return AZ_OK;
+}
+
+AZ_NODISCARD az_result az_json_writer_flush(az_json_writer* ref_json_writer)
+{
+  _az_PRECONDITION_NOT_NULL(ref_json_writer);
+  _az_PRECONDITION_NOT_NULL(ref_json_writer->_internal.flush_callback);
+
+  az_json_writer_flush_fn const flush_callback = ref_json_writer->_internal.flush_callback;
+  _az_RETURN_IF_FAILED(flush_callback(
+      ref_json_writer->_internal.user_context,
+      az_json_writer_get_bytes_used_in_destination(ref_json_writer)));
+  ref_json_writer->_internal.bytes_written = 0;
+  return AZ_OK;
+}
+
+// Moves a span list writer on to the first of the unused buffers that has required_size bytes, and
+// returns it. If there is none, the list goes back to what it was after the last successful append,
+// and AZ_SPAN_EMPTY is returned, to let the caller fail with AZ_ERROR_NOT_ENOUGH_SPACE.
+static AZ_NODISCARD az_span
+_az_json_writer_next_list_buffer(az_json_writer* ref_json_writer, int32_t required_size)
+{
+  az_span_list* const list = ref_json_writer->_internal.destination_list;
+  az_span const current_buffer = ref_json_writer->_internal.destination_buffer;
+  int32_t const bytes_written = ref_json_writer->_internal.bytes_written;
+  int32_t const current = list->_internal.segment_count - 1;
+
+  for (int32_t next = current + 1; next < list->_internal.capacity; next++)
+  {
+    az_span const buffer = list->_internal.segments[next];
+    if (az_span_size(buffer) < required_size)
+    {
+      continue;
+    }
+
+    if (bytes_written == 0)
+    {
+      // Appends write as soon as they move on to a buffer, so only the buffer of the last
+      // successful append can be empty. It goes back with the unused ones, rather than being left
+      // as an empty segment.
+      list->_internal.segments[next] = current_buffer;
+      list->_internal.segments[current] = az_span_slice(buffer, 0, 0);
+      ref_json_writer->_internal.committed_destination_buffer = buffer;
+    }
+    else
+    {
+      // If the buffer isn't the next one, the two swap places, so that the smaller buffer can
+      // still be used later on.
+      list->_internal.segments[current] = az_span_slice(current_buffer, 0, bytes_written);
+      list->_internal.segments[next] = list->_internal.segments[current + 1];
+      list->_internal.segments[current + 1] = az_span_slice(buffer, 0, 0);
+      list->_internal.segment_count++;
+    }
+
+    ref_json_writer->_internal.destination_buffer = buffer;
+    ref_json_writer->_internal.bytes_written = 0;
+    return buffer;
+  }
+
+  // The buffers that the current append moved on to, before the current one, are full (see
+  // _az_json_writer_copy_to_list), so their segments are the whole buffers, as they were before.
+  int32_t const committed = ref_json_writer->_internal.committed_segment_count - 1;
+  list->_internal.segments[current] = current_buffer;
+  list->_internal.segments[committed] = az_span_slice(
+      ref_json_writer->_internal.committed_destination_buffer,
+      0,
+      ref_json_writer->_internal.committed_bytes_written);
+  list->_internal.segment_count = committed + 1;
+
+  ref_json_writer->_internal.destination_buffer
+      = ref_json_writer->_internal.committed_destination_buffer;
+  ref_json_writer->_internal.bytes_written = ref_json_writer->_internal.committed_bytes_written;
+  return AZ_SPAN_EMPTY;
+}
+
 static AZ_NODISCARD az_span
 _get_remaining_span(az_json_writer* ref_json_writer, int32_t required_size)
 {
@@ -87,10 +252,62 @@ _get_remaining_span(az_json_writer* ref_json_writer, int32_t required_size)
     ref_json_writer->_internal.destination_buffer = remaining;
     ref_json_writer->_internal.bytes_written = 0;
   }
+  else if (
+      az_span_size(remaining) < required_size && ref_json_writer->_internal.flush_callback != NULL)
+  {
+    // A buffer with nothing to flush is simply too small for the token.
+    if (ref_json_writer->_internal.bytes_written == 0)
+    {
+      return remaining;
+    }
+
+    // The buffer is only written over once the callback is done with its contents. If it fails,
+    // the append fails with its result (see _az_json_writer_not_enough_space).
+    az_result const flush_result = ref_json_writer->_internal.flush_callback(
+        ref_json_writer->_internal.user_context,
+        az_json_writer_get_bytes_used_in_destination(ref_json_writer));
+    if (az_result_failed(flush_result))
+    {
+      ref_json_writer->_internal.flush_result = flush_result;
+      return AZ_SPAN_EMPTY;
+    }
+    ref_json_writer->_internal.bytes_written = 0;
+    remaining = ref_json_writer->_internal.destination_buffer;
+  }
+  else if (
+      az_span_size(remaining) < required_size
+      && ref_json_writer->_internal.destination_list != NULL)
+  {
+    return _az_json_writer_next_list_buffer(ref_json_writer, required_size);
+  }
 
   return remaining;
 }
 
+// Returns why _get_remaining_span() returned fewer bytes than required: the failure of the flush
+// callback of a streaming writer, or else AZ_ERROR_NOT_ENOUGH_SPACE.
+static AZ_NODISCARD az_result _az_json_writer_not_enough_space(az_json_writer* ref_json_writer)
+{
+  az_result const flush_result = ref_json_writer->_internal.flush_result;
+  if (az_result_failed(flush_result))
+  {
+    ref_json_writer->_internal.flush_result = AZ_OK;
+    return flush_result;
+  }
+
+  return AZ_ERROR_NOT_ENOUGH_SPACE;
+}
+
+#define _az_JSON_WRITER_RETURN_IF_NOT_ENOUGH_SIZE(ref_json_writer, span, required_size) \
+  do                                                                                   \
+  {                                                                                    \
+    int32_t const _az_req_sz = (required_size);                                        \
+    if (az_span_size(span) < _az_req_sz || _az_req_sz < 0)                             \
+    {                                                                                  \
+      return _az_json_writer_not_enough_space(ref_json_writer);                        \
+    }                                                                                  \
+  } while (0)
+
 // This validation method is used outside of just preconditions, within
 // az_json_writer_append_json_text.
 static AZ_NODISCARD bool _az_is_appending_value_valid(az_json_writer const* json_writer)
@@ -215,17 +432,34 @@ static int32_t _az_json_writer_escaped_length(
   int32_t value_size = az_span_size(value);
   _az_PRECONDITION(value_size <= _az_MAX_UNESCAPED_STRING_SIZE);
 
-  int32_t escaped_length = 0;
+  int32_t escaped_length = value_size;
   *out_index_of_first_escaped_char = -1;
 
   int32_t i = 0;
   uint8_t* value_ptr = az_span_ptr(value);
 
-  while (i < value_size)
+  while (true)
   {
-    uint8_t const ch = value_ptr[i];
+    // Skip over the bytes that are copied as is, a vector (or 8 bytes) at a time, to the next one
+    // that needs to be escaped, if any.
+    i += _az_json_string_count_plain_bytes(value_ptr + i, value_size - i);
+    if (i >= value_size)
+    {
+      break;
+    }
+
+    // If this is the first time that we found a character that needs to be escaped,
+    // set out_index_of_first_escaped_char to the corresponding index.
+    if (*out_index_of_first_escaped_char == -1)
+    {
+      *out_index_of_first_escaped_char = i;
+      if (break_on_first_escaped)
+      {
+        break;
+      }
+    }
 
-    switch (ch)
+    switch (value_ptr[i])
     {
       case '\\':
       case '"':
@@ -235,41 +469,21 @@ static int32_t _az_json_writer_escaped_length(
       case '\r':
       case '\t':
       {
-        escaped_length += 2; // Use the two-character sequence escape for these.
+        escaped_length += 1; // Use the two-character sequence escape for these.
         break;
       }
       default:
       {
-        // Check if the character has to be escaped as a UNICODE escape sequence.
-        if (ch < _az_ASCII_SPACE_CHARACTER)
-        {
-          escaped_length += _az_MAX_EXPANSION_FACTOR_WHILE_ESCAPING;
-        }
-        else
-        {
-          escaped_length++; // No escaping required.
-        }
+        // Other control characters are escaped as a UNICODE escape sequence.
+        escaped_length += _az_MAX_EXPANSION_FACTOR_WHILE_ESCAPING - 1;
         break;
       }
     }
 
     i++;
 
-    // If this is the first time that we found a character that needs to be escaped,
-    // set out_index_of_first_escaped_char to the corresponding index.
-    // If escaped_length == i, then we haven't found a character that needs to be escaped yet.
-    if (escaped_length != i && *out_index_of_first_escaped_char == -1)
-    {
-      *out_index_of_first_escaped_char = i - 1;
-      if (break_on_first_escaped)
-      {
-        break;
-      }
-    }
-
     // If the length overflows, in case the precondition is not honored, stop processing and break
     // The caller will return AZ_ERROR_NOT_ENOUGH_SPACE since az_span can't contain it.
-    // TODO: Consider removing this if it is too costly.
     if (escaped_length < 0)
     {
       escaped_length = INT32_MAX;
@@ -375,9 +589,17 @@ static AZ_NODISCARD az_span _az_json_writer_escape_and_copy(az_span destination,
 
   while (i < src_size)
   {
-    uint8_t const ch = value_ptr[i];
-    _az_json_writer_escape_next_byte_and_copy(&remaining_destination, ch);
-    i++;
+    // Bulk copy the run of characters that don't need to be escaped, and escape the one after it.
+    int32_t const plain_size = _az_json_string_count_plain_bytes(value_ptr + i, src_size - i);
+    remaining_destination
+        = az_span_copy(remaining_destination, az_span_create(value_ptr + i, plain_size));
+    i += plain_size;
+
+    if (i < src_size)
+    {
+      _az_json_writer_escape_next_byte_and_copy(&remaining_destination, value_ptr[i]);
+      i++;
+    }
   }
 
   return remaining_destination;
@@ -394,6 +616,66 @@ AZ_INLINE void _az_update_json_writer_state(
   ref_json_writer->total_bytes_written += total_bytes_written;
   ref_json_writer->_internal.need_comma = need_comma;
   ref_json_writer->_internal.token_kind = token_kind;
+
+  // Keep the last segment of the destination list in sync with the text written into it.
+  az_span_list* const list = ref_json_writer->_internal.destination_list;
+  if (list != NULL)
+  {
+    list->_internal.segments[list->_internal.segment_count - 1] = az_span_slice(
+        ref_json_writer->_internal.destination_buffer, 0, ref_json_writer->_internal.bytes_written);
+
+    ref_json_writer->_internal.committed_destination_buffer
+        = ref_json_writer->_internal.destination_buffer;
+    ref_json_writer->_internal.committed_bytes_written = ref_json_writer->_internal.bytes_written;
+    ref_json_writer->_internal.committed_segment_count = list->_internal.segment_count;
+  }
+}
+
+// Copies bytes into a span list writer, filling each of its buffers to the end, so that none of the
+// buffers that an append moves on from is left partly unused.
+static AZ_NODISCARD az_result _az_json_writer_copy_to_list(
+    az_json_writer* ref_json_writer,
+    az_span* remaining_json,
+    az_span bytes)
+{
+  while (az_span_size(bytes) != 0)
+  {
+    if (az_span_size(*remaining_json) == 0)
+    {
+      *remaining_json = _get_remaining_span(ref_json_writer, 1);
+      _az_JSON_WRITER_RETURN_IF_NOT_ENOUGH_SIZE(ref_json_writer, *remaining_json, 1);
+    }
+
+    int32_t const size = az_span_size(bytes) < az_span_size(*remaining_json)
+        ? az_span_size(bytes)
+        : az_span_size(*remaining_json);
+    *remaining_json = az_span_copy(*remaining_json, az_span_slice(bytes, 0, size));
+    ref_json_writer->_internal.bytes_written += size;
+    bytes = az_span_slice_to_end(bytes, size);
+  }
+  return AZ_OK;
+}
+
+// Copies a piece of a token that is written in chunks, such as its quotes or an escape sequence.
+// Writers other than span list ones don't split it, and move on to another buffer unless a whole
+// chunk is left.
+static AZ_NODISCARD az_result _az_json_writer_copy_chunk_piece(
+    az_json_writer* ref_json_writer,
+    az_span* remaining_json,
+    az_span piece)
+{
+  if (ref_json_writer->_internal.destination_list != NULL)
+  {
+    return _az_json_writer_copy_to_list(ref_json_writer, remaining_json, piece);
+  }
+
+  *remaining_json = _get_remaining_span(ref_json_writer, _az_MINIMUM_STRING_CHUNK_SIZE);
+  _az_JSON_WRITER_RETURN_IF_NOT_ENOUGH_SIZE(
+      ref_json_writer, *remaining_json, _az_MINIMUM_STRING_CHUNK_SIZE);
+
+  *remaining_json = az_span_copy(*remaining_json, piece);
+  ref_json_writer->_internal.bytes_written += az_span_size(piece);
+  return AZ_OK;
 }
 
 static AZ_NODISCARD az_result az_json_writer_span_copy_chunked(
@@ -401,6 +683,11 @@ static AZ_NODISCARD az_result az_json_writer_span_copy_chunked(
     az_span* remaining_json,
     az_span value)
 {
+  if (ref_json_writer->_internal.destination_list != NULL)
+  {
+    return _az_json_writer_copy_to_list(ref_json_writer, remaining_json, value);
+  }
+
   if (az_span_size(value) < az_span_size(*remaining_json))
   {
     *remaining_json = az_span_copy(*remaining_json, value);
@@ -422,7 +709,8 @@ static AZ_NODISCARD az_result az_json_writer_span_copy_chunked(
 
       value = az_span_slice_to_end(value, az_span_size(value_slice_that_fits));
       *remaining_json = _get_remaining_span(ref_json_writer, _az_MINIMUM_STRING_CHUNK_SIZE);
-      _az_RETURN_IF_NOT_ENOUGH_SIZE(*remaining_json, _az_MINIMUM_STRING_CHUNK_SIZE);
+      _az_JSON_WRITER_RETURN_IF_NOT_ENOUGH_SIZE(
+          ref_json_writer, *remaining_json, _az_MINIMUM_STRING_CHUNK_SIZE);
     }
   }
   return AZ_OK;
@@ -446,7 +734,7 @@ az_json_writer_append_string_small(az_json_writer* ref_json_writer, az_span valu
   _az_PRECONDITION(required_size <= _az_MINIMUM_STRING_CHUNK_SIZE);
 
   az_span remaining_json = _get_remaining_span(ref_json_writer, required_size);
-  _az_RETURN_IF_NOT_ENOUGH_SIZE(remaining_json, required_size);
+  _az_JSON_WRITER_RETURN_IF_NOT_ENOUGH_SIZE(ref_json_writer, remaining_json, required_size);
 
   if (ref_json_writer->_internal.need_comma)
   {
@@ -482,19 +770,19 @@ az_json_writer_append_string_chunked(az_json_writer* ref_json_writer, az_span va
 {
   _az_PRECONDITION(az_span_size(value) > _az_MAX_UNESCAPED_STRING_SIZE_PER_CHUNK);
 
-  az_span remaining_json = _get_remaining_span(ref_json_writer, _az_MINIMUM_STRING_CHUNK_SIZE);
-  _az_RETURN_IF_NOT_ENOUGH_SIZE(remaining_json, _az_MINIMUM_STRING_CHUNK_SIZE);
+  az_span remaining_json = az_span_slice_to_end(
+      ref_json_writer->_internal.destination_buffer, ref_json_writer->_internal.bytes_written);
 
   int32_t required_size = 2; // For the surrounding quotes.
   if (ref_json_writer->_internal.need_comma)
   {
-    remaining_json = az_span_copy_u8(remaining_json, ',');
     required_size++;
-    ref_json_writer->_internal.bytes_written++;
   }
 
-  remaining_json = az_span_copy_u8(remaining_json, '"');
-  ref_json_writer->_internal.bytes_written++;
+  _az_RETURN_IF_FAILED(_az_json_writer_copy_chunk_piece(
+      ref_json_writer,
+      &remaining_json,
+      ref_json_writer->_internal.need_comma ? AZ_SPAN_FROM_STR(",\"") : AZ_SPAN_FROM_STR("\"")));
 
   int32_t consumed = 0;
   do
@@ -524,11 +812,11 @@ az_json_writer_append_string_chunked(az_json_writer* ref_json_writer, az_span va
       uint8_t* value_ptr = az_span_ptr(value_slice);
       uint8_t const ch = value_ptr[index_of_first_escaped_char];
 
-      remaining_json = _get_remaining_span(ref_json_writer, _az_MINIMUM_STRING_CHUNK_SIZE);
-      _az_RETURN_IF_NOT_ENOUGH_SIZE(remaining_json, _az_MINIMUM_STRING_CHUNK_SIZE);
-
-      int32_t written = _az_json_writer_escape_next_byte_and_copy(&remaining_json, ch);
-      ref_json_writer->_internal.bytes_written += written;
+      uint8_t escaped[_az_MAX_EXPANSION_FACTOR_WHILE_ESCAPING] = { 0 };
+      az_span remaining_escaped = AZ_SPAN_FROM_BUFFER(escaped);
+      int32_t written = _az_json_writer_escape_next_byte_and_copy(&remaining_escaped, ch);
+      _az_RETURN_IF_FAILED(_az_json_writer_copy_chunk_piece(
+          ref_json_writer, &remaining_json, az_span_create(escaped, written)));
 
       // Only account for the difference in the number of bytes written when escaped
       // compared to when the bytes are copied as is.
@@ -538,11 +826,8 @@ az_json_writer_append_string_chunked(az_json_writer* ref_json_writer, az_span va
     }
   } while (consumed < az_span_size(value));
 
-  remaining_json = _get_remaining_span(ref_json_writer, _az_MINIMUM_STRING_CHUNK_SIZE);
-  _az_RETURN_IF_NOT_ENOUGH_SIZE(remaining_json, _az_MINIMUM_STRING_CHUNK_SIZE);
-
-  az_span_copy_u8(remaining_json, '"');
-  ref_json_writer->_internal.bytes_written++;
+  _az_RETURN_IF_FAILED(
+      _az_json_writer_copy_chunk_piece(ref_json_writer, &remaining_json, AZ_SPAN_FROM_STR("\"")));
 
   // Currently, required_size only counts the escaped bytes, so add back the length of the input
   // string (consumed == az_span_size(value));
@@ -587,7 +872,7 @@ az_json_writer_append_property_name_small(az_json_writer* ref_json_writer, az_sp
   _az_PRECONDITION(required_size <= _az_MINIMUM_STRING_CHUNK_SIZE);
 
   az_span remaining_json = _get_remaining_span(ref_json_writer, required_size);
-  _az_RETURN_IF_NOT_ENOUGH_SIZE(remaining_json, required_size);
+  _az_JSON_WRITER_RETURN_IF_NOT_ENOUGH_SIZE(ref_json_writer, remaining_json, required_size);
 
   if (ref_json_writer->_internal.need_comma)
   {
@@ -624,19 +909,19 @@ az_json_writer_append_property_name_chunked(az_json_writer* ref_json_writer, az_
 {
   _az_PRECONDITION(az_span_size(value) > _az_MAX_UNESCAPED_STRING_SIZE_PER_CHUNK);
 
-  az_span remaining_json = _get_remaining_span(ref_json_writer, _az_MINIMUM_STRING_CHUNK_SIZE);
-  _az_RETURN_IF_NOT_ENOUGH_SIZE(remaining_json, _az_MINIMUM_STRING_CHUNK_SIZE);
+  az_span remaining_json = az_span_slice_to_end(
+      ref_json_writer->_internal.destination_buffer, ref_json_writer->_internal.bytes_written);
 
   int32_t required_size = 3; // For the surrounding quotes and the key:value separator colon.
   if (ref_json_writer->_internal.need_comma)
   {
-    remaining_json = az_span_copy_u8(remaining_json, ',');
     required_size++;
-    ref_json_writer->_internal.bytes_written++;
   }
 
-  remaining_json = az_span_copy_u8(remaining_json, '"');
-  ref_json_writer->_internal.bytes_written++;
+  _az_RETURN_IF_FAILED(_az_json_writer_copy_chunk_piece(
+      ref_json_writer,
+      &remaining_json,
+      ref_json_writer->_internal.need_comma ? AZ_SPAN_FROM_STR(",\"") : AZ_SPAN_FROM_STR("\"")));
 
   int32_t consumed = 0;
   do
@@ -666,11 +951,11 @@ az_json_writer_append_property_name_chunked(az_json_writer* ref_json_writer, az_
       uint8_t* value_ptr = az_span_ptr(value_slice);
       uint8_t const ch = value_ptr[index_of_first_escaped_char];
 
-      remaining_json = _get_remaining_span(ref_json_writer, _az_MINIMUM_STRING_CHUNK_SIZE);
-      _az_RETURN_IF_NOT_ENOUGH_SIZE(remaining_json, _az_MINIMUM_STRING_CHUNK_SIZE);
-
-      int32_t written = _az_json_writer_escape_next_byte_and_copy(&remaining_json, ch);
-      ref_json_writer->_internal.bytes_written += written;
+      uint8_t escaped[_az_MAX_EXPANSION_FACTOR_WHILE_ESCAPING] = { 0 };
+      az_span remaining_escaped = AZ_SPAN_FROM_BUFFER(escaped);
+      int32_t written = _az_json_writer_escape_next_byte_and_copy(&remaining_escaped, ch);
+      _az_RETURN_IF_FAILED(_az_json_writer_copy_chunk_piece(
+          ref_json_writer, &remaining_json, az_span_create(escaped, written)));
 
       // Only account for the difference in the number of bytes written when escaped
       // compared to when the bytes are copied as is.
@@ -680,12 +965,8 @@ az_json_writer_append_property_name_chunked(az_json_writer* ref_json_writer, az_
     }
   } while (consumed < az_span_size(value));
 
-  remaining_json = _get_remaining_span(ref_json_writer, _az_MINIMUM_STRING_CHUNK_SIZE);
-  _az_RETURN_IF_NOT_ENOUGH_SIZE(remaining_json, _az_MINIMUM_STRING_CHUNK_SIZE);
-
-  remaining_json = az_span_copy_u8(remaining_json, '"');
-  remaining_json = az_span_copy_u8(remaining_json, ':');
-  ref_json_writer->_internal.bytes_written += 2;
+  _az_RETURN_IF_FAILED(
+      _az_json_writer_copy_chunk_piece(ref_json_writer, &remaining_json, AZ_SPAN_FROM_STR("\":")));
 
   // Currently, required_size only counts the escaped bytes, so add back the length of the input
   // string (consumed == az_span_size(value));
@@ -749,6 +1030,46 @@ static AZ_NODISCARD az_result _az_validate_json(
   return AZ_OK;
 }
 
+// Whether the writer can move on to another buffer when the current one is too small.
+AZ_NODISCARD AZ_INLINE bool _az_json_writer_is_chunked(az_json_writer const* json_writer)
+{
+  return json_writer->_internal.allocator_callback != NULL
+      || json_writer->_internal.destination_list != NULL
+      || json_writer->_internal.flush_callback != NULL;
+}
+
+// Copies json_text as is, after a comma if needed, a chunk at a time so that writers that can move
+// on to another buffer don't need one that can hold all of it. The last token it writes is of
+// last_token_kind.
+static AZ_NODISCARD az_result _az_json_writer_append_raw_chunked(
+    az_json_writer* ref_json_writer,
+    az_span json_text,
+    bool need_comma_after,
+    az_json_token_kind last_token_kind)
+{
+  az_span remaining_json = az_span_slice_to_end(
+      ref_json_writer->_internal.destination_buffer, ref_json_writer->_internal.bytes_written);
+
+  int32_t required_size = az_span_size(json_text);
+  if (ref_json_writer->_internal.need_comma)
+  {
+    required_size++; // For the leading comma separator.
+  }
+
+  _az_RETURN_IF_FAILED(_az_json_writer_copy_chunk_piece(
+      ref_json_writer,
+      &remaining_json,
+      ref_json_writer->_internal.need_comma ? AZ_SPAN_FROM_STR(",") : AZ_SPAN_EMPTY));
+
+  _az_RETURN_IF_FAILED(
+      az_json_writer_span_copy_chunked(ref_json_writer, &remaining_json, json_text));
+
+  // We already tracked and updated bytes_written while writing, so no need to update it here.
+  _az_update_json_writer_state(
+      ref_json_writer, 0, required_size, need_comma_after, last_token_kind);
+  return AZ_OK;
+}
+
 AZ_NODISCARD az_result
 az_json_writer_append_json_text(az_json_writer* ref_json_writer, az_span json_text)
 {
@@ -779,29 +1100,90 @@ az_json_writer_append_json_text(az_json_writer* ref_json_writer, az_span json_te
     return AZ_ERROR_JSON_INVALID_STATE;
   }
 
-  az_span remaining_json = _get_remaining_span(ref_json_writer, _az_MINIMUM_STRING_CHUNK_SIZE);
-  _az_RETURN_IF_NOT_ENOUGH_SIZE(remaining_json, _az_MINIMUM_STRING_CHUNK_SIZE);
+  // We only need to add a comma if the last token we append is a value or end of object/array.
+  // If the last token is a property name or the start of an object/array, we don't need to add a
+  // comma before appending subsequent tokens.
+  // However, there is no valid, complete, single JSON value where the last token would be property
+  // name, or start object/array.
+  // Therefore, need_comma must be true after appending the json_text.
+  return _az_json_writer_append_raw_chunked(ref_json_writer, json_text, true, last_token_kind);
+}
+
+// Finds the kind of the last token of a JSON value from its first and last bytes, without reading
+// the rest of it.
+static AZ_NODISCARD az_result
+_az_json_get_last_token_kind(az_span json_text, az_json_token_kind* out_token_kind)
+{
+  uint8_t const* const ptr = az_span_ptr(json_text);
+  int32_t const size = az_span_size(json_text);
+  uint8_t const first = ptr[0];
+
+  switch (ptr[size - 1])
+  {
+    case '}':
+      *out_token_kind = AZ_JSON_TOKEN_END_OBJECT;
+      return first == '{' ? AZ_OK : AZ_ERROR_UNEXPECTED_CHAR;
+    case ']':
+      *out_token_kind = AZ_JSON_TOKEN_END_ARRAY;
+      return first == '[' ? AZ_OK : AZ_ERROR_UNEXPECTED_CHAR;
+    case '"':
+      *out_token_kind = AZ_JSON_TOKEN_STRING;
+      return first == '"' && size > 1 ? AZ_OK : AZ_ERROR_UNEXPECTED_CHAR;
+    case 'e':
+      *out_token_kind = first == 't' ? AZ_JSON_TOKEN_TRUE : AZ_JSON_TOKEN_FALSE;
+      return first == 't' || first == 'f' ? AZ_OK : AZ_ERROR_UNEXPECTED_CHAR;
+    case 'l':
+      *out_token_kind = AZ_JSON_TOKEN_NULL;
+      return first == 'n' ? AZ_OK : AZ_ERROR_UNEXPECTED_CHAR;
+    default:
+      *out_token_kind = AZ_JSON_TOKEN_NUMBER;
+      return _az_json_byte_is(ptr[size - 1], _az_JSON_BYTE_DIGIT)
+              && _az_json_byte_is(first, _az_JSON_BYTE_NUMBER_START)
+          ? AZ_OK
+          : AZ_ERROR_UNEXPECTED_CHAR;
+  }
+}
+
+AZ_NODISCARD az_result
+az_json_writer_append_json_text_trusted(az_json_writer* ref_json_writer, az_span json_text)
+{
+  _az_PRECONDITION_NOT_NULL(ref_json_writer);
+  // A null or empty span is not allowed since that is invalid JSON.
+  _az_PRECONDITION_VALID_SPAN(json_text, 1, false);
+
+  az_json_token_kind last_token_kind = AZ_JSON_TOKEN_NONE;
+  _az_RETURN_IF_FAILED(_az_json_get_last_token_kind(json_text, &last_token_kind));
+
+  if (!_az_is_appending_value_valid(ref_json_writer))
+  {
+    return AZ_ERROR_JSON_INVALID_STATE;
+  }
+
+  // Writers that can move on to another buffer copy the text in chunks, as for validated text.
+  if (_az_json_writer_is_chunked(ref_json_writer))
+  {
+    return _az_json_writer_append_raw_chunked(ref_json_writer, json_text, true, last_token_kind);
+  }
 
   int32_t required_size = az_span_size(json_text);
+
   if (ref_json_writer->_internal.need_comma)
   {
-    remaining_json = az_span_copy_u8(remaining_json, ',');
-    ref_json_writer->_internal.bytes_written++;
     required_size++; // For the leading comma separator.
   }
 
-  _az_RETURN_IF_FAILED(
-      az_json_writer_span_copy_chunked(ref_json_writer, &remaining_json, json_text));
+  az_span remaining_json = _get_remaining_span(ref_json_writer, required_size);
+  _az_JSON_WRITER_RETURN_IF_NOT_ENOUGH_SIZE(ref_json_writer, remaining_json, required_size);
 
-  // We only need to add a comma if the last token we append is a value or end of object/array.
-  // If the last token is a property name or the start of an object/array, we don't need to add a
-  // comma before appending subsequent tokens.
-  // However, there is no valid, complete, single JSON value where the last token would be property
-  // name, or start object/array.
-  // Therefore, need_comma must be true after appending the json_text.
+  if (ref_json_writer->_internal.need_comma)
+  {
+    remaining_json = az_span_copy_u8(remaining_json, ',');
+  }
 
-  // We already tracked and updated bytes_written while writing, so no need to update it here.
-  _az_update_json_writer_state(ref_json_writer, 0, required_size, true, last_token_kind);
+  az_span_copy(remaining_json, json_text);
+
+  _az_update_json_writer_state(
+      ref_json_writer, required_size, required_size, true, last_token_kind);
   return AZ_OK;
 }
 
@@ -826,7 +1208,7 @@ static AZ_NODISCARD az_result _az_json_writer_append_literal(
   }
 
   az_span remaining_json = _get_remaining_span(ref_json_writer, required_size);
-  _az_RETURN_IF_NOT_ENOUGH_SIZE(remaining_json, required_size);
+  _az_JSON_WRITER_RETURN_IF_NOT_ENOUGH_SIZE(ref_json_writer, remaining_json, required_size);
 
   if (ref_json_writer->_internal.need_comma)
   {
@@ -839,6 +1221,44 @@ static AZ_NODISCARD az_result _az_json_writer_append_literal(
   return AZ_OK;
 }
 
+AZ_NODISCARD az_result
+az_json_writer_append_name(az_json_writer* ref_json_writer, az_json_name name)
+{
+  _az_PRECONDITION_NOT_NULL(ref_json_writer);
+  // An empty name is written as `"":`.
+  _az_PRECONDITION_VALID_SPAN(name._internal.json_text, 3, false);
+  _az_PRECONDITION(_az_is_appending_property_name_valid(ref_json_writer));
+
+  int32_t required_size = az_span_size(name._internal.json_text);
+
+  if (ref_json_writer->_internal.need_comma)
+  {
+    required_size++; // For the leading comma separator.
+  }
+
+  // Writers that can move on to another buffer don't need one that can hold a long name at once.
+  if (required_size > _az_MINIMUM_STRING_CHUNK_SIZE && _az_json_writer_is_chunked(ref_json_writer))
+  {
+    return _az_json_writer_append_raw_chunked(
+        ref_json_writer, name._internal.json_text, false, AZ_JSON_TOKEN_PROPERTY_NAME);
+  }
+
+  az_span remaining_json = _get_remaining_span(ref_json_writer, required_size);
+  _az_JSON_WRITER_RETURN_IF_NOT_ENOUGH_SIZE(ref_json_writer, remaining_json, required_size);
+
+  if (ref_json_writer->_internal.need_comma)
+  {
+    remaining_json = az_span_copy_u8(remaining_json, ',');
+  }
+
+  // The name was quoted, and followed by the separator, at compile time.
+  az_span_copy(remaining_json, name._internal.json_text);
+
+  _az_update_json_writer_state(
+      ref_json_writer, required_size, required_size, false, AZ_JSON_TOKEN_PROPERTY_NAME);
+  return AZ_OK;
+}
+
 AZ_NODISCARD az_result az_json_writer_append_bool(az_json_writer* ref_json_writer, bool value)
 {
   return value ? _az_json_writer_append_literal(
@@ -866,7 +1286,7 @@ AZ_NODISCARD az_result az_json_writer_append_int32(az_json_writer* ref_json_writ
   }
 
   az_span remaining_json = _get_remaining_span(ref_json_writer, required_size);
-  _az_RETURN_IF_NOT_ENOUGH_SIZE(remaining_json, required_size);
+  _az_JSON_WRITER_RETURN_IF_NOT_ENOUGH_SIZE(ref_json_writer, remaining_json, required_size);
 
   if (ref_json_writer->_internal.need_comma)
   {
@@ -887,6 +1307,64 @@ AZ_NODISCARD az_result az_json_writer_append_int32(az_json_writer* ref_json_writ
   return AZ_OK;
 }
 
+AZ_NODISCARD az_result az_json_writer_append_int64(az_json_writer* ref_json_writer, int64_t value)
+{
+  _az_PRECONDITION_NOT_NULL(ref_json_writer);
+  _az_PRECONDITION(_az_is_appending_value_valid(ref_json_writer));
+
+  // Ask for exactly the space the number needs, which is cheap to compute, rather than for the
+  // worst case, so that a value that fits isn't refused near the end of the buffer.
+  int32_t required_size = az_span_i64toa_size(value);
+
+  if (ref_json_writer->_internal.need_comma)
+  {
+    required_size++; // For the leading comma separator.
+  }
+
+  az_span remaining_json = _get_remaining_span(ref_json_writer, required_size);
+  _az_JSON_WRITER_RETURN_IF_NOT_ENOUGH_SIZE(ref_json_writer, remaining_json, required_size);
+
+  if (ref_json_writer->_internal.need_comma)
+  {
+    remaining_json = az_span_copy_u8(remaining_json, ',');
+  }
+
+  az_span leftover;
+  _az_RETURN_IF_FAILED(az_span_i64toa(remaining_json, value, &leftover));
+
+  _az_update_json_writer_state(
+      ref_json_writer, required_size, required_size, true, AZ_JSON_TOKEN_NUMBER);
+  return AZ_OK;
+}
+
+AZ_NODISCARD az_result az_json_writer_append_uint64(az_json_writer* ref_json_writer, uint64_t value)
+{
+  _az_PRECONDITION_NOT_NULL(ref_json_writer);
+  _az_PRECONDITION(_az_is_appending_value_valid(ref_json_writer));
+
+  int32_t required_size = az_span_u64toa_size(value);
+
+  if (ref_json_writer->_internal.need_comma)
+  {
+    required_size++; // For the leading comma separator.
+  }
+
+  az_span remaining_json = _get_remaining_span(ref_json_writer, required_size);
+  _az_JSON_WRITER_RETURN_IF_NOT_ENOUGH_SIZE(ref_json_writer, remaining_json, required_size);
+
+  if (ref_json_writer->_internal.need_comma)
+  {
+    remaining_json = az_span_copy_u8(remaining_json, ',');
+  }
+
+  az_span leftover;
+  _az_RETURN_IF_FAILED(az_span_u64toa(remaining_json, value, &leftover));
+
+  _az_update_json_writer_state(
+      ref_json_writer, required_size, required_size, true, AZ_JSON_TOKEN_NUMBER);
+  return AZ_OK;
+}
+
 AZ_NODISCARD az_result az_json_writer_append_double(
     az_json_writer* ref_json_writer,
     double value,
@@ -908,7 +1386,7 @@ AZ_NODISCARD az_result az_json_writer_append_double(
   }
 
   az_span remaining_json = _get_remaining_span(ref_json_writer, required_size);
-  _az_RETURN_IF_NOT_ENOUGH_SIZE(remaining_json, required_size);
+  _az_JSON_WRITER_RETURN_IF_NOT_ENOUGH_SIZE(ref_json_writer, remaining_json, required_size);
 
   if (ref_json_writer->_internal.need_comma)
   {
@@ -929,6 +1407,45 @@ AZ_NODISCARD az_result az_json_writer_append_double(
   return AZ_OK;
 }
 
+AZ_NODISCARD az_result
+az_json_writer_append_double_shortest(az_json_writer* ref_json_writer, double value)
+{
+  _az_PRECONDITION_NOT_NULL(ref_json_writer);
+  _az_PRECONDITION(_az_is_appending_value_valid(ref_json_writer));
+  // Non-finite numbers are not supported because they lead to invalid JSON.
+  // Unquoted strings such as nan and -inf are invalid as JSON numbers.
+  _az_PRECONDITION(_az_isfinite(value));
+
+  // Need enough space to write any double number.
+  int32_t required_size = _az_MAX_SIZE_FOR_WRITING_SHORTEST_DOUBLE;
+
+  if (ref_json_writer->_internal.need_comma)
+  {
+    required_size++; // For the leading comma separator.
+  }
+
+  az_span remaining_json = _get_remaining_span(ref_json_writer, required_size);
+  _az_JSON_WRITER_RETURN_IF_NOT_ENOUGH_SIZE(ref_json_writer, remaining_json, required_size);
+
+  if (ref_json_writer->_internal.need_comma)
+  {
+    remaining_json = az_span_copy_u8(remaining_json, ',');
+  }
+
+  // Since we asked for the maximum needed space above, this is guaranteed not to fail due to
+  // AZ_ERROR_NOT_ENOUGH_SPACE. Still checking the returned az_result, for other potential failure
+  // cases.
+  az_span leftover;
+  _az_RETURN_IF_FAILED(az_span_dtoa_shortest(remaining_json, value, &leftover));
+
+  // We already accounted for the maximum size needed in required_size, so subtract that to get the
+  // actual bytes written.
+  int32_t written = required_size + _az_span_diff(leftover, remaining_json)
+      - _az_MAX_SIZE_FOR_WRITING_SHORTEST_DOUBLE;
+  _az_update_json_writer_state(ref_json_writer, written, written, true, AZ_JSON_TOKEN_NUMBER);
+  return AZ_OK;
+}
+
 static AZ_NODISCARD az_result _az_json_writer_append_container_start(
     az_json_writer* ref_json_writer,
     uint8_t byte,
@@ -954,7 +1471,7 @@ static AZ_NODISCARD az_result _az_json_writer_append_container_start(
   }
 
   az_span remaining_json = _get_remaining_span(ref_json_writer, required_size);
-  _az_RETURN_IF_NOT_ENOUGH_SIZE(remaining_json, required_size);
+  _az_JSON_WRITER_RETURN_IF_NOT_ENOUGH_SIZE(ref_json_writer, remaining_json, required_size);
 
   if (ref_json_writer->_internal.need_comma)
   {
@@ -1000,7 +1517,7 @@ static AZ_NODISCARD az_result az_json_writer_append_container_end(
   int32_t required_size = 1; // For the end object or array byte.
 
   az_span remaining_json = _get_remaining_span(ref_json_writer, required_size);
-  _az_RETURN_IF_NOT_ENOUGH_SIZE(remaining_json, required_size);
+  _az_JSON_WRITER_RETURN_IF_NOT_ENOUGH_SIZE(ref_json_writer, remaining_json, required_size);
 
   az_span_copy_u8(remaining_json, byte);
 
@@ -0,0 +1,425 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ *
+ * @brief Defines private helpers used by the vectorized (SIMD) code paths in core.
+ *
+ * @details The vectorized code paths are opt-in and selected at build time. Define `AZ_SIMD` (or
+ * use the `SIMD` CMake option) to enable them. The instruction set is picked from the target the
+ * compiler is building for:
+ *  - AVX2 when `__AVX2__` is defined (i.e. `-mavx2` or `/arch:AVX2`),
+ *  - SSE2 on any x86-64 target (or when `__SSE2__` is defined),
+ *  - NEON when `__ARM_NEON` is defined.
+ *
+ * When `AZ_SIMD` is not defined, or the target has none of the above, `_az_SIMD_WIDTH` is not
+ * defined and the portable scalar implementations are used instead.
+ *
+ * @note You MUST NOT use any symbols (macros, functions, structures, enums, etc.)
+ * prefixed with an underscore ('_') directly in your application code. These symbols
+ * are part of Azure SDK's internal implementation; we do not document these symbols
+ * and they are subject to change in future versions of the SDK which would break your code.
+ */
+
+#ifndef _az_SIMD_PRIVATE_H
+#define _az_SIMD_PRIVATE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <string.h>
+
+#ifdef AZ_SIMD
+#if defined(__AVX2__)
+#define _az_SIMD_AVX2
+#define _az_SIMD_WIDTH 32
+#include <immintrin.h>
+#elif defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define _az_SIMD_SSE2
+#define _az_SIMD_WIDTH 16
+#include <emmintrin.h>
+#elif defined(__ARM_NEON) || defined(__ARM_NEON__)
+#define _az_SIMD_NEON
+#define _az_SIMD_WIDTH 16
+#include <arm_neon.h>
+#endif
+#endif // AZ_SIMD
+
+#ifdef _MSC_VER
+#include <intrin.h>
+#endif // _MSC_VER
+
+#include <azure/core/_az_cfg_prefix.h>
+
+/**
+ * @brief Returns the index of the least significant set bit in \p value.
+ *
+ * @param value A non-zero value.
+ */
+AZ_NODISCARD AZ_INLINE int32_t _az_ctz64(uint64_t value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+  return (int32_t)__builtin_ctzll(value);
+#elif defined(_MSC_VER) && defined(_M_X64)
+  unsigned long index = 0;
+  (void)_BitScanForward64(&index, value);
+  return (int32_t)index;
+#else
+  int32_t index = 0;
+  while ((value & 1U) == 0)
+  {
+    value >>= 1U;
+    index++;
+  }
+  return index;
+#endif
+}
+
+/**
+ * @brief Returns the number of leading zero bits in \p value.
+ *
+ * @param value A non-zero value.
+ */
+AZ_NODISCARD AZ_INLINE int32_t _az_clz64(uint64_t value)
+{
+#if defined(__GNUC__) || defined(__clang__)
+  return (int32_t)__builtin_clzll(value);
+#elif defined(_MSC_VER) && defined(_M_X64)
+  unsigned long index = 0;
+  (void)_BitScanReverse64(&index, value);
+  return 63 - (int32_t)index;
+#else
+  int32_t count = 0;
+  while ((value & 0x8000000000000000ULL) == 0)
+  {
+    value <<= 1U;
+    count++;
+  }
+  return count;
+#endif
+}
+
+// Repeats the byte \p value in every byte of a 64-bit word.
+#define _az_SWAR_REPEAT(value) (0x0101010101010101ULL * (uint64_t)(uint8_t)(value))
+
+/**
+ * @brief Loads 8 bytes from \p ptr, which does not need to be aligned, into a word.
+ *
+ * @details The SWAR ("SIMD within a register") helpers below operate on each byte of the word
+ * independently, so the result does not depend on the endianness of the platform.
+ */
+AZ_NODISCARD AZ_INLINE uint64_t _az_swar_load(uint8_t const* ptr)
+{
+  uint64_t word = 0;
+  // NOLINTNEXTLINE(clang-analyzer-security.insecureAPI.DeprecatedOrUnsafeBufferHandling)
+  memcpy(&word, ptr, sizeof(word));
+  return word;
+}
+
+/**
+ * @brief Loads 8 bytes from \p ptr, which does not need to be aligned, into a word whose least
+ * significant byte is `ptr[0]`, regardless of the endianness of the platform.
+ */
+AZ_NODISCARD AZ_INLINE uint64_t _az_swar_load_little_endian(uint8_t const* ptr)
+{
+#if defined(__BYTE_ORDER__) && defined(__ORDER_BIG_ENDIAN__) \
+    && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+  return __builtin_bswap64(_az_swar_load(ptr));
+#else
+  return _az_swar_load(ptr);
+#endif
+}
+
+/**
+ * @brief Returns `true` if every byte of \p word is an ASCII decimal digit ('0' to '9').
+ */
+AZ_NODISCARD AZ_INLINE bool _az_swar_is_all_digits(uint64_t word)
+{
+  // Each byte must have 3 as its high nibble, and must still have it after adding 6, which only
+  // carries out of the low nibble when it is above 9. A carry into the next byte can only come from
+  // a byte that already fails the first check.
+  return ((word & _az_SWAR_REPEAT(0xF0))
+          | (((word + _az_SWAR_REPEAT(0x06)) & _az_SWAR_REPEAT(0xF0)) >> 4U))
+      == _az_SWAR_REPEAT(0x33);
+}
+
+/**
+ * @brief Converts 8 ASCII decimal digits, loaded with _az_swar_load_little_endian() so that the
+ * most significant digit is in the least significant byte, into their value (0 to 99999999).
+ *
+ * @param word A word for which _az_swar_is_all_digits() returns `true`.
+ */
+AZ_NODISCARD AZ_INLINE uint32_t _az_swar_parse_8_digits(uint64_t word)
+{
+  // Combine adjacent digits into pairs, then pairs into groups of 4, then the two groups, each step
+  // multiplying the more significant (lower addressed) half by 10, 100 and 10000 respectively.
+  word = ((word & _az_SWAR_REPEAT(0x0F)) * ((10U << 8U) + 1U)) >> 8U;
+  word = ((word & 0x00FF00FF00FF00FFULL) * ((100U << 16U) + 1U)) >> 16U;
+  return (uint32_t)(((word & 0x0000FFFF0000FFFFULL) * ((10000ULL << 32U) + 1U)) >> 32U);
+}
+
+/**
+ * @brief Returns `true` if any byte of \p word is less than \p bound, which must be at most 0x80.
+ *
+ * @details Only the overall result is exact: a borrow can flag bytes past the first match.
+ */
+AZ_NODISCARD AZ_INLINE bool _az_swar_has_less_than(uint64_t word, uint8_t bound)
+{
+  return ((word - _az_SWAR_REPEAT(bound)) & ~word & _az_SWAR_REPEAT(0x80)) != 0;
+}
+
+/**
+ * @brief Returns `true` if any byte of \p word is equal to \p value.
+ */
+AZ_NODISCARD AZ_INLINE bool _az_swar_has_byte(uint64_t word, uint8_t value)
+{
+  return _az_swar_has_less_than(word ^ _az_SWAR_REPEAT(value), 1);
+}
+
+/**
+ * @brief Returns a word with the high bit set in each byte of \p word that is equal to \p value,
+ * and every other bit clear.
+ *
+ * @details Unlike _az_swar_has_byte(), the result is exact for every byte, so the first match can
+ * be located with _az_ctz64() in a word loaded with _az_swar_load_little_endian().
+ */
+AZ_NODISCARD AZ_INLINE uint64_t _az_swar_byte_mask(uint64_t word, uint8_t value)
+{
+  uint64_t const difference = word ^ _az_SWAR_REPEAT(value);
+
+  // Adding 0x7F to the low 7 bits of a byte sets its high bit unless they are all zero, and never
+  // carries into the next byte.
+  return ~(((difference & _az_SWAR_REPEAT(0x7F)) + _az_SWAR_REPEAT(0x7F)) | difference)
+      & _az_SWAR_REPEAT(0x80);
+}
+
+/**
+ * @brief Converts every ASCII upper case letter ('A' to 'Z') within \p word to lower case, leaving
+ * every other byte (including non-ASCII bytes) unchanged.
+ */
+AZ_NODISCARD AZ_INLINE uint64_t _az_swar_to_lower(uint64_t word)
+{
+  uint64_t const low_bits = word & _az_SWAR_REPEAT(0x7F);
+
+  // The high bit of each byte is set if the low 7 bits are >= 'A', or > 'Z', respectively.
+  // None of these additions carry into the next byte.
+  uint64_t const at_least_a = low_bits + _az_SWAR_REPEAT(0x80 - 'A');
+  uint64_t const above_z = low_bits + _az_SWAR_REPEAT(0x80 - 'Z' - 1);
+
+  // Bytes with their own high bit set are not ASCII, so they are excluded.
+  uint64_t const is_upper = at_least_a & ~above_z & ~word & _az_SWAR_REPEAT(0x80);
+
+  // Move the high bit of each upper case letter down to the 0x20 bit.
+  return word | (is_upper >> 2U);
+}
+
+#ifdef _az_SIMD_WIDTH
+
+#if defined(_az_SIMD_AVX2)
+typedef __m256i _az_simd_vector;
+#elif defined(_az_SIMD_SSE2)
+typedef __m128i _az_simd_vector;
+#elif defined(_az_SIMD_NEON)
+typedef uint8x16_t _az_simd_vector;
+#endif
+
+/**
+ * @brief Loads #_az_SIMD_WIDTH bytes from \p ptr, which does not need to be aligned.
+ */
+AZ_NODISCARD AZ_INLINE _az_simd_vector _az_simd_load(uint8_t const* ptr)
+{
+#if defined(_az_SIMD_AVX2)
+  return _mm256_loadu_si256((__m256i const*)(void const*)ptr);
+#elif defined(_az_SIMD_SSE2)
+  return _mm_loadu_si128((__m128i const*)(void const*)ptr);
+#elif defined(_az_SIMD_NEON)
+  return vld1q_u8(ptr);
+#endif
+}
+
+/**
+ * @brief Returns a vector with every lane set to \p value.
+ */
+AZ_NODISCARD AZ_INLINE _az_simd_vector _az_simd_broadcast(uint8_t value)
+{
+#if defined(_az_SIMD_AVX2)
+  return _mm256_set1_epi8((char)value);
+#elif defined(_az_SIMD_SSE2)
+  return _mm_set1_epi8((char)value);
+#elif defined(_az_SIMD_NEON)
+  return vdupq_n_u8(value);
+#endif
+}
+
+/**
+ * @brief Lane-wise equality; each lane is set to all ones where \p a and \p b are equal.
+ */
+AZ_NODISCARD AZ_INLINE _az_simd_vector _az_simd_eq(_az_simd_vector a, _az_simd_vector b)
+{
+#if defined(_az_SIMD_AVX2)
+  return _mm256_cmpeq_epi8(a, b);
+#elif defined(_az_SIMD_SSE2)
+  return _mm_cmpeq_epi8(a, b);
+#elif defined(_az_SIMD_NEON)
+  return vceqq_u8(a, b);
+#endif
+}
+
+/**
+ * @brief Lane-wise bitwise and.
+ */
+AZ_NODISCARD AZ_INLINE _az_simd_vector _az_simd_and(_az_simd_vector a, _az_simd_vector b)
+{
+#if defined(_az_SIMD_AVX2)
+  return _mm256_and_si256(a, b);
+#elif defined(_az_SIMD_SSE2)
+  return _mm_and_si128(a, b);
+#elif defined(_az_SIMD_NEON)
+  return vandq_u8(a, b);
+#endif
+}
+
+/**
+ * @brief Lane-wise bitwise or.
+ */
+AZ_NODISCARD AZ_INLINE _az_simd_vector _az_simd_or(_az_simd_vector a, _az_simd_vector b)
+{
+#if defined(_az_SIMD_AVX2)
+  return _mm256_or_si256(a, b);
+#elif defined(_az_SIMD_SSE2)
+  return _mm_or_si128(a, b);
+#elif defined(_az_SIMD_NEON)
+  return vorrq_u8(a, b);
+#endif
+}
+
+/**
+ * @brief Lane-wise range check; each lane is set to all ones where \p value is between \p low and
+ * \p high (inclusive).
+ *
+ * @details \p low and \p high must be between 0x01 and 0x7E. Non-ASCII bytes are then never in
+ * range, which lets x86 use signed comparisons.
+ */
+AZ_NODISCARD AZ_INLINE _az_simd_vector
+_az_simd_in_range(_az_simd_vector value, uint8_t low, uint8_t high)
+{
+#if defined(_az_SIMD_AVX2)
+  return _mm256_and_si256(
+      _mm256_cmpgt_epi8(value, _mm256_set1_epi8((char)(low - 1))),
+      _mm256_cmpgt_epi8(_mm256_set1_epi8((char)(high + 1)), value));
+#elif defined(_az_SIMD_SSE2)
+  return _mm_and_si128(
+      _mm_cmpgt_epi8(value, _mm_set1_epi8((char)(low - 1))),
+      _mm_cmplt_epi8(value, _mm_set1_epi8((char)(high + 1))));
+#elif defined(_az_SIMD_NEON)
+  return vandq_u8(vcgeq_u8(value, vdupq_n_u8(low)), vcleq_u8(value, vdupq_n_u8(high)));
+#endif
+}
+
+/**
+ * @brief Lane-wise unsigned comparison; each lane is set to all ones where \p value is less than
+ * \p bound.
+ */
+AZ_NODISCARD AZ_INLINE _az_simd_vector _az_simd_less_than(_az_simd_vector value, uint8_t bound)
+{
+#if defined(_az_SIMD_AVX2)
+  // x86 has no unsigned comparison: value < bound exactly when min(value, bound - 1) == value.
+  return _mm256_cmpeq_epi8(_mm256_min_epu8(value, _mm256_set1_epi8((char)(bound - 1))), value);
+#elif defined(_az_SIMD_SSE2)
+  return _mm_cmpeq_epi8(_mm_min_epu8(value, _mm_set1_epi8((char)(bound - 1))), value);
+#elif defined(_az_SIMD_NEON)
+  return vcltq_u8(value, vdupq_n_u8(bound));
+#endif
+}
+
+/**
+ * @brief Converts every ASCII upper case letter ('A' to 'Z') within \p value to lower case,
+ * leaving every other lane (including non-ASCII bytes) unchanged.
+ */
+AZ_NODISCARD AZ_INLINE _az_simd_vector _az_simd_to_lower(_az_simd_vector value)
+{
+#if defined(_az_SIMD_AVX2)
+  // Signed comparisons: non-ASCII bytes are negative, so they are never in range.
+  __m256i const is_upper = _mm256_and_si256(
+      _mm256_cmpgt_epi8(value, _mm256_set1_epi8('A' - 1)),
+      _mm256_cmpgt_epi8(_mm256_set1_epi8('Z' + 1), value));
+  return _mm256_or_si256(value, _mm256_and_si256(is_upper, _mm256_set1_epi8(0x20)));
+#elif defined(_az_SIMD_SSE2)
+  // Signed comparisons: non-ASCII bytes are negative, so they are never in range.
+  __m128i const is_upper = _mm_and_si128(
+      _mm_cmpgt_epi8(value, _mm_set1_epi8('A' - 1)), _mm_cmplt_epi8(value, _mm_set1_epi8('Z' + 1)));
+  return _mm_or_si128(value, _mm_and_si128(is_upper, _mm_set1_epi8(0x20)));
+#elif defined(_az_SIMD_NEON)
+  uint8x16_t const is_upper
+      = vandq_u8(vcgeq_u8(value, vdupq_n_u8('A')), vcleq_u8(value, vdupq_n_u8('Z')));
+  return vorrq_u8(value, vandq_u8(is_upper, vdupq_n_u8(0x20)));
+#endif
+}
+
+/**
+ * @brief Number of mask bits produced by #_az_simd_mask for each lane.
+ *
+ * @details x86 produces one bit per lane with `movemask`. NEON has no `movemask`, so a narrowing
+ * shift is used instead, which produces four bits per lane.
+ */
+#if defined(_az_SIMD_NEON)
+#define _az_SIMD_MASK_BITS_PER_LANE 4
+#else
+#define _az_SIMD_MASK_BITS_PER_LANE 1
+#endif
+
+/**
+ * @brief Collapses a comparison result (lanes that are either all zeros or all ones) into an
+ * integer bit mask, with the lowest bits corresponding to the lowest addressed lane.
+ *
+ * @details Use #_az_simd_mask_first_lane to convert a non-zero mask into a lane index.
+ */
+AZ_NODISCARD AZ_INLINE uint64_t _az_simd_mask(_az_simd_vector compare_result)
+{
+#if defined(_az_SIMD_AVX2)
+  return (uint64_t)(uint32_t)_mm256_movemask_epi8(compare_result);
+#elif defined(_az_SIMD_SSE2)
+  return (uint64_t)(uint32_t)_mm_movemask_epi8(compare_result);
+#elif defined(_az_SIMD_NEON)
+  uint8x8_t const narrowed = vshrn_n_u16(vreinterpretq_u16_u8(compare_result), 4);
+  return vget_lane_u64(vreinterpret_u64_u8(narrowed), 0);
+#endif
+}
+
+/**
+ * @brief The value returned by #_az_simd_mask when every lane is set.
+ */
+#if defined(_az_SIMD_AVX2)
+#define _az_SIMD_MASK_ALL 0xFFFFFFFFULL
+#elif defined(_az_SIMD_SSE2)
+#define _az_SIMD_MASK_ALL 0xFFFFULL
+#elif defined(_az_SIMD_NEON)
+#define _az_SIMD_MASK_ALL 0xFFFFFFFFFFFFFFFFULL
+#endif
+
+/**
+ * @brief Returns the index of the first lane set in a non-zero \p mask.
+ */
+AZ_NODISCARD AZ_INLINE int32_t _az_simd_mask_first_lane(uint64_t mask)
+{
+  return _az_ctz64(mask) / _az_SIMD_MASK_BITS_PER_LANE;
+}
+
+/**
+ * @brief Clears the bits of the first lane set in a non-zero \p mask.
+ */
+AZ_NODISCARD AZ_INLINE uint64_t _az_simd_mask_clear_first_lane(uint64_t mask)
+{
+#if defined(_az_SIMD_NEON)
+  int32_t const lane_bit = _az_simd_mask_first_lane(mask) * _az_SIMD_MASK_BITS_PER_LANE;
+  return mask & ~((uint64_t)0xFU << (uint32_t)lane_bit);
+#else
+  return mask & (mask - 1);
+#endif
+}
+
+#endif // _az_SIMD_WIDTH
+
+#include <azure/core/_az_cfg_suffix.h>
+
+#endif // _az_SIMD_PRIVATE_H
@@ -2,6 +2,7 @@
 // SPDX-License-Identifier: MIT
 
 #include "az_hex_private.h"
+#include "az_simd_private.h"
 #include "az_span_private.h"
 #include <azure/core/az_precondition.h>
 #include <azure/core/az_span.h>
@@ -9,11 +10,10 @@
 #include <azure/core/internal/az_result_internal.h>
 #include <azure/core/internal/az_span_internal.h>
 
-#include <ctype.h>
+#include <float.h>
 #include <math.h>
 #include <stdbool.h>
 #include <stdint.h>
-#include <stdio.h>
 
 #include <azure/core/_az_cfg.h>
 
@@ -90,9 +90,37 @@ AZ_NODISCARD bool az_span_is_content_equal_ignoring_case(az_span span1, az_span
   {
     return false;
   }
-  for (int32_t i = 0; i < size; ++i)
+
+  uint8_t const* ptr1 = az_span_ptr(span1);
+  uint8_t const* ptr2 = az_span_ptr(span2);
+  int32_t i = 0;
+
+#ifdef _az_SIMD_WIDTH
+  for (; i + _az_SIMD_WIDTH <= size; i += _az_SIMD_WIDTH)
+  {
+    _az_simd_vector const lower1 = _az_simd_to_lower(_az_simd_load(ptr1 + i));
+    _az_simd_vector const lower2 = _az_simd_to_lower(_az_simd_load(ptr2 + i));
+    if (_az_simd_mask(_az_simd_eq(lower1, lower2)) != _az_SIMD_MASK_ALL)
+    {
+      return false;
+    }
+  }
+#endif // _az_SIMD_WIDTH
+
+  // Compare 8 bytes at a time, only case folding when the bytes aren't already identical.
+  for (; i + (int32_t)sizeof(uint64_t) <= size; i += (int32_t)sizeof(uint64_t))
+  {
+    uint64_t const word1 = _az_swar_load(ptr1 + i);
+    uint64_t const word2 = _az_swar_load(ptr2 + i);
+    if (word1 != word2 && _az_swar_to_lower(word1) != _az_swar_to_lower(word2))
+    {
+      return false;
+    }
+  }
+
+  for (; i < size; ++i)
   {
-    if (_az_tolower(az_span_ptr(span1)[i]) != _az_tolower(az_span_ptr(span2)[i]))
+    if (_az_tolower(ptr1[i]) != _az_tolower(ptr2[i]))
     {
       return false;
     }
@@ -100,64 +128,91 @@ AZ_NODISCARD bool az_span_is_content_equal_ignoring_case(az_span span1, az_span
   return true;
 }
 
-AZ_NODISCARD az_result az_span_atou64(az_span source, uint64_t* out_number)
+AZ_NODISCARD AZ_INLINE bool _az_is_decimal_digit(uint8_t value)
 {
-  _az_PRECONDITION_VALID_SPAN(source, 1, false);
-  _az_PRECONDITION_NOT_NULL(out_number);
+  return value >= '0' && value <= '9';
+}
 
-  int32_t const span_size = az_span_size(source);
+enum
+{
+  // UINT64_MAX has 20 digits, so any number with up to 19 digits fits in a uint64_t.
+  _az_MAX_DIGITS_FOR_UINT64 = 20,
+  _az_SWAR_DIGITS = 8,
+};
 
-  if (span_size < 1)
+// Parses the non-empty run of decimal digits [ptr, ptr + size) as a uint64_t. Any other byte, or a
+// value larger than UINT64_MAX, fails with AZ_ERROR_UNEXPECTED_CHAR.
+static AZ_NODISCARD az_result
+_az_span_parse_digits(uint8_t const* ptr, int32_t size, uint64_t* out_value)
+{
+  // Leading zeros don't count towards the number of digits.
+  int32_t i = 0;
+  while (i < size - 1 && ptr[i] == '0')
+  {
+    i++;
+  }
+
+  int32_t const digits = size - i;
+  if (digits > _az_MAX_DIGITS_FOR_UINT64)
   {
     return AZ_ERROR_UNEXPECTED_CHAR;
   }
 
-  // If the first character is not a digit or an optional + sign, return error.
-  int32_t starting_index = 0;
-  uint8_t* source_ptr = az_span_ptr(source);
-  uint8_t next_byte = source_ptr[0];
+  // The last digit of a 20 digit number is handled separately, since it is the only one that can
+  // overflow, which means that the loops below never need to check for overflow.
+  int32_t const end = digits == _az_MAX_DIGITS_FOR_UINT64 ? size - 1 : size;
+  uint64_t value = 0;
 
-  if (!isdigit(next_byte))
+  for (; i + _az_SWAR_DIGITS <= end; i += _az_SWAR_DIGITS)
   {
-    // There must be another byte after a sign.
-    // The loop below checks that it must be a digit.
-    if (next_byte != '+' || span_size < 2)
+    uint64_t const word = _az_swar_load_little_endian(ptr + i);
+    if (!_az_swar_is_all_digits(word))
     {
       return AZ_ERROR_UNEXPECTED_CHAR;
     }
-    starting_index++;
+    value = value * 100000000U + _az_swar_parse_8_digits(word);
   }
 
-  uint64_t value = 0;
+  for (; i < end; ++i)
+  {
+    uint8_t const next_byte = ptr[i];
+    if (!_az_is_decimal_digit(next_byte))
+    {
+      return AZ_ERROR_UNEXPECTED_CHAR;
+    }
+    value = value * _az_NUMBER_OF_DECIMAL_VALUES + (uint64_t)(next_byte - '0');
+  }
 
-  for (int32_t i = starting_index; i < span_size; ++i)
+  if (end != size)
   {
-    next_byte = source_ptr[i];
-    if (!isdigit(next_byte))
+    uint8_t const next_byte = ptr[end];
+    if (!_az_is_decimal_digit(next_byte))
     {
       return AZ_ERROR_UNEXPECTED_CHAR;
     }
     uint64_t const d = (uint64_t)next_byte - '0';
 
-    // Check whether the next digit will cause an integer overflow.
+    // Check whether the last digit will cause an integer overflow.
     // Before actually doing the math below, this is checking whether value * 10 + d > UINT64_MAX.
     if ((UINT64_MAX - d) / _az_NUMBER_OF_DECIMAL_VALUES < value)
     {
       return AZ_ERROR_UNEXPECTED_CHAR;
     }
-
     value = value * _az_NUMBER_OF_DECIMAL_VALUES + d;
   }
 
-  *out_number = value;
+  *out_value = value;
   return AZ_OK;
 }
 
-AZ_NODISCARD az_result az_span_atou32(az_span source, uint32_t* out_number)
+// Parses an optional sign followed by at least one decimal digit, as the integer parsing functions
+// accept it. The sign is only accepted if it is '+', or if it is '-' and allow_negative is true.
+static AZ_NODISCARD az_result _az_span_parse_signed_digits(
+    az_span source,
+    bool allow_negative,
+    bool* out_is_negative,
+    uint64_t* out_value)
 {
-  _az_PRECONDITION_VALID_SPAN(source, 1, false);
-  _az_PRECONDITION_NOT_NULL(out_number);
-
   int32_t const span_size = az_span_size(source);
 
   if (span_size < 1)
@@ -165,248 +220,826 @@ AZ_NODISCARD az_result az_span_atou32(az_span source, uint32_t* out_number)
     return AZ_ERROR_UNEXPECTED_CHAR;
   }
 
-  // If the first character is not a digit or an optional + sign, return error.
+  // If the first character is not a digit or an allowed sign, return error.
   int32_t starting_index = 0;
-  uint8_t* source_ptr = az_span_ptr(source);
-  uint8_t next_byte = source_ptr[0];
+  uint8_t const* source_ptr = az_span_ptr(source);
+  uint8_t const next_byte = source_ptr[0];
+  *out_is_negative = false;
 
-  if (!isdigit(next_byte))
+  if (!_az_is_decimal_digit(next_byte))
   {
-    // There must be another byte after a sign.
-    // The loop below checks that it must be a digit.
-    if (next_byte != '+' || span_size < 2)
+    if (next_byte == '-' && allow_negative)
     {
-      return AZ_ERROR_UNEXPECTED_CHAR;
+      *out_is_negative = true;
     }
-    starting_index++;
-  }
-
-  uint32_t value = 0;
-
-  for (int32_t i = starting_index; i < span_size; ++i)
-  {
-    next_byte = source_ptr[i];
-    if (!isdigit(next_byte))
+    else if (next_byte != '+')
     {
       return AZ_ERROR_UNEXPECTED_CHAR;
     }
-    uint32_t const d = (uint32_t)next_byte - '0';
 
-    // Check whether the next digit will cause an integer overflow.
-    // Before actually doing the math below, this is checking whether value * 10 + d > UINT32_MAX.
-    if ((UINT32_MAX - d) / _az_NUMBER_OF_DECIMAL_VALUES < value)
+    // There must be another byte after a sign, which _az_span_parse_digits checks is a digit.
+    if (span_size < 2)
     {
       return AZ_ERROR_UNEXPECTED_CHAR;
     }
-
-    value = value * _az_NUMBER_OF_DECIMAL_VALUES + d;
+    starting_index++;
   }
 
+  return _az_span_parse_digits(
+      source_ptr + starting_index, span_size - starting_index, out_value);
+}
+
+AZ_NODISCARD az_result az_span_atou64(az_span source, uint64_t* out_number)
+{
+  _az_PRECONDITION_VALID_SPAN(source, 1, false);
+  _az_PRECONDITION_NOT_NULL(out_number);
+
+  bool is_negative = false;
+  uint64_t value = 0;
+  _az_RETURN_IF_FAILED(_az_span_parse_signed_digits(source, false, &is_negative, &value));
+
   *out_number = value;
   return AZ_OK;
 }
 
+AZ_NODISCARD az_result az_span_atou32(az_span source, uint32_t* out_number)
+{
+  _az_PRECONDITION_VALID_SPAN(source, 1, false);
+  _az_PRECONDITION_NOT_NULL(out_number);
+
+  bool is_negative = false;
+  uint64_t value = 0;
+  _az_RETURN_IF_FAILED(_az_span_parse_signed_digits(source, false, &is_negative, &value));
+
+  if (value > UINT32_MAX)
+  {
+    return AZ_ERROR_UNEXPECTED_CHAR;
+  }
+
+  *out_number = (uint32_t)value;
+  return AZ_OK;
+}
+
 AZ_NODISCARD az_result az_span_atoi64(az_span source, int64_t* out_number)
 {
   _az_PRECONDITION_VALID_SPAN(source, 1, false);
   _az_PRECONDITION_NOT_NULL(out_number);
 
-  int32_t const span_size = az_span_size(source);
+  bool is_negative = false;
+  uint64_t value = 0;
+  _az_RETURN_IF_FAILED(_az_span_parse_signed_digits(source, true, &is_negative, &value));
 
-  if (span_size < 1)
+  // The absolute value of INT64_MIN is 1 more than the absolute value of INT64_MAX.
+  if (value > (uint64_t)INT64_MAX + (is_negative ? 1U : 0U))
   {
     return AZ_ERROR_UNEXPECTED_CHAR;
   }
 
-  // If the first character is not a digit, - sign, or an optional + sign, return error.
-  int32_t starting_index = 0;
-  uint8_t* source_ptr = az_span_ptr(source);
-  uint8_t next_byte = source_ptr[0];
-  int64_t sign = 1;
+  // Negate as an unsigned value, so that INT64_MIN doesn't overflow.
+  *out_number = (int64_t)(is_negative ? 0U - value : value);
+  return AZ_OK;
+}
+
+AZ_NODISCARD az_result az_span_atoi32(az_span source, int32_t* out_number)
+{
+  _az_PRECONDITION_VALID_SPAN(source, 1, false);
+  _az_PRECONDITION_NOT_NULL(out_number);
+
+  bool is_negative = false;
+  uint64_t value = 0;
+  _az_RETURN_IF_FAILED(_az_span_parse_signed_digits(source, true, &is_negative, &value));
 
-  if (!isdigit(next_byte))
+  // The absolute value of INT32_MIN is 1 more than the absolute value of INT32_MAX.
+  if (value > (uint64_t)INT32_MAX + (is_negative ? 1U : 0U))
   {
-    // There must be another byte after a sign.
-    // The loop below checks that it must be a digit.
-    if (next_byte != '+')
+    return AZ_ERROR_UNEXPECTED_CHAR;
+  }
+
+  *out_number = is_negative ? (int32_t)(0 - (int64_t)value) : (int32_t)value;
+  return AZ_OK;
+}
+
+// Powers of 10 that are exactly representable as a double.
+static double const _az_exact_powers_of_10[] = {
+  1e0,  1e1,  1e2,  1e3,  1e4,  1e5,  1e6,  1e7,  1e8,  1e9,  1e10, 1e11,
+  1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18, 1e19, 1e20, 1e21, 1e22,
+};
+
+// A power of 10 approximated as `significand * 2^exponent`, with the top bit of the significand
+// set.
+typedef struct
+{
+  uint64_t significand;
+  int16_t exponent;
+} _az_cached_power_of_10;
+
+// Every 8th power of 10, from 1e-344 up to 1e336, with the significand rounded to nearest.
+// The powers in between are derived by multiplying with an exact power of 10 (1e1 to 1e7). This
+// covers every decimal exponent that az_span_atod() can produce a non-zero finite double from, at
+// a fraction of the size of a table holding every power. az_span_dtoa_shortest() only uses the
+// cached powers themselves, whose spacing (about 26.6 binary orders of magnitude) is narrow enough
+// to scale any double into the range its digit generation requires.
+static _az_cached_power_of_10 const _az_cached_powers_of_10[] = {
+  { 0x98EE4A22ECF3188CULL, -1206 }, // 1e-344
+  { 0xE3E27A444D8D98B8ULL, -1180 }, // 1e-336
+  { 0xA9C98D8CCB009506ULL, -1153 }, // 1e-328
+  { 0xFD00B897478238D1ULL, -1127 }, // 1e-320
+  { 0xBC807527ED3E12BDULL, -1100 }, // 1e-312
+  { 0x8C71DCD9BA0B4926ULL, -1073 }, // 1e-304
+  { 0xD1476E2C07286FAAULL, -1047 }, // 1e-296
+  { 0x9BECCE62836AC577ULL, -1020 }, // 1e-288
+  { 0xE858AD248F5C22CAULL, -994 }, // 1e-280
+  { 0xAD1C8EAB5EE43B67ULL, -967 }, // 1e-272
+  { 0x80FA687F881C7F8EULL, -940 }, // 1e-264
+  { 0xC0314325637A193AULL, -914 }, // 1e-256
+  { 0x8F31CC0937AE58D3ULL, -887 }, // 1e-248
+  { 0xD5605FCDCF32E1D7ULL, -861 }, // 1e-240
+  { 0x9EFA548D26E5A6E2ULL, -834 }, // 1e-232
+  { 0xECE53CEC4A314EBEULL, -808 }, // 1e-224
+  { 0xB080392CC4349DEDULL, -781 }, // 1e-216
+  { 0x8380DEA93DA4BC60ULL, -754 }, // 1e-208
+  { 0xC3F490AA77BD60FDULL, -728 }, // 1e-200
+  { 0x91FF83775423CC06ULL, -701 }, // 1e-192
+  { 0xD98DDAEE19068C76ULL, -675 }, // 1e-184
+  { 0xA21727DB38CB0030ULL, -648 }, // 1e-176
+  { 0xF18899B1BC3F8CA2ULL, -622 }, // 1e-168
+  { 0xB3F4E093DB73A093ULL, -595 }, // 1e-160
+  { 0x8613FD0145877586ULL, -568 }, // 1e-152
+  { 0xC7CABA6E7C5382C9ULL, -542 }, // 1e-144
+  { 0x94DB483840B717F0ULL, -515 }, // 1e-136
+  { 0xDDD0467C64BCE4A1ULL, -489 }, // 1e-128
+  { 0xA54394FE1EEDB8FFULL, -462 }, // 1e-120
+  { 0xF64335BCF065D37DULL, -436 }, // 1e-112
+  { 0xB77ADA0617E3BBCBULL, -409 }, // 1e-104
+  { 0x88B402F7FD75539BULL, -382 }, // 1e-96
+  { 0xCBB41EF979346BCAULL, -356 }, // 1e-88
+  { 0x97C560BA6B0919A6ULL, -329 }, // 1e-80
+  { 0xE2280B6C20DD5232ULL, -303 }, // 1e-72
+  { 0xA87FEA27A539E9A5ULL, -276 }, // 1e-64
+  { 0xFB158592BE068D2FULL, -250 }, // 1e-56
+  { 0xBB127C53B17EC159ULL, -223 }, // 1e-48
+  { 0x8B61313BBABCE2C6ULL, -196 }, // 1e-40
+  { 0xCFB11EAD453994BAULL, -170 }, // 1e-32
+  { 0x9ABE14CD44753B53ULL, -143 }, // 1e-24
+  { 0xE69594BEC44DE15BULL, -117 }, // 1e-16
+  { 0xABCC77118461CEFDULL, -90 }, // 1e-8
+  { 0x8000000000000000ULL, -63 }, // 1e0
+  { 0xBEBC200000000000ULL, -37 }, // 1e8
+  { 0x8E1BC9BF04000000ULL, -10 }, // 1e16
+  { 0xD3C21BCECCEDA100ULL, 16 }, // 1e24
+  { 0x9DC5ADA82B70B59EULL, 43 }, // 1e32
+  { 0xEB194F8E1AE525FDULL, 69 }, // 1e40
+  { 0xAF298D050E4395D7ULL, 96 }, // 1e48
+  { 0x82818F1281ED44A0ULL, 123 }, // 1e56
+  { 0xC2781F49FFCFA6D5ULL, 149 }, // 1e64
+  { 0x90E40FBEEA1D3A4BULL, 176 }, // 1e72
+  { 0xD7E77A8F87DAF7FCULL, 202 }, // 1e80
+  { 0xA0DC75F1778E39D6ULL, 229 }, // 1e88
+  { 0xEFB3AB16C59B14A3ULL, 255 }, // 1e96
+  { 0xB2977EE300C50FE7ULL, 282 }, // 1e104
+  { 0x850FADC09923329EULL, 309 }, // 1e112
+  { 0xC646D63501A1511EULL, 335 }, // 1e120
+  { 0x93BA47C980E98CE0ULL, 362 }, // 1e128
+  { 0xDC21A1171D42645DULL, 388 }, // 1e136
+  { 0xA402B9C5A8D3A6E7ULL, 415 }, // 1e144
+  { 0xF46518C2EF5B8CD1ULL, 441 }, // 1e152
+  { 0xB616A12B7FE617AAULL, 468 }, // 1e160
+  { 0x87AA9AFF79042287ULL, 495 }, // 1e168
+  { 0xCA28A291859BBF93ULL, 521 }, // 1e176
+  { 0x969EB7C47859E744ULL, 548 }, // 1e184
+  { 0xE070F78D3927556BULL, 574 }, // 1e192
+  { 0xA738C6BEBB12D16DULL, 601 }, // 1e200
+  { 0xF92E0C3537826146ULL, 627 }, // 1e208
+  { 0xB9A74A0637CE2EE1ULL, 654 }, // 1e216
+  { 0x8A5296FFE33CC930ULL, 681 }, // 1e224
+  { 0xCE1DE40642E3F4B9ULL, 707 }, // 1e232
+  { 0x9991A6F3D6BF1766ULL, 734 }, // 1e240
+  { 0xE4D5E82392A40515ULL, 760 }, // 1e248
+  { 0xAA7EEBFB9DF9DE8EULL, 787 }, // 1e256
+  { 0xFE0EFB53D30DD4D8ULL, 813 }, // 1e264
+  { 0xBD49D14AA79DBC82ULL, 840 }, // 1e272
+  { 0x8D07E33455637EB3ULL, 867 }, // 1e280
+  { 0xD226FC195C6A2F8CULL, 893 }, // 1e288
+  { 0x9C935E00D4B9D8D2ULL, 920 }, // 1e296
+  { 0xE950DF20247C83FDULL, 946 }, // 1e304
+  { 0xADD57A27D29339F6ULL, 973 }, // 1e312
+  { 0x81842F29F2CCE376ULL, 1000 }, // 1e320
+  { 0xC0FE908895CF3B44ULL, 1026 }, // 1e328
+  { 0x8FCAC257558EE4E6ULL, 1053 }, // 1e336
+};
+
+enum
+{
+  _az_CACHED_POWERS_OF_10_MIN_EXPONENT = -344,
+  _az_CACHED_POWERS_OF_10_STEP = 8,
+
+  // The largest power of 10 that is exactly representable as a double.
+  _az_MAX_EXACT_POWER_OF_10 = 22,
+
+  // Number of decimal digits that always fit in a uint64_t.
+  _az_MAX_SIGNIFICANT_DIGITS_FOR_UINT64 = 19,
+
+  // A double has 53 significant bits (52 stored explicitly), so 11 of the bits of a 64-bit
+  // approximation are beyond the precision of the result.
+  _az_DOUBLE_SIGNIFICAND_BITS = 53,
+  _az_DOUBLE_EXTRA_BITS = 64 - _az_DOUBLE_SIGNIFICAND_BITS,
+
+  // The exponent of the least significant bit of the smallest subnormal double (2^-1074).
+  _az_DOUBLE_MIN_BINARY_EXPONENT = -1074,
+
+  // The exponent of the least significant bit of the largest finite double's significand.
+  _az_DOUBLE_MAX_BINARY_EXPONENT = 971,
+
+  // Any value below 1e-324 is less than half of the smallest subnormal double, so it rounds to 0.
+  _az_DOUBLE_MIN_DECIMAL_EXPONENT = -324,
+
+  // Any value of at least 1e309 overflows to infinity.
+  _az_DOUBLE_MAX_DECIMAL_EXPONENT = 309,
+
+  // Upper bound, in units of the least significant bit, of the error in the 64-bit approximation
+  // computed by _az_span_atod_approximate(). The error is below 4 units: less than 3 from the
+  // rounding of the power of 10 and less than 1 from the truncation of the product.
+  _az_ATOD_APPROXIMATION_ERROR = 8,
+
+  // Additional error when digits past the first 19 were dropped. The significand is then at least
+  // 1e18, so dropping digits changes the value by less than 1e-18 (about 2^-59.8) of it, which is
+  // less than 19 units of a 64-bit approximation.
+  _az_ATOD_TRUNCATION_ERROR = 24,
+
+  // Enough 32-bit limbs for the largest number used by _az_span_atod_slow() and _az_dtoa_bignum(),
+  // which is below 2^1100, with room to spare.
+  _az_BIGNUM_MAX_LIMBS = 48,
+};
+
+// Returns the high 64 bits of the 128-bit product of a and b, and sets out_low to the low 64 bits.
+AZ_NODISCARD AZ_INLINE uint64_t _az_multiply_64x64(uint64_t a, uint64_t b, uint64_t* out_low)
+{
+#if defined(__SIZEOF_INT128__)
+  __extension__ typedef unsigned __int128 _az_uint128;
+  _az_uint128 const product = (_az_uint128)a * b;
+  *out_low = (uint64_t)product;
+  return (uint64_t)(product >> 64U);
+#elif defined(_MSC_VER) && defined(_M_X64)
+  uint64_t high = 0;
+  *out_low = _umul128(a, b, &high);
+  return high;
+#else
+  uint64_t const a_low = (uint32_t)a;
+  uint64_t const a_high = a >> 32U;
+  uint64_t const b_low = (uint32_t)b;
+  uint64_t const b_high = b >> 32U;
+
+  uint64_t const low_low = a_low * b_low;
+  uint64_t const high_low = a_high * b_low;
+  uint64_t const low_high = a_low * b_high;
+  uint64_t const middle = (low_low >> 32U) + (uint32_t)high_low + low_high;
+
+  *out_low = (middle << 32U) | (uint32_t)low_low;
+  return a_high * b_high + (high_low >> 32U) + (middle >> 32U);
+#endif
+}
+
+// Multiplies two numbers whose top bits are set, truncating the product to its most significant 64
+// bits, and adds the binary exponent of the (truncated) result to inout_exponent.
+AZ_NODISCARD AZ_INLINE uint64_t
+_az_multiply_normalized(uint64_t a, uint64_t b, int32_t* inout_exponent)
+{
+  uint64_t low = 0;
+  uint64_t high = _az_multiply_64x64(a, b, &low);
+
+  // Since a and b are both at least 2^63, the product is at least 2^126, so at most one shift is
+  // needed for its top bit to be set.
+  if ((high >> 63U) == 0)
+  {
+    high = (high << 1U) | (low >> 63U);
+    *inout_exponent += 63;
+  }
+  else
+  {
+    *inout_exponent += 64;
+  }
+  return high;
+}
+
+// Returns the significand of a 64-bit approximation of 10^exponent10 and sets out_exponent2 to its
+// binary exponent.
+AZ_NODISCARD AZ_INLINE uint64_t _az_power_of_10(int32_t exponent10, int32_t* out_exponent2)
+{
+  int32_t const offset = exponent10 - _az_CACHED_POWERS_OF_10_MIN_EXPONENT;
+  _az_cached_power_of_10 const cached
+      = _az_cached_powers_of_10[offset / _az_CACHED_POWERS_OF_10_STEP];
+  int32_t const remainder = offset % _az_CACHED_POWERS_OF_10_STEP;
+
+  *out_exponent2 = cached.exponent;
+  if (remainder == 0)
+  {
+    return cached.significand;
+  }
+
+  // Powers of 10 up to 10^7 fit in 24 bits, so they are exact once normalized.
+  uint64_t const small_power = (uint64_t)_az_exact_powers_of_10[remainder];
+  int32_t const shift = _az_clz64(small_power);
+  *out_exponent2 -= shift;
+  return _az_multiply_normalized(cached.significand, small_power << (uint32_t)shift, out_exponent2);
+}
+
+// Rounds value / 2^shift to the nearest integer, with ties to even, where shift is within [1, 64].
+AZ_NODISCARD AZ_INLINE uint64_t _az_round_shift_right(uint64_t value, int32_t shift)
+{
+  if (shift == 64)
+  {
+    return value > 0x8000000000000000ULL ? 1U : 0U;
+  }
+
+  uint64_t const result = value >> (uint32_t)shift;
+  uint64_t const remainder = value & ((1ULL << (uint32_t)shift) - 1U);
+  uint64_t const half = 1ULL << (uint32_t)(shift - 1);
+  return result + ((remainder > half || (remainder == half && (result & 1U) != 0)) ? 1U : 0U);
+}
+
+// An arbitrary precision unsigned integer, stored as little endian 32-bit limbs.
+typedef struct
+{
+  uint32_t limbs[_az_BIGNUM_MAX_LIMBS];
+  int32_t size;
+} _az_bignum;
+
+static void _az_bignum_multiply_add(_az_bignum* number, uint32_t multiplier, uint32_t addend)
+{
+  uint64_t carry = addend;
+  for (int32_t i = 0; i < number->size; i++)
+  {
+    carry += (uint64_t)number->limbs[i] * multiplier;
+    number->limbs[i] = (uint32_t)carry;
+    carry >>= 32U;
+  }
+
+  if (carry != 0 && number->size < _az_BIGNUM_MAX_LIMBS)
+  {
+    number->limbs[number->size++] = (uint32_t)carry;
+  }
+}
+
+static void _az_bignum_multiply_power_of_5(_az_bignum* number, int32_t exponent)
+{
+  // 5^13 is the largest power of 5 that fits in a uint32_t.
+  for (; exponent >= 13; exponent -= 13)
+  {
+    _az_bignum_multiply_add(number, 1220703125U, 0);
+  }
+
+  uint32_t multiplier = 1;
+  for (; exponent > 0; exponent--)
+  {
+    multiplier *= 5U;
+  }
+  _az_bignum_multiply_add(number, multiplier, 0);
+}
+
+static void _az_bignum_shift_left(_az_bignum* number, int32_t shift)
+{
+  int32_t const limb_shift = shift / 32;
+  uint32_t const bit_shift = (uint32_t)shift % 32U;
+
+  if (number->size == 0 || number->size + limb_shift >= _az_BIGNUM_MAX_LIMBS)
+  {
+    return;
+  }
+
+  if (bit_shift != 0)
+  {
+    uint32_t const carry = number->limbs[number->size - 1] >> (32U - bit_shift);
+    for (int32_t i = number->size - 1; i > 0; i--)
     {
-      if (next_byte != '-')
-      {
-        return AZ_ERROR_UNEXPECTED_CHAR;
-      }
-      sign = -1;
+      number->limbs[i]
+          = (number->limbs[i] << bit_shift) | (number->limbs[i - 1] >> (32U - bit_shift));
     }
-    if (span_size < 2)
+    number->limbs[0] <<= bit_shift;
+
+    if (carry != 0)
     {
-      return AZ_ERROR_UNEXPECTED_CHAR;
+      number->limbs[number->size++] = carry;
     }
-    starting_index++;
   }
 
-  // if sign < 0, (-1 * sign + 1) / 2 = 1
-  // else, (-1 * sign + 1) / 2 = 0
-  // This is necessary to correctly account for the fact that the absolute value of INT64_MIN is 1
-  // more than than the absolute value of INT64_MAX.
-  uint64_t sign_factor = (uint64_t)(-1 * sign + 1) / 2;
+  if (limb_shift != 0)
+  {
+    for (int32_t i = number->size - 1; i >= 0; i--)
+    {
+      number->limbs[i + limb_shift] = number->limbs[i];
+    }
+    for (int32_t i = 0; i < limb_shift; i++)
+    {
+      number->limbs[i] = 0;
+    }
+    number->size += limb_shift;
+  }
+}
 
-  // Using unsigned int while parsing to account for potential overflow.
-  uint64_t value = 0;
+static int32_t _az_bignum_compare(_az_bignum const* left, _az_bignum const* right)
+{
+  if (left->size != right->size)
+  {
+    return left->size < right->size ? -1 : 1;
+  }
 
-  for (int32_t i = starting_index; i < span_size; ++i)
+  for (int32_t i = left->size - 1; i >= 0; i--)
   {
-    next_byte = source_ptr[i];
-    if (!isdigit(next_byte))
+    if (left->limbs[i] != right->limbs[i])
     {
-      return AZ_ERROR_UNEXPECTED_CHAR;
+      return left->limbs[i] < right->limbs[i] ? -1 : 1;
     }
-    uint64_t const d = (uint64_t)next_byte - '0';
+  }
+  return 0;
+}
 
-    // Check whether the next digit will cause an integer overflow.
-    // Before actually doing the math below, this is checking whether value * 10 + d > INT64_MAX, or
-    // in the case of negative numbers, checking whether value * 10 + d > INT64_MAX + 1.
-    if ((uint64_t)(INT64_MAX - d + sign_factor) / _az_NUMBER_OF_DECIMAL_VALUES < value)
+static void _az_bignum_set_uint64(_az_bignum* number, uint64_t value)
+{
+  number->limbs[0] = (uint32_t)value;
+  number->limbs[1] = (uint32_t)(value >> 32U);
+  number->size = number->limbs[1] != 0 ? 2 : (number->limbs[0] != 0 ? 1 : 0);
+}
+
+static void _az_bignum_add(_az_bignum* ref_number, _az_bignum const* addend)
+{
+  uint64_t carry = 0;
+  int32_t i = 0;
+  for (; i < addend->size || (carry != 0 && i < _az_BIGNUM_MAX_LIMBS); i++)
+  {
+    carry += (i < ref_number->size ? ref_number->limbs[i] : 0U);
+    carry += (i < addend->size ? addend->limbs[i] : 0U);
+    ref_number->limbs[i] = (uint32_t)carry;
+    carry >>= 32U;
+  }
+
+  if (i > ref_number->size)
+  {
+    ref_number->size = i;
+  }
+}
+
+// Subtracts subtrahend from ref_number, which must not be smaller than it.
+static void _az_bignum_subtract(_az_bignum* ref_number, _az_bignum const* subtrahend)
+{
+  int64_t borrow = 0;
+  for (int32_t i = 0; i < ref_number->size; i++)
+  {
+    borrow += (int64_t)ref_number->limbs[i];
+    borrow -= (i < subtrahend->size ? (int64_t)subtrahend->limbs[i] : 0);
+    ref_number->limbs[i] = (uint32_t)borrow;
+    borrow = borrow < 0 ? -1 : 0;
+  }
+
+  while (ref_number->size > 0 && ref_number->limbs[ref_number->size - 1] == 0)
+  {
+    ref_number->size--;
+  }
+}
+
+// Decides whether the exact value of the decimal number in source rounds to `significand` or to
+// `significand + 1` (in units of 2^exponent2), by comparing it to the halfway point between the two
+// using exact integer arithmetic. Only used when the 64-bit approximation is too close to call.
+// `exponent10` is the power of 10 that applies to all the digits in source, in order.
+static AZ_NODISCARD uint64_t
+_az_span_atod_slow(az_span source, int32_t exponent10, uint64_t significand, int32_t exponent2)
+{
+  // Every digit of the source, including the ones that didn't fit in 19 significant digits.
+  _az_bignum digits = { .size = 0 };
+  uint32_t chunk = 0;
+  uint32_t chunk_multiplier = 1;
+  uint8_t const* ptr = az_span_ptr(source);
+  uint8_t const* const end = ptr + az_span_size(source);
+  for (; ptr < end && (*ptr | 0x20U) != 'e'; ptr++)
+  {
+    if (_az_is_decimal_digit(*ptr))
     {
-      return AZ_ERROR_UNEXPECTED_CHAR;
+      chunk = chunk * _az_NUMBER_OF_DECIMAL_VALUES + (uint32_t)(*ptr - '0');
+      chunk_multiplier *= _az_NUMBER_OF_DECIMAL_VALUES;
+
+      // Add 9 digits at a time, the most that fit in a uint32_t.
+      if (chunk_multiplier == 1000000000U)
+      {
+        _az_bignum_multiply_add(&digits, chunk_multiplier, chunk);
+        chunk = 0;
+        chunk_multiplier = 1;
+      }
     }
+  }
+  _az_bignum_multiply_add(&digits, chunk_multiplier, chunk);
+
+  // The halfway point is (2 * significand + 1) * 2^(exponent2 - 1).
+  uint64_t const halfway_significand = 2 * significand + 1;
+  _az_bignum halfway = { .size = 0 };
+  _az_bignum_set_uint64(&halfway, halfway_significand);
+  int32_t halfway_exponent2 = exponent2 - 1;
+
+  // Compare digits * 10^exponent10 with halfway * 2^halfway_exponent2, after moving the powers of
+  // 5 and 2 to whichever side keeps them non-negative.
+  int32_t digits_exponent2 = 0;
+  if (exponent10 >= 0)
+  {
+    _az_bignum_multiply_power_of_5(&digits, exponent10);
+    digits_exponent2 = exponent10;
+  }
+  else
+  {
+    _az_bignum_multiply_power_of_5(&halfway, -exponent10);
+    halfway_exponent2 -= exponent10;
+  }
 
-    value = value * _az_NUMBER_OF_DECIMAL_VALUES + d;
+  if (halfway_exponent2 > digits_exponent2)
+  {
+    _az_bignum_shift_left(&halfway, halfway_exponent2 - digits_exponent2);
+  }
+  else
+  {
+    _az_bignum_shift_left(&digits, digits_exponent2 - halfway_exponent2);
   }
 
-  *out_number = (int64_t)value * sign;
-  return AZ_OK;
+  int32_t const comparison = _az_bignum_compare(&digits, &halfway);
+  return significand + ((comparison > 0 || (comparison == 0 && (significand & 1U) != 0)) ? 1U : 0U);
 }
 
-AZ_NODISCARD az_result az_span_atoi32(az_span source, int32_t* out_number)
+AZ_NODISCARD AZ_INLINE double _az_make_double(bool is_negative, uint64_t bits)
+{
+  bits |= is_negative ? 0x8000000000000000ULL : 0U;
+
+  double value = 0;
+  // NOLINTNEXTLINE(clang-analyzer-security.insecureAPI.DeprecatedOrUnsafeBufferHandling)
+  memcpy(&value, &bits, sizeof(value));
+  return value;
+}
+
+AZ_NODISCARD az_result az_span_atod(az_span source, double* out_number)
 {
   _az_PRECONDITION_VALID_SPAN(source, 1, false);
   _az_PRECONDITION_NOT_NULL(out_number);
 
-  int32_t const span_size = az_span_size(source);
+  int32_t size = az_span_size(source);
 
-  if (span_size < 1)
+  _az_PRECONDITION_RANGE(1, size, _az_MAX_SIZE_FOR_PARSING_DOUBLE);
+
+  uint8_t const* ptr = az_span_ptr(source);
+  uint8_t const* const end = ptr + size;
+
+  bool const is_negative = size > 0 && *ptr == '-';
+  if (is_negative || (size > 0 && *ptr == '+'))
+  {
+    ptr++;
+  }
+
+  // ".123", "  123", "nan", or "inf" are considered invalid.
+  if (ptr == end || !_az_is_decimal_digit(*ptr))
   {
     return AZ_ERROR_UNEXPECTED_CHAR;
   }
 
-  // If the first character is not a digit, - sign, or an optional + sign, return error.
-  int32_t starting_index = 0;
-  uint8_t* source_ptr = az_span_ptr(source);
-  uint8_t next_byte = source_ptr[0];
-  int32_t sign = 1;
+  // The value is significand * 10^exponent10, where the significand holds the first 19 significant
+  // digits. If any of the digits past those is not zero, is_truncated is set.
+  uint64_t significand = 0;
+  int32_t significant_digits = 0;
+  int32_t exponent10 = 0;
+  bool is_truncated = false;
 
-  if (!isdigit(next_byte))
+  for (; ptr < end && _az_is_decimal_digit(*ptr); ptr++)
   {
-    // There must be another byte after a sign.
-    // The loop below checks that it must be a digit.
-    if (next_byte != '+')
+    uint8_t const digit = (uint8_t)(*ptr - '0');
+    if (significant_digits < _az_MAX_SIGNIFICANT_DIGITS_FOR_UINT64)
     {
-      if (next_byte != '-')
-      {
-        return AZ_ERROR_UNEXPECTED_CHAR;
-      }
-      sign = -1;
+      significand = significand * _az_NUMBER_OF_DECIMAL_VALUES + digit;
+      significant_digits += significand != 0 ? 1 : 0;
     }
-    if (span_size < 2)
+    else
     {
-      return AZ_ERROR_UNEXPECTED_CHAR;
+      exponent10++;
+      is_truncated |= digit != 0;
     }
-    starting_index++;
   }
 
-  // if sign < 0, (-1 * sign + 1) / 2 = 1
-  // else, (-1 * sign + 1) / 2 = 0
-  // This is necessary to correctly account for the fact that the absolute value of INT32_MIN is 1
-  // more than than the absolute value of INT32_MAX.
-  uint32_t sign_factor = (uint32_t)(-1 * sign + 1) / 2;
-
-  // Using unsigned int while parsing to account for potential overflow.
-  uint32_t value = 0;
+  // The number of digits after the decimal point, all of which are part of `source`'s digits.
+  int32_t fraction_digits = 0;
+  if (ptr < end && *ptr == '.')
+  {
+    for (ptr++; ptr < end && _az_is_decimal_digit(*ptr); ptr++)
+    {
+      uint8_t const digit = (uint8_t)(*ptr - '0');
+      fraction_digits++;
+      if (significant_digits < _az_MAX_SIGNIFICANT_DIGITS_FOR_UINT64)
+      {
+        significand = significand * _az_NUMBER_OF_DECIMAL_VALUES + digit;
+        significant_digits += significand != 0 ? 1 : 0;
+        exponent10--;
+      }
+      else
+      {
+        is_truncated |= digit != 0;
+      }
+    }
+  }
 
-  for (int32_t i = starting_index; i < span_size; ++i)
+  int32_t exponent = 0;
+  if (ptr < end && (*ptr | 0x20U) == 'e')
   {
-    next_byte = source_ptr[i];
-    if (!isdigit(next_byte))
+    ptr++;
+    bool const is_exponent_negative = ptr < end && *ptr == '-';
+    if (ptr < end && (*ptr == '-' || *ptr == '+'))
     {
-      return AZ_ERROR_UNEXPECTED_CHAR;
+      ptr++;
     }
-    uint32_t const d = (uint32_t)next_byte - '0';
 
-    // Check whether the next digit will cause an integer overflow.
-    // Before actually doing the math below, this is checking whether value * 10 + d > INT32_MAX, or
-    // in the case of negative numbers, checking whether value * 10 + d > INT32_MAX + 1.
-    if ((uint32_t)(INT32_MAX - d + sign_factor) / _az_NUMBER_OF_DECIMAL_VALUES < value)
+    if (ptr == end || !_az_is_decimal_digit(*ptr))
     {
       return AZ_ERROR_UNEXPECTED_CHAR;
     }
 
-    value = value * _az_NUMBER_OF_DECIMAL_VALUES + d;
+    for (; ptr < end && _az_is_decimal_digit(*ptr); ptr++)
+    {
+      // Stop accumulating once the exponent is far beyond the range of a double, to avoid
+      // overflowing; any such value is either 0 or infinity regardless of the remaining digits.
+      if (exponent < 100000)
+      {
+        exponent = exponent * _az_NUMBER_OF_DECIMAL_VALUES + (*ptr - '0');
+      }
+    }
+
+    exponent = is_exponent_negative ? -exponent : exponent;
   }
 
-  *out_number = (int32_t)value * sign;
-  return AZ_OK;
-}
+  // The entire span must be consumed.
+  if (ptr != end)
+  {
+    return AZ_ERROR_UNEXPECTED_CHAR;
+  }
 
-static bool _is_valid_start_of_double(uint8_t first_byte)
-{
-  // ".123", "  123", "nan", or "inf" are considered invalid
-  bool result = isdigit(first_byte) || first_byte == '+' || first_byte == '-';
+  exponent10 += exponent;
 
-  return result;
-}
+  if (significand == 0 || exponent10 + significant_digits <= _az_DOUBLE_MIN_DECIMAL_EXPONENT)
+  {
+    *out_number = _az_make_double(is_negative, 0);
+    return AZ_OK;
+  }
+
+  if (exponent10 + significant_digits - 1 >= _az_DOUBLE_MAX_DECIMAL_EXPONENT)
+  {
+    return AZ_ERROR_UNEXPECTED_CHAR;
+  }
 
-// Disable the following warning just for this particular use case.
-// C4996: 'sscanf': This function or variable may be unsafe. Consider using sscanf_s instead.
-// C4710: 'sscanf': function not inlined
-#ifdef _MSC_VER
-#pragma warning(push)
-#pragma warning(disable : 4996)
-#pragma warning(disable : 4710)
+#if !defined(FLT_EVAL_METHOD) || FLT_EVAL_METHOD == 0
+  // Fast path: when both the significand and the power of 10 are exactly representable as doubles,
+  // a single (correctly rounded) multiplication or division gives the correctly rounded result.
+  // This requires floating point arithmetic to be performed in double precision, rather than in an
+  // extended precision that would round twice.
+  if (!is_truncated && significand <= (1ULL << _az_DOUBLE_SIGNIFICAND_BITS)
+      && exponent10 >= -_az_MAX_EXACT_POWER_OF_10 && exponent10 <= _az_MAX_EXACT_POWER_OF_10)
+  {
+    double const value = exponent10 < 0
+        ? (double)significand / _az_exact_powers_of_10[-exponent10]
+        : (double)significand * _az_exact_powers_of_10[exponent10];
+    *out_number = is_negative ? -value : value;
+    return AZ_OK;
+  }
 #endif
 
-AZ_NODISCARD az_result az_span_atod(az_span source, double* out_number)
-{
-  _az_PRECONDITION_VALID_SPAN(source, 1, false);
-  _az_PRECONDITION_NOT_NULL(out_number);
+  // Otherwise, compute a 64-bit approximation of significand * 10^exponent10, along with a bound on
+  // its error. If the bounds of the error both round to the same double, so does the exact value.
+  int32_t exponent2 = 0;
+  uint64_t const power = _az_power_of_10(exponent10, &exponent2);
+  int32_t const leading_zeros = _az_clz64(significand);
+  exponent2 -= leading_zeros;
+  uint64_t const approximation
+      = _az_multiply_normalized(significand << (uint32_t)leading_zeros, power, &exponent2);
+
+  uint64_t const error_below = _az_ATOD_APPROXIMATION_ERROR;
+  uint64_t const error_above
+      = _az_ATOD_APPROXIMATION_ERROR + (is_truncated ? _az_ATOD_TRUNCATION_ERROR : 0);
+  uint64_t const low = approximation - error_below;
+  bool const is_high_overflow = approximation > UINT64_MAX - error_above;
+  uint64_t const high = is_high_overflow ? UINT64_MAX : approximation + error_above;
+
+  // The binary exponent of the least significant bit of the result: 53 significant bits for normal
+  // numbers, fewer for subnormal numbers.
+  int32_t result_exponent2 = exponent2 + _az_DOUBLE_EXTRA_BITS;
+  if (result_exponent2 < _az_DOUBLE_MIN_BINARY_EXPONENT)
+  {
+    result_exponent2 = _az_DOUBLE_MIN_BINARY_EXPONENT;
+  }
 
-  int32_t size = az_span_size(source);
+  int32_t const shift = result_exponent2 - exponent2;
+  uint64_t result_low = 0;
+  uint64_t result_high = 0;
+  if (shift <= 64)
+  {
+    result_low = _az_round_shift_right(low, shift);
 
-  _az_PRECONDITION_RANGE(1, size, _az_MAX_SIZE_FOR_PARSING_DOUBLE);
+    // Past 2^64, the high bound rounds to the value 2^64 itself.
+    result_high = is_high_overflow ? (1ULL << (uint32_t)(64 - shift))
+                                   : _az_round_shift_right(high, shift);
+  }
+  else
+  {
+    // Below half of the smallest subnormal double, unless the high bound reaches it.
+    result_high = (is_high_overflow && shift == 65) ? 1U : 0U;
+  }
 
-  // This check is necessary to prevent sscanf from reading bytes past the end of the span, when the
-  // span might contain whitespace or other invalid bytes at the start.
-  uint8_t* source_ptr = az_span_ptr(source);
-  if (size < 1 || !_is_valid_start_of_double(source_ptr[0]))
+  uint64_t significand2 = result_low;
+  if (result_low != result_high)
+  {
+    significand2 = _az_span_atod_slow(
+        source, exponent - fraction_digits, result_low, result_exponent2);
+  }
+
+  if (result_exponent2 > _az_DOUBLE_MAX_BINARY_EXPONENT)
   {
     return AZ_ERROR_UNEXPECTED_CHAR;
   }
 
-  // Stack based string to allow thread-safe mutation.
-  // The length is 8 to allow space for the null-terminating character.
-  // NOLINTNEXTLINE(readability-magic-numbers,  cppcoreguidelines-avoid-magic-numbers)
-  char format[8] = "%00lf%n";
+  // Adding the significand (whose top bit, if set, is the implicit bit of a normal double) to the
+  // biased exponent also handles a significand that rounded up to the next power of 2.
+  uint64_t const bits
+      = ((uint64_t)(result_exponent2 - _az_DOUBLE_MIN_BINARY_EXPONENT) << 52U) + significand2;
+  double const value = _az_make_double(is_negative, bits);
+  if (!_az_isfinite(value))
+  {
+    return AZ_ERROR_UNEXPECTED_CHAR;
+  }
 
-  // Starting at 1 to skip the '%' character
-  format[1] = (char)((size / _az_NUMBER_OF_DECIMAL_VALUES) + '0');
-  format[2] = (char)((size % _az_NUMBER_OF_DECIMAL_VALUES) + '0');
+  *out_number = value;
+  return AZ_OK;
+}
 
-  int32_t chars_consumed = 0;
-  // NOLINTNEXTLINE(clang-analyzer-security.insecureAPI.DeprecatedOrUnsafeBufferHandling)
-  int32_t n = sscanf((char*)source_ptr, format, out_number, &chars_consumed);
+#ifdef _az_SIMD_WIDTH
+// Vectorized search for `target` within `source`, testing _az_SIMD_WIDTH candidate positions at a
+// time. A position is a candidate only if both the first and the last byte of `target` match at
+// that position, which filters out almost every false start before the remaining bytes are
+// compared. Candidates are evaluated in increasing order, so the first match found is the same as
+// the one the scalar loop would return. When `ignore_case` is true, ASCII letters are compared
+// without regard to case.
+// Returns the index of `target` if found. Otherwise, returns -1 and sets `out_next_index` to the
+// first candidate position that has not been evaluated yet (the tail is left to the scalar loop).
+AZ_NODISCARD AZ_INLINE int32_t _az_span_find_vectorized(
+    uint8_t* source_ptr,
+    int32_t source_size,
+    uint8_t* target_ptr,
+    int32_t target_size,
+    bool ignore_case,
+    int32_t* out_next_index)
+{
+  int32_t const last_offset = target_size - 1;
+  size_t const middle_size = target_size > 2 ? (size_t)(target_size - 2) : 0;
+  uint8_t first_byte = target_ptr[0];
+  uint8_t last_byte = target_ptr[last_offset];
+  if (ignore_case)
+  {
+    first_byte = _az_tolower(first_byte);
+    last_byte = _az_tolower(last_byte);
+  }
+  _az_simd_vector const first = _az_simd_broadcast(first_byte);
+  _az_simd_vector const last = _az_simd_broadcast(last_byte);
 
-  // Success if the entire source was consumed by sscanf and it set the out_number argument.
-  return (size == chars_consumed && n == 1 && _az_isfinite(*out_number)) ? AZ_OK
-                                                                         : AZ_ERROR_UNEXPECTED_CHAR;
-}
+  int32_t i = 0;
+  for (; i + last_offset + _az_SIMD_WIDTH <= source_size; i += _az_SIMD_WIDTH)
+  {
+    _az_simd_vector block_first = _az_simd_load(source_ptr + i);
+    _az_simd_vector block_last = _az_simd_load(source_ptr + i + last_offset);
+    if (ignore_case)
+    {
+      block_first = _az_simd_to_lower(block_first);
+      block_last = _az_simd_to_lower(block_last);
+    }
 
-#ifdef _MSC_VER
-#pragma warning(pop)
-#endif
+    uint64_t mask = _az_simd_mask(
+        _az_simd_and(_az_simd_eq(first, block_first), _az_simd_eq(last, block_last)));
+
+    while (mask != 0)
+    {
+      int32_t const candidate = i + _az_simd_mask_first_lane(mask);
+      bool const is_match = ignore_case
+          ? az_span_is_content_equal_ignoring_case(
+              az_span_create(source_ptr + candidate + 1, (int32_t)middle_size),
+              az_span_create(target_ptr + 1, (int32_t)middle_size))
+          : memcmp(source_ptr + candidate + 1, target_ptr + 1, middle_size) == 0;
+      if (is_match)
+      {
+        return candidate;
+      }
+      mask = _az_simd_mask_clear_first_lane(mask);
+    }
+  }
+
+  *out_next_index = i;
+  return -1;
+}
+#endif // _az_SIMD_WIDTH
 
 AZ_NODISCARD int32_t az_span_find(az_span source, az_span target)
 {
   /* This function implements the Naive string-search algorithm.
    * The rationale to use this algorithm instead of other potentially more
    * performing ones (Rabin-Karp, e.g.) is due to no additional space needed.
+   * Callers searching for the same target repeatedly can preprocess it once with
+   * az_span_searcher_create() and use az_span_searcher_find() instead.
+   * When the SDK is built with AZ_SIMD, the bulk of `source` is first scanned by
+   * _az_span_find_vectorized() and only the remaining tail goes through the loop below.
    * The logic:
    * 1. The function will look into each position of `source` if it contains the same value as the
    * first position of `target`.
@@ -424,57 +1057,217 @@ AZ_NODISCARD int32_t az_span_find(az_span source, az_span target)
    *         to be checked).
    */
 
+  _az_PRECONDITION_VALID_SPAN(source, 0, true);
+  _az_PRECONDITION_VALID_SPAN(target, 0, true);
+
   int32_t source_size = az_span_size(source);
   int32_t target_size = az_span_size(target);
   const int32_t target_not_found = -1;
 
-  if (target_size == 0)
-  {
-    return 0;
-  }
+  if (target_size == 0)
+  {
+    return 0;
+  }
+
+  if (source_size < target_size)
+  {
+    return target_not_found;
+  }
+
+  uint8_t* source_ptr = az_span_ptr(source);
+  uint8_t* target_ptr = az_span_ptr(target);
+
+  int32_t i = 0;
+
+#ifdef _az_SIMD_WIDTH
+  int32_t const vectorized_result
+      = _az_span_find_vectorized(source_ptr, source_size, target_ptr, target_size, false, &i);
+  if (vectorized_result != target_not_found)
+  {
+    return vectorized_result;
+  }
+#endif // _az_SIMD_WIDTH
+
+  // This loop traverses `source` position by position (step 1.)
+  for (; i < (source_size - target_size + 1); i++)
+  {
+    // This is the check done in step 1. above.
+    if (source_ptr[i] == target_ptr[0])
+    {
+      // The condition in step 2. has been satisfied.
+      int32_t j = 1;
+      // This is the loop defined in step 3.
+      // The loop must be broken if it reaches the ends of `target` (step 3.) OR `source`
+      // (step 5.).
+      for (; j < target_size && (i + j) < source_size; j++)
+      {
+        // Condition defined in step 5.
+        if (source_ptr[i + j] != target_ptr[j])
+        {
+          break;
+        }
+      }
+
+      if (j == target_size)
+      {
+        // All bytes in `target` have been checked and matched the corresponding bytes in `source`
+        // (from the start point `i`), so this is indeed an instance of `target` in that position
+        // of `source` (step 4.).
+
+        return i;
+      }
+    }
+  }
+
+  // If the function hasn't returned before, all positions
+  // of `source` have been evaluated but `target` could not be found.
+  return target_not_found;
+}
+
+AZ_NODISCARD int32_t az_span_find_ignoring_case(az_span source, az_span target)
+{
+  _az_PRECONDITION_VALID_SPAN(source, 0, true);
+  _az_PRECONDITION_VALID_SPAN(target, 0, true);
+
+  int32_t const source_size = az_span_size(source);
+  int32_t const target_size = az_span_size(target);
+
+  if (target_size == 0)
+  {
+    return 0;
+  }
+
+  if (source_size < target_size)
+  {
+    return -1;
+  }
+
+  uint8_t* source_ptr = az_span_ptr(source);
+  uint8_t* target_ptr = az_span_ptr(target);
+  int32_t i = 0;
+
+#ifdef _az_SIMD_WIDTH
+  int32_t const vectorized_result
+      = _az_span_find_vectorized(source_ptr, source_size, target_ptr, target_size, true, &i);
+  if (vectorized_result != -1)
+  {
+    return vectorized_result;
+  }
+#endif // _az_SIMD_WIDTH
+
+  uint8_t const first = _az_tolower(target_ptr[0]);
+  for (; i <= source_size - target_size; i++)
+  {
+    if (_az_tolower(source_ptr[i]) == first
+        && az_span_is_content_equal_ignoring_case(
+            az_span_create(source_ptr + i, target_size), target))
+    {
+      return i;
+    }
+  }
+
+  return -1;
+}
+
+AZ_NODISCARD AZ_INLINE uint64_t _az_span_searcher_bloom_bit(uint8_t value)
+{
+  return (uint64_t)1 << (value & 0x3FU);
+}
+
+AZ_NODISCARD az_span_searcher az_span_searcher_create(az_span target)
+{
+  _az_PRECONDITION_VALID_SPAN(target, 0, true);
+
+  az_span_searcher searcher = { 0 };
+  searcher._internal.target = target;
+
+  int32_t const target_size = az_span_size(target);
+  if (target_size == 0)
+  {
+    return searcher;
+  }
+
+  // The skip is how far the window can move when the last byte of the target matches but the rest
+  // does not: the distance between the last byte and its previous occurrence within the target.
+  uint8_t const* target_ptr = az_span_ptr(target);
+  int32_t const last_index = target_size - 1;
+  uint8_t const last = target_ptr[last_index];
+  int32_t skip = last_index;
+
+  for (int32_t i = 0; i < last_index; i++)
+  {
+    searcher._internal.bloom |= _az_span_searcher_bloom_bit(target_ptr[i]);
+    if (target_ptr[i] == last)
+    {
+      skip = last_index - i - 1;
+    }
+  }
+
+  searcher._internal.bloom |= _az_span_searcher_bloom_bit(last);
+  searcher._internal.skip = skip;
+  return searcher;
+}
+
+AZ_NODISCARD int32_t az_span_searcher_find(az_span_searcher const* searcher, az_span source)
+{
+  _az_PRECONDITION_NOT_NULL(searcher);
+
+  az_span const target = searcher->_internal.target;
+  int32_t const source_size = az_span_size(source);
+  int32_t const target_size = az_span_size(target);
 
-  if (source_size < target_size)
+  // There is nothing to skip over for single byte targets, so use the (potentially vectorized)
+  // linear search instead. This also covers the empty target and source cases.
+  if (target_size < 2 || source_size < target_size)
   {
-    return target_not_found;
+    return az_span_find(source, target);
   }
 
-  uint8_t* source_ptr = az_span_ptr(source);
-  uint8_t* target_ptr = az_span_ptr(target);
+  /* This is a simplified Boyer-Moore-Horspool search (the one used by CPython's fastsearch):
+   * 1. The last byte of the window is compared with the last byte of `target`.
+   * 2. If it matches, the remaining bytes of the window are compared with `target`. On a mismatch,
+   * the window moves by `skip`, so that the last byte lines up with its previous occurrence within
+   * `target`.
+   * 3. Whenever the byte right after the window is not in the bloom filter, it can't be part of
+   * any occurrence of `target`, and the window moves entirely past it.
+   * Windows are evaluated in increasing order, so the result is the same as az_span_find().
+   */
+  uint8_t const* source_ptr = az_span_ptr(source);
+  uint8_t const* target_ptr = az_span_ptr(target);
+  int32_t const last_index = target_size - 1;
+  uint8_t const last = target_ptr[last_index];
+  int32_t const last_window = source_size - target_size;
 
-  // This loop traverses `source` position by position (step 1.)
-  for (int32_t i = 0; i < (source_size - target_size + 1); i++)
+  for (int32_t i = 0; i <= last_window; i++)
   {
-    // This is the check done in step 1. above.
-    if (source_ptr[i] == target_ptr[0])
+    if (source_ptr[i + last_index] == last)
     {
-      // The condition in step 2. has been satisfied.
-      int32_t j = 1;
-      // This is the loop defined in step 3.
-      // The loop must be broken if it reaches the ends of `target` (step 3.) OR `source`
-      // (step 5.).
-      for (; j < target_size && (i + j) < source_size; j++)
+      if (memcmp(source_ptr + i, target_ptr, (size_t)last_index) == 0)
       {
-        // Condition defined in step 5.
-        if (source_ptr[i + j] != target_ptr[j])
-        {
-          break;
-        }
+        return i;
       }
 
-      if (j == target_size)
+      if (i < last_window
+          && (searcher->_internal.bloom & _az_span_searcher_bloom_bit(source_ptr[i + target_size]))
+              == 0)
       {
-        // All bytes in `target` have been checked and matched the corresponding bytes in `source`
-        // (from the start point `i`), so this is indeed an instance of `target` in that position
-        // of `source` (step 4.).
-
-        return i;
+        i += target_size;
+      }
+      else
+      {
+        i += searcher->_internal.skip;
       }
     }
+    else if (
+        i < last_window
+        && (searcher->_internal.bloom & _az_span_searcher_bloom_bit(source_ptr[i + target_size]))
+            == 0)
+    {
+      i += target_size;
+    }
   }
 
-  // If the function hasn't returned before, all positions
-  // of `source` have been evaluated but `target` could not be found.
-  return target_not_found;
+  return -1;
 }
 
 az_span az_span_copy(az_span destination, az_span source)
@@ -563,36 +1356,113 @@ AZ_INLINE uint8_t _az_decimal_to_ascii(uint8_t d)
   return (uint8_t)((uint32_t)('0' + d) & (uint8_t)UINT8_MAX);
 }
 
-static AZ_NODISCARD az_result _az_span_builder_append_uint64(az_span* ref_span, uint64_t n)
+// The powers of 10 that fit in a uint64_t, i.e. 10^0 to 10^19.
+static uint64_t const _az_uint64_powers_of_10[] = {
+  1ULL,
+  10ULL,
+  100ULL,
+  1000ULL,
+  10000ULL,
+  100000ULL,
+  1000000ULL,
+  10000000ULL,
+  100000000ULL,
+  1000000000ULL,
+  10000000000ULL,
+  100000000000ULL,
+  1000000000000ULL,
+  10000000000000ULL,
+  100000000000000ULL,
+  1000000000000000ULL,
+  10000000000000000ULL,
+  100000000000000000ULL,
+  1000000000000000000ULL,
+  10000000000000000000ULL,
+};
+
+// The ASCII digits of every number from 00 to 99, so that two digits can be written per division.
+static uint8_t const _az_two_digit_strings[200] = {
+  '0', '0', '0', '1', '0', '2', '0', '3', '0', '4', '0', '5', '0', '6', '0', '7', '0', '8', '0',
+  '9', '1', '0', '1', '1', '1', '2', '1', '3', '1', '4', '1', '5', '1', '6', '1', '7', '1', '8',
+  '1', '9', '2', '0', '2', '1', '2', '2', '2', '3', '2', '4', '2', '5', '2', '6', '2', '7', '2',
+  '8', '2', '9', '3', '0', '3', '1', '3', '2', '3', '3', '3', '4', '3', '5', '3', '6', '3', '7',
+  '3', '8', '3', '9', '4', '0', '4', '1', '4', '2', '4', '3', '4', '4', '4', '5', '4', '6', '4',
+  '7', '4', '8', '4', '9', '5', '0', '5', '1', '5', '2', '5', '3', '5', '4', '5', '5', '5', '6',
+  '5', '7', '5', '8', '5', '9', '6', '0', '6', '1', '6', '2', '6', '3', '6', '4', '6', '5', '6',
+  '6', '6', '7', '6', '8', '6', '9', '7', '0', '7', '1', '7', '2', '7', '3', '7', '4', '7', '5',
+  '7', '6', '7', '7', '7', '8', '7', '9', '8', '0', '8', '1', '8', '2', '8', '3', '8', '4', '8',
+  '5', '8', '6', '8', '7', '8', '8', '8', '9', '9', '0', '9', '1', '9', '2', '9', '3', '9', '4',
+  '9', '5', '9', '6', '9', '7', '9', '8', '9', '9',
+};
+
+AZ_NODISCARD int32_t az_span_u64toa_size(uint64_t source)
+{
+  // 0 has as many digits as 1.
+  uint64_t const value = source | 1U;
+
+  // The number of significant bits times 1233/4096 (slightly more than log10(2)) is either the
+  // number of digits, or one less than that, which the table lookup corrects.
+  int32_t const estimate = ((64 - _az_clz64(value)) * 1233) >> 12;
+  return estimate + (value >= _az_uint64_powers_of_10[estimate] ? 1 : 0);
+}
+
+AZ_NODISCARD int32_t az_span_i64toa_size(int64_t source)
+{
+  // Negate as an unsigned value, so that INT64_MIN doesn't overflow.
+  return source < 0 ? 1 + az_span_u64toa_size(0U - (uint64_t)source)
+                    : az_span_u64toa_size((uint64_t)source);
+}
+
+// Writes the two digits of value (0 to 99) right before end.
+AZ_INLINE void _az_write_two_digits(uint8_t* end, uint32_t value)
+{
+  end[-2] = _az_two_digit_strings[value * 2];
+  end[-1] = _az_two_digit_strings[(value * 2) + 1];
+}
+
+// Writes the digits of n so that they end right before end, which must leave room for
+// az_span_u64toa_size(n) bytes.
+static void _az_write_uint64_digits(uint8_t* end, uint64_t n)
 {
-  _az_RETURN_IF_NOT_ENOUGH_SIZE(*ref_span, 1);
+  // Peel off 8 digits at a time while the value doesn't fit in 32 bits, so that the rest of the
+  // divisions are 32-bit, which is much cheaper on the 32-bit devices this SDK often runs on.
+  while (n > UINT32_MAX)
+  {
+    uint32_t chunk = (uint32_t)(n % 100000000U);
+    n /= 100000000U;
+    for (int32_t i = 0; i < 4; i++)
+    {
+      _az_write_two_digits(end, chunk % 100U);
+      chunk /= 100U;
+      end -= 2;
+    }
+  }
 
-  if (n == 0)
+  uint32_t nn = (uint32_t)n;
+  while (nn >= 100U)
   {
-    *ref_span = az_span_copy_u8(*ref_span, '0');
-    return AZ_OK;
+    _az_write_two_digits(end, nn % 100U);
+    nn /= 100U;
+    end -= 2;
   }
 
-  uint64_t div = _az_SMALLEST_20_DIGIT_NUMBER;
-  uint64_t nn = n;
-  int32_t digit_count = _az_MAX_SIZE_FOR_UINT64;
-  while (nn / div == 0)
+  if (nn >= 10U)
+  {
+    _az_write_two_digits(end, nn);
+  }
+  else
   {
-    div /= _az_NUMBER_OF_DECIMAL_VALUES;
-    digit_count--;
+    end[-1] = _az_decimal_to_ascii((uint8_t)nn);
   }
+}
 
+static AZ_NODISCARD az_result _az_span_builder_append_uint64(az_span* ref_span, uint64_t n)
+{
+  int32_t const digit_count = az_span_u64toa_size(n);
   _az_RETURN_IF_NOT_ENOUGH_SIZE(*ref_span, digit_count);
 
-  while (div > 1)
-  {
-    uint8_t value_to_append = _az_decimal_to_ascii((uint8_t)(nn / div));
-    *ref_span = az_span_copy_u8(*ref_span, value_to_append);
-    nn %= div;
-    div /= _az_NUMBER_OF_DECIMAL_VALUES;
-  }
-  uint8_t value_to_append = _az_decimal_to_ascii((uint8_t)nn);
-  *ref_span = az_span_copy_u8(*ref_span, value_to_append);
+  _az_write_uint64_digits(az_span_ptr(*ref_span) + digit_count, n);
+  *ref_span = az_span_slice_to_end(*ref_span, digit_count);
   return AZ_OK;
 }
 
@@ -614,7 +1484,8 @@ AZ_NODISCARD az_result az_span_i64toa(az_span destination, int64_t source, az_sp
   {
     _az_RETURN_IF_NOT_ENOUGH_SIZE(destination, 1);
     *out_span = az_span_copy_u8(destination, '-');
-    return _az_span_builder_append_uint64(out_span, (uint64_t)-source);
+    // Negate as an unsigned value, so that INT64_MIN doesn't overflow.
+    return _az_span_builder_append_uint64(out_span, 0U - (uint64_t)source);
   }
 
   // make out_span point to destination before trying to write on it (might be an empty az_span or
@@ -626,38 +1497,11 @@ AZ_NODISCARD az_result az_span_i64toa(az_span destination, int64_t source, az_sp
 static AZ_NODISCARD az_result
 _az_span_builder_append_u32toa(az_span destination, uint32_t n, az_span* out_span)
 {
-  _az_RETURN_IF_NOT_ENOUGH_SIZE(destination, 1);
-
-  if (n == 0)
-  {
-    *out_span = az_span_copy_u8(destination, '0');
-    return AZ_OK;
-  }
-
-  uint32_t div = _az_SMALLEST_10_DIGIT_NUMBER;
-  uint32_t nn = n;
-  int32_t digit_count = _az_MAX_SIZE_FOR_UINT32;
-  while (nn / div == 0)
-  {
-    div /= _az_NUMBER_OF_DECIMAL_VALUES;
-    digit_count--;
-  }
-
+  int32_t const digit_count = az_span_u64toa_size(n);
   _az_RETURN_IF_NOT_ENOUGH_SIZE(destination, digit_count);
 
-  *out_span = destination;
-
-  while (div > 1)
-  {
-    uint8_t value_to_append = _az_decimal_to_ascii((uint8_t)(nn / div));
-    *out_span = az_span_copy_u8(*out_span, value_to_append);
-
-    nn %= div;
-    div /= _az_NUMBER_OF_DECIMAL_VALUES;
-  }
-
-  uint8_t value_to_append = _az_decimal_to_ascii((uint8_t)nn);
-  *out_span = az_span_copy_u8(*out_span, value_to_append);
+  _az_write_uint64_digits(az_span_ptr(destination) + digit_count, n);
+  *out_span = az_span_slice_to_end(destination, digit_count);
   return AZ_OK;
 }
 
@@ -679,7 +1523,9 @@ AZ_NODISCARD az_result az_span_i32toa(az_span destination, int32_t source, az_sp
   {
     _az_RETURN_IF_NOT_ENOUGH_SIZE(*out_span, 1);
     *out_span = az_span_copy_u8(*out_span, '-');
-    source = -source;
+
+    // Negate as an unsigned value, so that INT32_MIN doesn't overflow.
+    return _az_span_builder_append_u32toa(*out_span, 0U - (uint32_t)source, out_span);
   }
 
   return _az_span_builder_append_u32toa(*out_span, (uint32_t)source, out_span);
@@ -787,6 +1633,490 @@ az_span_dtoa(az_span destination, double source, int32_t fractional_digits, az_s
   return _az_span_builder_append_uint64(out_span, fractional_part);
 }
 
+// A number with extended precision ("do it yourself floating point"): significand * 2^exponent.
+typedef struct
+{
+  uint64_t significand;
+  int32_t exponent;
+} _az_diy_fp;
+
+AZ_NODISCARD AZ_INLINE _az_diy_fp _az_diy_fp_normalize(uint64_t significand, int32_t exponent)
+{
+  int32_t const shift = _az_clz64(significand);
+  return (_az_diy_fp){
+    .significand = significand << (uint32_t)shift,
+    .exponent = exponent - shift,
+  };
+}
+
+// Multiplies a and b, rounding the 128-bit product to its most significant 64 bits.
+AZ_NODISCARD AZ_INLINE _az_diy_fp _az_diy_fp_multiply(_az_diy_fp a, _az_diy_fp b)
+{
+  uint64_t low = 0;
+  uint64_t const high = _az_multiply_64x64(a.significand, b.significand, &low);
+  return (_az_diy_fp){
+    .significand = high + (low >> 63U),
+    .exponent = a.exponent + b.exponent + 64,
+  };
+}
+
+enum
+{
+  // The range of binary exponents that Grisu's digit generation works with. The scaled value's
+  // integral part then fits in a uint32_t, and its fractional part can be multiplied by 10 without
+  // overflowing a uint64_t.
+  _az_GRISU_MIN_TARGET_EXPONENT = -60,
+  _az_GRISU_MAX_TARGET_EXPONENT = -32,
+
+  // The shortest representation of a double never needs more than 17 significant digits.
+  _az_MAX_SHORTEST_DOUBLE_DIGITS = 17,
+
+  // Numbers whose decimal point position is within (-6, 21] are written without an exponent, just
+  // like JavaScript's Number.prototype.toString() does.
+  _az_SHORTEST_DOUBLE_MIN_FIXED_POINT = -6,
+  _az_SHORTEST_DOUBLE_MAX_FIXED_POINT = 21,
+};
+
+// Returns the cached power of 10 whose binary exponent is within [min_exponent, max_exponent], and
+// sets out_exponent10 to its decimal exponent.
+AZ_NODISCARD AZ_INLINE _az_diy_fp
+_az_cached_power_of_10_in_range(int32_t min_exponent, int32_t max_exponent, int32_t* out_exponent10)
+{
+  int32_t const last_index = (int32_t)_az_COUNTOF(_az_cached_powers_of_10) - 1;
+
+  // The power's binary exponent is close to exponent10 * log2(10) - 63, and 78913 / 2^18 is close
+  // to log10(2). The estimate is at most one entry off either way.
+  int32_t index = (((min_exponent + 63) * 78913) / (1 << 18) - _az_CACHED_POWERS_OF_10_MIN_EXPONENT)
+      / _az_CACHED_POWERS_OF_10_STEP;
+  index = index < 0 ? 0 : (index > last_index ? last_index : index);
+
+  while (index < last_index && _az_cached_powers_of_10[index].exponent < min_exponent)
+  {
+    index++;
+  }
+  while (index > 0 && _az_cached_powers_of_10[index].exponent > max_exponent)
+  {
+    index--;
+  }
+
+  *out_exponent10 = _az_CACHED_POWERS_OF_10_MIN_EXPONENT + index * _az_CACHED_POWERS_OF_10_STEP;
+  return (_az_diy_fp){ .significand = _az_cached_powers_of_10[index].significand,
+                       .exponent = _az_cached_powers_of_10[index].exponent };
+}
+
+// Moves the last generated digit closer to w, as long as that keeps it inside the unsafe interval,
+// then checks whether the result is guaranteed to be the closest to w, and inside the safe
+// interval. All the distances are relative to too_high, in units of 10^kappa * `unit`.
+AZ_NODISCARD static bool _az_grisu3_round_weed(
+    uint8_t* digits,
+    int32_t length,
+    uint64_t distance_too_high_w,
+    uint64_t unsafe_interval,
+    uint64_t rest,
+    uint64_t ten_kappa,
+    uint64_t unit)
+{
+  // The exact w lies in (too_high - big_distance, too_high - small_distance).
+  uint64_t const small_distance = distance_too_high_w - unit;
+  uint64_t const big_distance = distance_too_high_w + unit;
+
+  // The order of these comparisons avoids overflow and underflow.
+  while (rest < small_distance && unsafe_interval - rest >= ten_kappa
+         && (rest + ten_kappa < small_distance
+             || small_distance - rest >= rest + ten_kappa - small_distance))
+  {
+    digits[length - 1]--;
+    rest += ten_kappa;
+  }
+
+  // If the next smaller representation could also be closer to the exact w, it is not known which
+  // of the two is the closest.
+  if (rest < big_distance && unsafe_interval - rest >= ten_kappa
+      && (rest + ten_kappa < big_distance
+          || big_distance - rest > rest + ten_kappa - big_distance))
+  {
+    return false;
+  }
+
+  // The representation must be within the safe interval: [too_low + 2 unit, too_high - 2 unit].
+  return 2 * unit <= rest && rest <= unsafe_interval - 4 * unit;
+}
+
+// Grisu3, from Florian Loitsch's "Printing Floating-Point Numbers Quickly and Accurately with
+// Integers". Generates the shortest digits that round to value = significand * 2^exponent, along
+// with the power of 10 that applies to them, using 64-bit arithmetic only. Returns false for the
+// (about 0.5% of) values for which it can't prove that the digits are the shortest and closest.
+AZ_NODISCARD static bool _az_dtoa_grisu3(
+    uint64_t significand,
+    int32_t exponent,
+    bool is_lower_boundary_closer,
+    uint8_t* digits,
+    int32_t* out_length,
+    int32_t* out_exponent10)
+{
+  // The boundaries are halfway between the value and its neighbors, all with the same exponent.
+  _az_diy_fp const w = _az_diy_fp_normalize(significand, exponent);
+  _az_diy_fp const boundary_plus = _az_diy_fp_normalize((significand << 1U) + 1, exponent - 1);
+  _az_diy_fp boundary_minus = is_lower_boundary_closer
+      ? (_az_diy_fp){ .significand = (significand << 2U) - 1, .exponent = exponent - 2 }
+      : (_az_diy_fp){ .significand = (significand << 1U) - 1, .exponent = exponent - 1 };
+  boundary_minus.significand <<= (uint32_t)(boundary_minus.exponent - boundary_plus.exponent);
+  boundary_minus.exponent = boundary_plus.exponent;
+
+  int32_t power_exponent10 = 0;
+  _az_diy_fp const power = _az_cached_power_of_10_in_range(
+      _az_GRISU_MIN_TARGET_EXPONENT - (w.exponent + 64),
+      _az_GRISU_MAX_TARGET_EXPONENT - (w.exponent + 64),
+      &power_exponent10);
+
+  // Each of the scaled values is off by less than one unit, from the rounding of the power of 10
+  // and of the product. So too_low and too_high are certainly outside of the interval of values
+  // that round to w, and any representation inside the interval between them might be.
+  _az_diy_fp const scaled_w = _az_diy_fp_multiply(w, power);
+  uint64_t unit = 1;
+  uint64_t const too_low = _az_diy_fp_multiply(boundary_minus, power).significand - unit;
+  uint64_t const too_high = _az_diy_fp_multiply(boundary_plus, power).significand + unit;
+  uint64_t unsafe_interval = too_high - too_low;
+
+  // Split too_high into its integral and fractional parts, and generate the digits of too_high
+  // until the rest is within the unsafe interval, which effectively rounds down.
+  uint32_t const one_shift = (uint32_t)-scaled_w.exponent;
+  uint64_t const one = 1ULL << one_shift;
+  uint32_t integrals = (uint32_t)(too_high >> one_shift);
+  uint64_t fractionals = too_high & (one - 1);
+
+  // The largest power of 10 that is not larger than the integral part.
+  uint32_t divisor = 1;
+  int32_t kappa = 0;
+  if (integrals != 0)
+  {
+    kappa = 1;
+    while (integrals / divisor >= _az_NUMBER_OF_DECIMAL_VALUES)
+    {
+      divisor *= _az_NUMBER_OF_DECIMAL_VALUES;
+      kappa++;
+    }
+  }
+
+  int32_t length = 0;
+  for (; kappa > 0; divisor /= _az_NUMBER_OF_DECIMAL_VALUES)
+  {
+    digits[length++] = (uint8_t)(integrals / divisor);
+    integrals %= divisor;
+    kappa--;
+
+    uint64_t const rest = ((uint64_t)integrals << one_shift) + fractionals;
+    if (rest < unsafe_interval)
+    {
+      *out_length = length;
+      *out_exponent10 = kappa - power_exponent10;
+      return _az_grisu3_round_weed(
+          digits,
+          length,
+          too_high - scaled_w.significand,
+          unsafe_interval,
+          rest,
+          (uint64_t)divisor << one_shift,
+          unit);
+    }
+  }
+
+  // The integral part is done; continue with the fractional digits, scaling the unit and the
+  // interval along with them.
+  for (;;)
+  {
+    fractionals *= _az_NUMBER_OF_DECIMAL_VALUES;
+    unit *= _az_NUMBER_OF_DECIMAL_VALUES;
+    unsafe_interval *= _az_NUMBER_OF_DECIMAL_VALUES;
+
+    digits[length++] = (uint8_t)(fractionals >> one_shift);
+    fractionals &= one - 1;
+    kappa--;
+
+    if (fractionals < unsafe_interval)
+    {
+      *out_length = length;
+      *out_exponent10 = kappa - power_exponent10;
+      return _az_grisu3_round_weed(
+          digits,
+          length,
+          (too_high - scaled_w.significand) * unit,
+          unsafe_interval,
+          fractionals,
+          one,
+          unit);
+    }
+
+    // The unsafe interval is at least one unit wide, so it takes at most 19 digits (in practice,
+    // no more than 17) to get within it. This only guards against running past the buffer.
+    if (length >= _az_MAX_SHORTEST_DOUBLE_DIGITS)
+    {
+      return false;
+    }
+  }
+}
+
+static void _az_bignum_multiply_power_of_10(_az_bignum* number, int32_t exponent)
+{
+  _az_bignum_multiply_power_of_5(number, exponent);
+  _az_bignum_shift_left(number, exponent);
+}
+
+// The shortest digits that round to value = significand * 2^exponent, using exact integer
+// arithmetic, from Burger and Dybvig's "Printing Floating-Point Numbers Quickly and Accurately".
+// This is only used when _az_dtoa_grisu3() can't decide.
+static void _az_dtoa_bignum(
+    uint64_t significand,
+    int32_t exponent,
+    bool is_lower_boundary_closer,
+    uint8_t* digits,
+    int32_t* out_length,
+    int32_t* out_exponent10)
+{
+  // value = numerator / denominator, and the boundaries halfway to the neighboring doubles are
+  // (numerator - margin_low) / denominator and (numerator + margin_high) / denominator.
+  _az_bignum numerator = { .size = 0 };
+  _az_bignum denominator = { .size = 0 };
+  _az_bignum margin_low = { .size = 0 };
+  _az_bignum margin_high = { .size = 0 };
+  int32_t const closer_shift = is_lower_boundary_closer ? 1 : 0;
+
+  _az_bignum_set_uint64(&numerator, significand);
+  _az_bignum_set_uint64(&denominator, 1);
+  _az_bignum_set_uint64(&margin_low, 1);
+  if (exponent >= 0)
+  {
+    _az_bignum_shift_left(&numerator, exponent + 1 + closer_shift);
+    _az_bignum_shift_left(&denominator, 1 + closer_shift);
+    _az_bignum_shift_left(&margin_low, exponent);
+  }
+  else
+  {
+    _az_bignum_shift_left(&numerator, 1 + closer_shift);
+    _az_bignum_shift_left(&denominator, 1 - exponent + closer_shift);
+  }
+  margin_high = margin_low;
+  _az_bignum_shift_left(&margin_high, closer_shift);
+
+  // A representation exactly on a boundary rounds back to the value only when the significand is
+  // even, since ties round to even.
+  bool const is_even = (significand & 1U) == 0;
+
+  // Estimate the decimal exponent k, such that the high boundary is just below 10^k, from the
+  // position of the most significant bit (78913 / 2^18 is close to log10(2)). The estimate is
+  // never too high, and is fixed up below.
+  int32_t const bit_length = 64 - _az_clz64(significand);
+  int32_t k = ((exponent + bit_length - 1) * 78913) / (1 << 18) - 1;
+  if (k >= 0)
+  {
+    _az_bignum_multiply_power_of_10(&denominator, k);
+  }
+  else
+  {
+    _az_bignum_multiply_power_of_10(&numerator, -k);
+    _az_bignum_multiply_power_of_10(&margin_low, -k);
+    _az_bignum_multiply_power_of_10(&margin_high, -k);
+  }
+
+  _az_bignum high = numerator;
+  _az_bignum_add(&high, &margin_high);
+  for (int32_t comparison = _az_bignum_compare(&high, &denominator);
+       comparison > 0 || (comparison == 0 && is_even);
+       comparison = _az_bignum_compare(&high, &denominator))
+  {
+    _az_bignum_multiply_add(&denominator, _az_NUMBER_OF_DECIMAL_VALUES, 0);
+    k++;
+  }
+
+  int32_t length = 0;
+  for (;;)
+  {
+    _az_bignum_multiply_add(&numerator, _az_NUMBER_OF_DECIMAL_VALUES, 0);
+    _az_bignum_multiply_add(&margin_low, _az_NUMBER_OF_DECIMAL_VALUES, 0);
+    _az_bignum_multiply_add(&margin_high, _az_NUMBER_OF_DECIMAL_VALUES, 0);
+
+    uint8_t digit = 0;
+    while (_az_bignum_compare(&numerator, &denominator) >= 0)
+    {
+      _az_bignum_subtract(&numerator, &denominator);
+      digit++;
+    }
+
+    // Stop once rounding down (to `digit`) or up (to `digit + 1`) lands within the boundaries.
+    int32_t const low_comparison = _az_bignum_compare(&numerator, &margin_low);
+    bool const can_round_down = low_comparison < 0 || (low_comparison == 0 && is_even);
+
+    high = numerator;
+    _az_bignum_add(&high, &margin_high);
+    int32_t const high_comparison = _az_bignum_compare(&high, &denominator);
+    bool const can_round_up = high_comparison > 0 || (high_comparison == 0 && is_even);
+
+    if (!can_round_down && !can_round_up)
+    {
+      digits[length++] = digit;
+      continue;
+    }
+
+    if (can_round_down && can_round_up)
+    {
+      // Both are within the boundaries, so pick the closest, and the even digit on a tie.
+      _az_bignum twice_numerator = numerator;
+      _az_bignum_shift_left(&twice_numerator, 1);
+      int32_t const comparison = _az_bignum_compare(&twice_numerator, &denominator);
+      if (comparison > 0 || (comparison == 0 && (digit & 1U) != 0))
+      {
+        digit++;
+      }
+    }
+    else if (can_round_up)
+    {
+      digit++;
+    }
+
+    digits[length++] = digit;
+    break;
+  }
+
+  *out_length = length;
+  *out_exponent10 = k - length;
+}
+
+AZ_NODISCARD az_result az_span_dtoa_shortest(az_span destination, double source, az_span* out_span)
+{
+  _az_PRECONDITION_VALID_SPAN(destination, 0, false);
+  // Inputs that are either positive or negative infinity, or not a number, are not supported.
+  _az_PRECONDITION(_az_isfinite(source));
+  _az_PRECONDITION_NOT_NULL(out_span);
+
+  *out_span = destination;
+
+  // The input is either positive or negative infinity, or not a number.
+  if (!_az_isfinite(source))
+  {
+    return AZ_ERROR_NOT_SUPPORTED;
+  }
+
+  uint64_t bits = 0;
+  // NOLINTNEXTLINE(clang-analyzer-security.insecureAPI.DeprecatedOrUnsafeBufferHandling)
+  memcpy(&bits, &source, sizeof(bits));
+
+  bool const is_negative = (bits >> 63U) != 0;
+  uint64_t const biased_exponent = (bits >> 52U) & 0x7FFU;
+  uint64_t const fraction = bits & ((1ULL << 52U) - 1U);
+
+  // The longest output is a sign, "0.", 5 zeros, and 17 digits, e.g. -0.0000012345678901234567.
+  uint8_t buffer[_az_MAX_SIZE_FOR_WRITING_SHORTEST_DOUBLE] = { 0 };
+  uint8_t* ptr = buffer;
+  if (is_negative)
+  {
+    *ptr++ = '-';
+  }
+
+  if (biased_exponent == 0 && fraction == 0)
+  {
+    // Zero, including negative zero which is written as "-0" so that it parses back the same.
+    *ptr++ = '0';
+  }
+  else
+  {
+    // Subnormal numbers have no implicit leading bit, and the same exponent as the smallest normal
+    // numbers.
+    uint64_t const significand = biased_exponent == 0 ? fraction : fraction | (1ULL << 52U);
+    int32_t const exponent
+        = biased_exponent == 0 ? _az_DOUBLE_MIN_BINARY_EXPONENT : (int32_t)biased_exponent - 1075;
+
+    // When the significand is a power of 2, the next smaller double is half as far away as the
+    // next larger one (except for the smallest normal exponent).
+    bool const is_lower_boundary_closer = fraction == 0 && biased_exponent > 1;
+
+    uint8_t digits[_az_MAX_SHORTEST_DOUBLE_DIGITS] = { 0 };
+    int32_t length = 0;
+    int32_t exponent10 = 0;
+    if (!_az_dtoa_grisu3(
+            significand, exponent, is_lower_boundary_closer, digits, &length, &exponent10))
+    {
+      _az_dtoa_bignum(
+          significand, exponent, is_lower_boundary_closer, digits, &length, &exponent10);
+    }
+
+    // The value is 0.d1d2...dn * 10^point, i.e. the decimal point goes after the first `point`
+    // digits.
+    int32_t const point = length + exponent10;
+    if (point >= length && point <= _az_SHORTEST_DOUBLE_MAX_FIXED_POINT)
+    {
+      // An integer, e.g. 1234 or 1000.
+      for (int32_t i = 0; i < length; i++)
+      {
+        *ptr++ = _az_decimal_to_ascii(digits[i]);
+      }
+      for (int32_t i = length; i < point; i++)
+      {
+        *ptr++ = '0';
+      }
+    }
+    else if (point > 0 && point <= _az_SHORTEST_DOUBLE_MAX_FIXED_POINT)
+    {
+      // A number with both an integral and a fractional part, e.g. 12.34.
+      for (int32_t i = 0; i < length; i++)
+      {
+        if (i == point)
+        {
+          *ptr++ = '.';
+        }
+        *ptr++ = _az_decimal_to_ascii(digits[i]);
+      }
+    }
+    else if (point > _az_SHORTEST_DOUBLE_MIN_FIXED_POINT && point <= 0)
+    {
+      // A number below 1 with at most 5 leading zeros after the decimal point, e.g. 0.001234.
+      *ptr++ = '0';
+      *ptr++ = '.';
+      for (int32_t i = point; i < 0; i++)
+      {
+        *ptr++ = '0';
+      }
+      for (int32_t i = 0; i < length; i++)
+      {
+        *ptr++ = _az_decimal_to_ascii(digits[i]);
+      }
+    }
+    else
+    {
+      // Exponential notation, e.g. 1.234e-7 or 1e+21.
+      *ptr++ = _az_decimal_to_ascii(digits[0]);
+      if (length > 1)
+      {
+        *ptr++ = '.';
+        for (int32_t i = 1; i < length; i++)
+        {
+          *ptr++ = _az_decimal_to_ascii(digits[i]);
+        }
+      }
+
+      int32_t const exponent_value = point - 1;
+      *ptr++ = 'e';
+      *ptr++ = exponent_value < 0 ? '-' : '+';
+
+      // At most 3 digits, since the exponent is within [-324, 308].
+      uint32_t const magnitude = (uint32_t)(exponent_value < 0 ? -exponent_value : exponent_value);
+      if (magnitude >= 100)
+      {
+        *ptr++ = _az_decimal_to_ascii((uint8_t)(magnitude / 100));
+      }
+      if (magnitude >= 10)
+      {
+        *ptr++ = _az_decimal_to_ascii((uint8_t)((magnitude / 10) % 10));
+      }
+      *ptr++ = _az_decimal_to_ascii((uint8_t)(magnitude % 10));
+    }
+  }
+
+  int32_t const size = (int32_t)(ptr - buffer);
+  _az_RETURN_IF_NOT_ENOUGH_SIZE(destination, size);
+  *out_span = az_span_copy(destination, az_span_create(buffer, size));
+  return AZ_OK;
+}
+
 // TODO: pass az_span by value
 AZ_NODISCARD az_result _az_is_expected_span(az_span* ref_span, az_span expected)
 {
@@ -882,29 +2212,60 @@ AZ_NODISCARD az_span _az_span_trim_whitespace_from_end(az_span source)
   return _az_span_trim_side(source, RIGHT);
 }
 
-// [0-9]
-AZ_NODISCARD AZ_INLINE bool _az_span_is_byte_digit(uint8_t c) { return '0' <= c && c <= '9'; }
-
-// [A-Za-z]
-AZ_NODISCARD AZ_INLINE bool _az_span_is_byte_letter(uint8_t c)
+// Whether a byte is unreserved in a URL (RFC 3986, section 2.3), i.e. [A-Za-z0-9] or one of "-._~",
+// and therefore copied as is rather than percent-encoded.
+static uint8_t const _az_url_unreserved[256] = {
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 0x00
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 0x10
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 1, 0, // 0x20
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 0, 0, // 0x30
+  0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, // 0x40
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 0, 1, // 0x50
+  0, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, // 0x60
+  1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 1, 0, 0, 0, 1, 0, // 0x70
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 0x80
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 0x90
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 0xA0
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 0xB0
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 0xC0
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 0xD0
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 0xE0
+  0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, // 0xF0
+};
+
+// Returns the index of the first byte in [ptr + start, ptr + size) that must be percent-encoded,
+// or size if there is none.
+static AZ_NODISCARD int32_t
+_az_span_url_find_reserved(uint8_t const* ptr, int32_t start, int32_t size)
 {
-  // This is equivalent to ('A' <= c && c <= 'Z') || ('a' <= c && c <= 'z')
-  // This works because upper case and lower case letters are 0x20 away from each other.
-  return ((uint32_t)(c - 'A') & ~(uint32_t)_az_ASCII_SPACE_CHARACTER) <= 'Z' - 'A';
-}
+  int32_t i = start;
 
-AZ_NODISCARD AZ_INLINE bool _az_span_url_should_encode(uint8_t c)
-{
-  switch (c)
+#ifdef _az_SIMD_WIDTH
+  _az_simd_vector const underscore = _az_simd_broadcast('_');
+  _az_simd_vector const tilde = _az_simd_broadcast('~');
+  for (; i + _az_SIMD_WIDTH <= size; i += _az_SIMD_WIDTH)
   {
-    case '-':
-    case '_':
-    case '.':
-    case '~':
-      return false;
-    default:
-      return !(_az_span_is_byte_digit(c) || _az_span_is_byte_letter(c));
+    _az_simd_vector const bytes = _az_simd_load(ptr + i);
+    _az_simd_vector const is_alphanumeric = _az_simd_or(
+        _az_simd_in_range(_az_simd_to_lower(bytes), 'a', 'z'), _az_simd_in_range(bytes, '0', '9'));
+    _az_simd_vector const is_symbol = _az_simd_or(
+        _az_simd_in_range(bytes, '-', '.'),
+        _az_simd_or(_az_simd_eq(bytes, underscore), _az_simd_eq(bytes, tilde)));
+    _az_simd_vector const unreserved = _az_simd_or(is_alphanumeric, is_symbol);
+
+    uint64_t const mask = _az_simd_mask(unreserved);
+    if (mask != _az_SIMD_MASK_ALL)
+    {
+      return i + _az_simd_mask_first_lane(~mask & _az_SIMD_MASK_ALL);
+    }
+  }
+#endif // _az_SIMD_WIDTH
+
+  while (i < size && _az_url_unreserved[ptr[i]])
+  {
+    i++;
   }
+  return i;
 }
 
 AZ_NODISCARD int32_t _az_span_url_encode_calc_length(az_span source)
@@ -918,14 +2279,11 @@ AZ_NODISCARD int32_t _az_span_url_encode_calc_length(az_span source)
   uint8_t const* const src_ptr = az_span_ptr(source);
 
   int32_t encoded_length = source_size;
-  for (int32_t i = 0; i < source_size; i++)
+  for (int32_t i = _az_span_url_find_reserved(src_ptr, 0, source_size); i < source_size;
+       i = _az_span_url_find_reserved(src_ptr, i + 1, source_size))
   {
-    uint8_t c = src_ptr[i];
-    if (_az_span_url_should_encode(c))
-    {
-      // Adding '%' plus 2 digits (minus 1 as original symbol is counted as 1)
-      encoded_length += 2;
-    }
+    // Adding '%' plus 2 digits (minus 1 as original symbol is counted as 1)
+    encoded_length += 2;
   }
 
   // If source_size is 0, this will return 0.
@@ -945,36 +2303,43 @@ AZ_NODISCARD az_result _az_span_url_encode(az_span destination, az_span source,
   uint8_t* const dest_begin = az_span_ptr(destination);
   uint8_t* const dest_end = dest_begin + az_span_size(destination);
 
-  uint8_t* const src_ptr = az_span_ptr(source);
+  uint8_t const* const src_ptr = az_span_ptr(source);
   uint8_t* dest_ptr = dest_begin;
 
-  for (int32_t i = 0; i < source_size; i++)
+  int32_t i = 0;
+  while (i < source_size)
   {
-    uint8_t c = src_ptr[i];
-    if (!_az_span_url_should_encode(c))
+    // Copy the run of bytes that don't need encoding in bulk.
+    int32_t const run_end = _az_span_url_find_reserved(src_ptr, i, source_size);
+    int32_t const run_size = run_end - i;
+    if (dest_end - dest_ptr < run_size)
     {
-      if (dest_ptr >= dest_end)
-      {
-        *out_length = 0;
-        return AZ_ERROR_NOT_ENOUGH_SPACE;
-      }
-
-      *dest_ptr = c;
-      ++dest_ptr;
+      *out_length = 0;
+      return AZ_ERROR_NOT_ENOUGH_SPACE;
     }
-    else
+
+    // NOLINTNEXTLINE(clang-analyzer-security.insecureAPI.DeprecatedOrUnsafeBufferHandling)
+    memcpy(dest_ptr, src_ptr + i, (size_t)run_size);
+    dest_ptr += run_size;
+    i = run_end;
+
+    if (i == source_size)
     {
-      if (dest_ptr >= dest_end - 2)
-      {
-        *out_length = 0;
-        return AZ_ERROR_NOT_ENOUGH_SPACE;
-      }
+      break;
+    }
 
-      dest_ptr[0] = '%';
-      dest_ptr[1] = _az_number_to_upper_hex(c >> 4U);
-      dest_ptr[2] = _az_number_to_upper_hex(c & (uint32_t)_az_LARGEST_HEX_VALUE);
-      dest_ptr += 3;
+    if (dest_end - dest_ptr < 3)
+    {
+      *out_length = 0;
+      return AZ_ERROR_NOT_ENOUGH_SPACE;
     }
+
+    uint8_t const c = src_ptr[i];
+    dest_ptr[0] = '%';
+    dest_ptr[1] = _az_number_to_upper_hex(c >> 4U);
+    dest_ptr[2] = _az_number_to_upper_hex(c & (uint32_t)_az_LARGEST_HEX_VALUE);
+    dest_ptr += 3;
+    i++;
   }
 
   *out_length = (int32_t)(dest_ptr - dest_begin);
@@ -0,0 +1,238 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include <azure/core/az_precondition.h>
+#include <azure/core/az_span_arena.h>
+#include <azure/core/internal/az_precondition_internal.h>
+#include <azure/core/internal/az_result_internal.h>
+
+#include <stdint.h>
+
+#include <azure/core/_az_cfg.h>
+
+AZ_NODISCARD AZ_INLINE bool _az_is_power_of_2(int32_t value)
+{
+  return value > 0 && (value & (value - 1)) == 0;
+}
+
+AZ_NODISCARD az_result az_span_arena_init(
+    az_span_arena* out_arena,
+    az_span buffer,
+    az_span_arena_options const* options)
+{
+  _az_PRECONDITION_NOT_NULL(out_arena);
+  _az_PRECONDITION_VALID_SPAN(buffer, 0, true);
+  _az_PRECONDITION(options == NULL || _az_is_power_of_2(options->alignment));
+
+  *out_arena = (az_span_arena){
+    ._internal = {
+      .blocks = { buffer },
+      .block_count = 1,
+      .current_block = 0,
+      .offset = 0,
+      .bytes_used_in_previous_blocks = 0,
+      .high_water_mark = 0,
+      .open_size = 0,
+      .options = options == NULL ? az_span_arena_options_default() : *options,
+    },
+  };
+  return AZ_OK;
+}
+
+AZ_NODISCARD az_result az_span_arena_add_block(az_span_arena* ref_arena, az_span block)
+{
+  _az_PRECONDITION_NOT_NULL(ref_arena);
+  _az_PRECONDITION_VALID_SPAN(block, 0, true);
+
+  if (ref_arena->_internal.block_count >= AZ_SPAN_ARENA_MAX_BLOCKS)
+  {
+    return AZ_ERROR_NOT_ENOUGH_SPACE;
+  }
+
+  ref_arena->_internal.blocks[ref_arena->_internal.block_count] = block;
+  ref_arena->_internal.block_count++;
+  return AZ_OK;
+}
+
+// Only committed bytes count towards the high-water mark, since the span handed out by
+// az_span_arena_allocator() is the whole rest of a block, most of which is usually left unused.
+static void _az_span_arena_update_high_water_mark(az_span_arena* ref_arena)
+{
+  int32_t const bytes_used
+      = ref_arena->_internal.bytes_used_in_previous_blocks + ref_arena->_internal.offset;
+  if (bytes_used > ref_arena->_internal.high_water_mark)
+  {
+    ref_arena->_internal.high_water_mark = bytes_used;
+  }
+}
+
+// Finds the first block, starting with the current one at offset, that has size bytes left after
+// aligning, and makes it the current block. On success, out_padding receives the number of bytes
+// needed to align the start of the allocation. On failure, the arena is unchanged.
+static AZ_NODISCARD az_result _az_span_arena_find_space(
+    az_span_arena* ref_arena,
+    int32_t offset,
+    int32_t size,
+    int32_t alignment,
+    int32_t* out_padding)
+{
+  int32_t block = ref_arena->_internal.current_block;
+  int32_t bytes_used_in_previous_blocks = ref_arena->_internal.bytes_used_in_previous_blocks;
+
+  while (block < ref_arena->_internal.block_count)
+  {
+    az_span const current = ref_arena->_internal.blocks[block];
+    uintptr_t const address = (uintptr_t)(az_span_ptr(current) + offset);
+    int32_t const padding
+        = (int32_t)((uintptr_t)(0U - address) & (uintptr_t)(uint32_t)(alignment - 1));
+
+    if (padding <= az_span_size(current) - offset
+        && size <= az_span_size(current) - offset - padding)
+    {
+      ref_arena->_internal.current_block = block;
+      ref_arena->_internal.offset = offset;
+      ref_arena->_internal.bytes_used_in_previous_blocks = bytes_used_in_previous_blocks;
+      *out_padding = padding;
+      return AZ_OK;
+    }
+
+    // Skip the rest of this block, which counts as used until the arena is reset.
+    bytes_used_in_previous_blocks += az_span_size(current);
+    offset = 0;
+    block++;
+  }
+
+  return AZ_ERROR_NOT_ENOUGH_SPACE;
+}
+
+AZ_NODISCARD az_result az_span_arena_allocate_aligned(
+    az_span_arena* ref_arena,
+    int32_t size,
+    int32_t alignment,
+    az_span* out_span)
+{
+  _az_PRECONDITION_NOT_NULL(ref_arena);
+  _az_PRECONDITION(size >= 0);
+  _az_PRECONDITION(_az_is_power_of_2(alignment));
+  _az_PRECONDITION_NOT_NULL(out_span);
+
+  // Any span handed out by az_span_arena_allocator() that wasn't committed is considered fully
+  // used, but is only closed once the allocation succeeds.
+  int32_t padding = 0;
+  _az_RETURN_IF_FAILED(_az_span_arena_find_space(
+      ref_arena,
+      ref_arena->_internal.offset + ref_arena->_internal.open_size,
+      size,
+      alignment,
+      &padding));
+  ref_arena->_internal.open_size = 0;
+
+  int32_t const start = ref_arena->_internal.offset + padding;
+  *out_span = az_span_slice(
+      ref_arena->_internal.blocks[ref_arena->_internal.current_block], start, start + size);
+  ref_arena->_internal.offset = start + size;
+
+  _az_span_arena_update_high_water_mark(ref_arena);
+  return AZ_OK;
+}
+
+AZ_NODISCARD az_result
+az_span_arena_allocate(az_span_arena* ref_arena, int32_t size, az_span* out_span)
+{
+  _az_PRECONDITION_NOT_NULL(ref_arena);
+  return az_span_arena_allocate_aligned(
+      ref_arena, size, ref_arena->_internal.options.alignment, out_span);
+}
+
+void az_span_arena_commit(az_span_arena* ref_arena, int32_t bytes_used)
+{
+  _az_PRECONDITION_NOT_NULL(ref_arena);
+  _az_PRECONDITION_RANGE(0, bytes_used, ref_arena->_internal.open_size);
+
+  ref_arena->_internal.offset += bytes_used;
+  ref_arena->_internal.open_size = 0;
+  _az_span_arena_update_high_water_mark(ref_arena);
+}
+
+AZ_NODISCARD az_span_arena_mark az_span_arena_get_mark(az_span_arena const* arena)
+{
+  _az_PRECONDITION_NOT_NULL(arena);
+
+  return (az_span_arena_mark){
+    ._internal = {
+      .block = arena->_internal.current_block,
+      .offset = arena->_internal.offset + arena->_internal.open_size,
+      .bytes_used_in_previous_blocks = arena->_internal.bytes_used_in_previous_blocks,
+    },
+  };
+}
+
+void az_span_arena_reset_to_mark(az_span_arena* ref_arena, az_span_arena_mark mark)
+{
+  _az_PRECONDITION_NOT_NULL(ref_arena);
+  _az_PRECONDITION(
+      mark._internal.block < ref_arena->_internal.current_block
+      || (mark._internal.block == ref_arena->_internal.current_block
+          && mark._internal.offset
+              <= ref_arena->_internal.offset + ref_arena->_internal.open_size));
+
+  ref_arena->_internal.current_block = mark._internal.block;
+  ref_arena->_internal.offset = mark._internal.offset;
+  ref_arena->_internal.bytes_used_in_previous_blocks = mark._internal.bytes_used_in_previous_blocks;
+  ref_arena->_internal.open_size = 0;
+}
+
+void az_span_arena_reset(az_span_arena* ref_arena)
+{
+  _az_PRECONDITION_NOT_NULL(ref_arena);
+
+  ref_arena->_internal.current_block = 0;
+  ref_arena->_internal.offset = 0;
+  ref_arena->_internal.bytes_used_in_previous_blocks = 0;
+  ref_arena->_internal.open_size = 0;
+}
+
+AZ_NODISCARD int32_t az_span_arena_get_bytes_used(az_span_arena const* arena)
+{
+  _az_PRECONDITION_NOT_NULL(arena);
+
+  return arena->_internal.bytes_used_in_previous_blocks + arena->_internal.offset
+      + arena->_internal.open_size;
+}
+
+AZ_NODISCARD int32_t az_span_arena_get_high_water_mark(az_span_arena const* arena)
+{
+  _az_PRECONDITION_NOT_NULL(arena);
+
+  return arena->_internal.high_water_mark;
+}
+
+AZ_NODISCARD az_result az_span_arena_allocator(
+    az_span_allocator_context* allocator_context,
+    az_span* out_next_destination)
+{
+  _az_PRECONDITION_NOT_NULL(allocator_context);
+  _az_PRECONDITION_NOT_NULL(allocator_context->user_context);
+  _az_PRECONDITION_NOT_NULL(out_next_destination);
+
+  az_span_arena* const arena = (az_span_arena*)allocator_context->user_context;
+
+  // The previous destination only came from this arena if there is an open span; otherwise, it was
+  // the caller's first destination buffer, and its bytes aren't the arena's to account for.
+  if (arena->_internal.open_size > 0)
+  {
+    az_span_arena_commit(arena, allocator_context->bytes_used);
+  }
+
+  int32_t const minimum_size
+      = allocator_context->minimum_required_size > 0 ? allocator_context->minimum_required_size : 1;
+
+  int32_t padding = 0;
+  _az_RETURN_IF_FAILED(
+      _az_span_arena_find_space(arena, arena->_internal.offset, minimum_size, 1, &padding));
+
+  *out_next_destination = az_span_slice_to_end(
+      arena->_internal.blocks[arena->_internal.current_block], arena->_internal.offset);
+  arena->_internal.open_size = az_span_size(*out_next_destination);
+  return AZ_OK;
+}
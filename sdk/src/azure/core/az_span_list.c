@@ -0,0 +1,156 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include <azure/core/az_precondition.h>
+#include <azure/core/az_span_list.h>
+#include <azure/core/internal/az_precondition_internal.h>
+#include <azure/core/internal/az_result_internal.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include <azure/core/_az_cfg.h>
+
+AZ_NODISCARD az_result az_span_list_append(az_span_list* ref_list, az_span segment)
+{
+  _az_PRECONDITION_NOT_NULL(ref_list);
+  _az_PRECONDITION_VALID_SPAN(segment, 0, true);
+
+  if (ref_list->_internal.segment_count >= ref_list->_internal.capacity)
+  {
+    return AZ_ERROR_NOT_ENOUGH_SPACE;
+  }
+
+  ref_list->_internal.segments[ref_list->_internal.segment_count] = segment;
+  ref_list->_internal.segment_count++;
+  return AZ_OK;
+}
+
+AZ_NODISCARD int32_t az_span_list_size(az_span_list list)
+{
+  int32_t size = 0;
+  for (int32_t i = 0; i < list._internal.segment_count; i++)
+  {
+    size += az_span_size(list._internal.segments[i]);
+  }
+  return size;
+}
+
+az_span az_span_list_copy(az_span destination, az_span_list source)
+{
+  _az_PRECONDITION_VALID_SPAN(destination, az_span_list_size(source), true);
+
+  for (int32_t i = 0; i < source._internal.segment_count; i++)
+  {
+    destination = az_span_copy(destination, source._internal.segments[i]);
+  }
+  return destination;
+}
+
+// Returns whether the bytes of source, starting at offset within the given segment, begin with
+// target, following on into as many of the next segments as needed.
+static AZ_NODISCARD bool
+_az_span_list_matches_at(az_span_list source, int32_t segment, int32_t offset, az_span target)
+{
+  int32_t matched = 0;
+  while (matched < az_span_size(target))
+  {
+    if (segment >= source._internal.segment_count)
+    {
+      return false;
+    }
+
+    az_span const remaining = az_span_slice_to_end(source._internal.segments[segment], offset);
+    int32_t const target_left = az_span_size(target) - matched;
+    int32_t const size
+        = az_span_size(remaining) < target_left ? az_span_size(remaining) : target_left;
+
+    if (!az_span_is_content_equal(
+            az_span_slice(remaining, 0, size), az_span_slice(target, matched, matched + size)))
+    {
+      return false;
+    }
+
+    matched += size;
+    segment++;
+    offset = 0;
+  }
+  return true;
+}
+
+AZ_NODISCARD int32_t az_span_list_find(az_span_list source, az_span target)
+{
+  int32_t const target_size = az_span_size(target);
+  if (target_size == 0)
+  {
+    return 0;
+  }
+
+  uint8_t const first_byte = az_span_ptr(target)[0];
+  int32_t segment_start = 0;
+  for (int32_t i = 0; i < source._internal.segment_count; i++)
+  {
+    az_span const segment = source._internal.segments[i];
+    int32_t const segment_size = az_span_size(segment);
+
+    // An occurrence within the segment always starts before one that straddles into the next.
+    int32_t const found = az_span_find(segment, target);
+    if (found != -1)
+    {
+      return segment_start + found;
+    }
+
+    // Only the last target_size - 1 bytes can start an occurrence that continues in later segments.
+    uint8_t const* const segment_ptr = az_span_ptr(segment);
+    int32_t offset = segment_size > target_size - 1 ? segment_size - (target_size - 1) : 0;
+    for (; offset < segment_size; offset++)
+    {
+      if (segment_ptr[offset] == first_byte
+          && _az_span_list_matches_at(source, i, offset, target))
+      {
+        return segment_start + offset;
+      }
+    }
+
+    segment_start += segment_size;
+  }
+
+  return -1;
+}
+
+AZ_NODISCARD az_result az_span_list_slice(
+    az_span_list source,
+    int32_t start_index,
+    int32_t end_index,
+    az_span_list* ref_destination)
+{
+  _az_PRECONDITION_NOT_NULL(ref_destination);
+  _az_PRECONDITION_RANGE(0, start_index, end_index);
+  _az_PRECONDITION(end_index <= az_span_list_size(source));
+
+  int32_t const original_count = ref_destination->_internal.segment_count;
+  int32_t segment_start = 0;
+  for (int32_t i = 0; i < source._internal.segment_count && segment_start < end_index; i++)
+  {
+    az_span const segment = source._internal.segments[i];
+    int32_t const segment_size = az_span_size(segment);
+
+    int32_t const from = start_index > segment_start ? start_index - segment_start : 0;
+    int32_t const to = end_index - segment_start < segment_size ? end_index - segment_start
+                                                                : segment_size;
+    if (from < to)
+    {
+      az_result const result
+          = az_span_list_append(ref_destination, az_span_slice(segment, from, to));
+      if (az_result_failed(result))
+      {
+        ref_destination->_internal.segment_count = original_count;
+        return result;
+      }
+    }
+
+    segment_start += segment_size;
+  }
+
+  return AZ_OK;
+}
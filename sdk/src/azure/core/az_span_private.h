@@ -44,9 +44,13 @@ enum
   // 19 + sign (i.e. -9,223,372,036,854,775,808)
   _az_MAX_SIZE_FOR_INT64 = 20,
 
-  // Two digit length to create the "format" passed to sscanf.
+  // The longest number az_span_atod() accepts, which also bounds the buffer used to parse a number
+  // that straddles multiple segments.
   _az_MAX_SIZE_FOR_PARSING_DOUBLE = 99,
 
+  // -0.[0]{5}[0-9]{17}, i.e. 1+2+5+17, the longest output of az_span_dtoa_shortest().
+  _az_MAX_SIZE_FOR_WRITING_SHORTEST_DOUBLE = 25,
+
   // The number value of the ASCII space character ' '.
   _az_ASCII_SPACE_CHARACTER = 0x20,
 
@@ -7,6 +7,7 @@
 #include <azure/core/internal/az_log_internal.h>
 #include <azure/core/internal/az_precondition_internal.h>
 #include <azure/core/internal/az_result_internal.h>
+#include <azure/iot/internal/az_iot_common_internal.h>
 #include <stdio.h>
 
 /* Define the ADU agent component name.  */
@@ -92,6 +93,149 @@
     return AZ_ERROR_JSON_INVALID_STATE;                                             \
   }
 
+// The indexes of the property names in _az_iot_adu_client_property_names, which the service
+// properties and update manifest parsers find with _az_iot_adu_client_find_property_name(). The
+// names that start with the same byte are next to each other.
+enum
+{
+  _az_IOT_ADU_CLIENT_KEY_ACTION,
+  _az_IOT_ADU_CLIENT_KEY_COMPATIBILITY,
+  _az_IOT_ADU_CLIENT_KEY_CREATED_DATE_TIME,
+  _az_IOT_ADU_CLIENT_KEY_DOWNLOAD_HANDLER,
+  _az_IOT_ADU_CLIENT_KEY_FILES,
+  _az_IOT_ADU_CLIENT_KEY_FILE_NAME,
+  _az_IOT_ADU_CLIENT_KEY_FILEURLS,
+  _az_IOT_ADU_CLIENT_KEY_HANDLER,
+  _az_IOT_ADU_CLIENT_KEY_HANDLER_PROPERTIES,
+  _az_IOT_ADU_CLIENT_KEY_HASHES,
+  _az_IOT_ADU_CLIENT_KEY_ID,
+  _az_IOT_ADU_CLIENT_KEY_INSTRUCTIONS,
+  _az_IOT_ADU_CLIENT_KEY_MANIFEST_VERSION,
+  _az_IOT_ADU_CLIENT_KEY_MIME_TYPE,
+  _az_IOT_ADU_CLIENT_KEY_NAME,
+  _az_IOT_ADU_CLIENT_KEY_PROVIDER,
+  _az_IOT_ADU_CLIENT_KEY_RELATED_FILES,
+  _az_IOT_ADU_CLIENT_KEY_RETRY_TIMESTAMP,
+  _az_IOT_ADU_CLIENT_KEY_SIZE_IN_BYTES,
+  _az_IOT_ADU_CLIENT_KEY_UPDATE_ID,
+  _az_IOT_ADU_CLIENT_KEY_UPDATE_MANIFEST,
+  _az_IOT_ADU_CLIENT_KEY_UPDATE_MANIFEST_SIGNATURE,
+  _az_IOT_ADU_CLIENT_KEY_VERSION,
+  _az_IOT_ADU_CLIENT_KEY_WORKFLOW,
+  _az_IOT_ADU_CLIENT_KEY_COUNT,
+};
+
+static az_span const _az_iot_adu_client_property_names[_az_IOT_ADU_CLIENT_KEY_COUNT] = {
+  AZ_SPAN_LITERAL_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_ACTION),
+  AZ_SPAN_LITERAL_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_COMPATIBILITY),
+  AZ_SPAN_LITERAL_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_CREATED_DATE_TIME),
+  AZ_SPAN_LITERAL_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_DOWNLOAD_HANDLER),
+  AZ_SPAN_LITERAL_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_FILES),
+  AZ_SPAN_LITERAL_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_FILE_NAME),
+  AZ_SPAN_LITERAL_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_FILEURLS),
+  AZ_SPAN_LITERAL_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_HANDLER),
+  AZ_SPAN_LITERAL_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_HANDLER_PROPERTIES),
+  AZ_SPAN_LITERAL_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_HASHES),
+  AZ_SPAN_LITERAL_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_ID),
+  AZ_SPAN_LITERAL_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_INSTRUCTIONS),
+  AZ_SPAN_LITERAL_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_MANIFEST_VERSION),
+  AZ_SPAN_LITERAL_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_MIME_TYPE),
+  AZ_SPAN_LITERAL_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_NAME),
+  AZ_SPAN_LITERAL_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_PROVIDER),
+  AZ_SPAN_LITERAL_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_RELATED_FILES),
+  AZ_SPAN_LITERAL_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_RETRY_TIMESTAMP),
+  AZ_SPAN_LITERAL_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_SIZE_IN_BYTES),
+  AZ_SPAN_LITERAL_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_UPDATE_ID),
+  AZ_SPAN_LITERAL_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_UPDATE_MANIFEST),
+  AZ_SPAN_LITERAL_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_UPDATE_MANIFEST_SIGNATURE),
+  AZ_SPAN_LITERAL_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_VERSION),
+  AZ_SPAN_LITERAL_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_WORKFLOW),
+};
+
+// Finds which of _az_iot_adu_client_property_names the property name `name` is, or returns -1.
+// Its first byte narrows it down to at most three of them, unless it has escaped characters or
+// straddles several buffers, in which case it is compared with each of them.
+static int32_t _az_iot_adu_client_find_property_name(az_json_token const* name)
+{
+  int32_t first_key = 0;
+  int32_t key_count = _az_IOT_ADU_CLIENT_KEY_COUNT;
+
+  if (name->size > 0 && _az_iot_json_token_is_contiguous_unescaped(name))
+  {
+    switch (az_span_ptr(name->slice)[0])
+    {
+      case 'a':
+        first_key = _az_IOT_ADU_CLIENT_KEY_ACTION;
+        key_count = 1;
+        break;
+      case 'c':
+        first_key = _az_IOT_ADU_CLIENT_KEY_COMPATIBILITY;
+        key_count = 2;
+        break;
+      case 'd':
+        first_key = _az_IOT_ADU_CLIENT_KEY_DOWNLOAD_HANDLER;
+        key_count = 1;
+        break;
+      case 'f':
+        first_key = _az_IOT_ADU_CLIENT_KEY_FILES;
+        key_count = 3;
+        break;
+      case 'h':
+        first_key = _az_IOT_ADU_CLIENT_KEY_HANDLER;
+        key_count = 3;
+        break;
+      case 'i':
+        first_key = _az_IOT_ADU_CLIENT_KEY_ID;
+        key_count = 2;
+        break;
+      case 'm':
+        first_key = _az_IOT_ADU_CLIENT_KEY_MANIFEST_VERSION;
+        key_count = 2;
+        break;
+      case 'n':
+        first_key = _az_IOT_ADU_CLIENT_KEY_NAME;
+        key_count = 1;
+        break;
+      case 'p':
+        first_key = _az_IOT_ADU_CLIENT_KEY_PROVIDER;
+        key_count = 1;
+        break;
+      case 'r':
+        first_key = _az_IOT_ADU_CLIENT_KEY_RELATED_FILES;
+        key_count = 2;
+        break;
+      case 's':
+        first_key = _az_IOT_ADU_CLIENT_KEY_SIZE_IN_BYTES;
+        key_count = 1;
+        break;
+      case 'u':
+        first_key = _az_IOT_ADU_CLIENT_KEY_UPDATE_ID;
+        key_count = 3;
+        break;
+      case 'v':
+        first_key = _az_IOT_ADU_CLIENT_KEY_VERSION;
+        key_count = 1;
+        break;
+      case 'w':
+        first_key = _az_IOT_ADU_CLIENT_KEY_WORKFLOW;
+        key_count = 1;
+        break;
+      default:
+        return -1;
+    }
+  }
+
+  for (int32_t key = first_key; key < first_key + key_count; key++)
+  {
+    if (az_json_token_is_text_equal(name, _az_iot_adu_client_property_names[key]))
+    {
+      return key;
+    }
+  }
+
+  return -1;
+}
+
 const az_span default_compatibility_properties
     = AZ_SPAN_LITERAL_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_DEFAULT_COMPATIBILITY_PROPERTIES);
 
@@ -174,22 +318,23 @@ AZ_NODISCARD az_result az_iot_adu_client_get_agent_state_payload(
       NULL, ref_json_writer, AZ_SPAN_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_COMPONENT_NAME)));
 
   /* Fill the agent property name.  */
-  _az_RETURN_IF_FAILED(az_json_writer_append_property_name(
-      ref_json_writer, AZ_SPAN_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_AGENT)));
+  _az_RETURN_IF_FAILED(az_json_writer_append_name(
+      ref_json_writer, AZ_JSON_NAME_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_AGENT)));
   _az_RETURN_IF_FAILED(az_json_writer_append_begin_object(ref_json_writer));
 
   /* Fill the deviceProperties.  */
-  _az_RETURN_IF_FAILED(az_json_writer_append_property_name(
-      ref_json_writer, AZ_SPAN_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_DEVICEPROPERTIES)));
+  _az_RETURN_IF_FAILED(az_json_writer_append_name(
+      ref_json_writer,
+      AZ_JSON_NAME_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_DEVICEPROPERTIES)));
   _az_RETURN_IF_FAILED(az_json_writer_append_begin_object(ref_json_writer));
 
-  _az_RETURN_IF_FAILED(az_json_writer_append_property_name(
-      ref_json_writer, AZ_SPAN_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_MANUFACTURER)));
+  _az_RETURN_IF_FAILED(az_json_writer_append_name(
+      ref_json_writer, AZ_JSON_NAME_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_MANUFACTURER)));
   _az_RETURN_IF_FAILED(
       az_json_writer_append_string(ref_json_writer, device_properties->manufacturer));
 
-  _az_RETURN_IF_FAILED(az_json_writer_append_property_name(
-      ref_json_writer, AZ_SPAN_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_MODEL)));
+  _az_RETURN_IF_FAILED(az_json_writer_append_name(
+      ref_json_writer, AZ_JSON_NAME_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_MODEL)));
   _az_RETURN_IF_FAILED(az_json_writer_append_string(ref_json_writer, device_properties->model));
 
   if (device_properties->custom_properties != NULL)
@@ -205,21 +350,22 @@ AZ_NODISCARD az_result az_iot_adu_client_get_agent_state_payload(
     }
   }
 
-  _az_RETURN_IF_FAILED(az_json_writer_append_property_name(
-      ref_json_writer, AZ_SPAN_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_CONTRACT_MODEL_ID)));
+  _az_RETURN_IF_FAILED(az_json_writer_append_name(
+      ref_json_writer,
+      AZ_JSON_NAME_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_CONTRACT_MODEL_ID)));
   _az_RETURN_IF_FAILED(az_json_writer_append_string(
       ref_json_writer, AZ_SPAN_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_CONTRACT_MODEL_ID)));
 
-  _az_RETURN_IF_FAILED(az_json_writer_append_property_name(
-      ref_json_writer, AZ_SPAN_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_ADU_VERSION)));
+  _az_RETURN_IF_FAILED(az_json_writer_append_name(
+      ref_json_writer, AZ_JSON_NAME_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_ADU_VERSION)));
   _az_RETURN_IF_FAILED(
       az_json_writer_append_string(ref_json_writer, device_properties->adu_version));
 
   if (!az_span_is_content_equal(
           device_properties->delivery_optimization_agent_version, AZ_SPAN_EMPTY))
   {
-    _az_RETURN_IF_FAILED(az_json_writer_append_property_name(
-        ref_json_writer, AZ_SPAN_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_DO_VERSION)));
+    _az_RETURN_IF_FAILED(az_json_writer_append_name(
+        ref_json_writer, AZ_JSON_NAME_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_DO_VERSION)));
     _az_RETURN_IF_FAILED(az_json_writer_append_string(
         ref_json_writer, device_properties->delivery_optimization_agent_version));
   }
@@ -227,35 +373,36 @@ AZ_NODISCARD az_result az_iot_adu_client_get_agent_state_payload(
   _az_RETURN_IF_FAILED(az_json_writer_append_end_object(ref_json_writer));
 
   /* Fill the compatibility property names. */
-  _az_RETURN_IF_FAILED(az_json_writer_append_property_name(
+  _az_RETURN_IF_FAILED(az_json_writer_append_name(
       ref_json_writer,
-      AZ_SPAN_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_COMPAT_PROPERTY_NAMES)));
+      AZ_JSON_NAME_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_COMPAT_PROPERTY_NAMES)));
   _az_RETURN_IF_FAILED(az_json_writer_append_string(
       ref_json_writer, client->_internal.options.device_compatibility_properties));
 
   /* Add last installed update information */
   if (last_install_result != NULL)
   {
-    _az_RETURN_IF_FAILED(az_json_writer_append_property_name(
+    _az_RETURN_IF_FAILED(az_json_writer_append_name(
         ref_json_writer,
-        AZ_SPAN_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_LAST_INSTALL_RESULT)));
+        AZ_JSON_NAME_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_LAST_INSTALL_RESULT)));
     _az_RETURN_IF_FAILED(az_json_writer_append_begin_object(ref_json_writer));
 
-    _az_RETURN_IF_FAILED(az_json_writer_append_property_name(
-        ref_json_writer, AZ_SPAN_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_RESULT_CODE)));
+    _az_RETURN_IF_FAILED(az_json_writer_append_name(
+        ref_json_writer, AZ_JSON_NAME_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_RESULT_CODE)));
     _az_RETURN_IF_FAILED(
         az_json_writer_append_int32(ref_json_writer, last_install_result->result_code));
 
-    _az_RETURN_IF_FAILED(az_json_writer_append_property_name(
+    _az_RETURN_IF_FAILED(az_json_writer_append_name(
         ref_json_writer,
-        AZ_SPAN_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_EXTENDED_RESULT_CODE)));
+        AZ_JSON_NAME_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_EXTENDED_RESULT_CODE)));
     _az_RETURN_IF_FAILED(
         az_json_writer_append_int32(ref_json_writer, last_install_result->extended_result_code));
 
     if (!az_span_is_content_equal(last_install_result->result_details, AZ_SPAN_EMPTY))
     {
-      _az_RETURN_IF_FAILED(az_json_writer_append_property_name(
-          ref_json_writer, AZ_SPAN_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_RESULT_DETAILS)));
+      _az_RETURN_IF_FAILED(az_json_writer_append_name(
+          ref_json_writer,
+          AZ_JSON_NAME_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_RESULT_DETAILS)));
       _az_RETURN_IF_FAILED(
           az_json_writer_append_string(ref_json_writer, last_install_result->result_details));
     }
@@ -268,23 +415,24 @@ AZ_NODISCARD az_result az_iot_adu_client_get_agent_state_payload(
       _az_RETURN_IF_FAILED(az_json_writer_append_property_name(ref_json_writer, step_id));
       _az_RETURN_IF_FAILED(az_json_writer_append_begin_object(ref_json_writer));
 
-      _az_RETURN_IF_FAILED(az_json_writer_append_property_name(
-          ref_json_writer, AZ_SPAN_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_RESULT_CODE)));
+      _az_RETURN_IF_FAILED(az_json_writer_append_name(
+          ref_json_writer,
+          AZ_JSON_NAME_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_RESULT_CODE)));
       _az_RETURN_IF_FAILED(az_json_writer_append_int32(
           ref_json_writer, last_install_result->step_results[i].result_code));
 
-      _az_RETURN_IF_FAILED(az_json_writer_append_property_name(
+      _az_RETURN_IF_FAILED(az_json_writer_append_name(
           ref_json_writer,
-          AZ_SPAN_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_EXTENDED_RESULT_CODE)));
+          AZ_JSON_NAME_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_EXTENDED_RESULT_CODE)));
       _az_RETURN_IF_FAILED(az_json_writer_append_int32(
           ref_json_writer, last_install_result->step_results[i].extended_result_code));
 
       if (!az_span_is_content_equal(
               last_install_result->step_results[i].result_details, AZ_SPAN_EMPTY))
       {
-        _az_RETURN_IF_FAILED(az_json_writer_append_property_name(
+        _az_RETURN_IF_FAILED(az_json_writer_append_name(
             ref_json_writer,
-            AZ_SPAN_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_RESULT_DETAILS)));
+            AZ_JSON_NAME_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_RESULT_DETAILS)));
         _az_RETURN_IF_FAILED(az_json_writer_append_string(
             ref_json_writer, last_install_result->step_results[i].result_details));
       }
@@ -296,31 +444,31 @@ AZ_NODISCARD az_result az_iot_adu_client_get_agent_state_payload(
   }
 
   /* Fill the agent state.   */
-  _az_RETURN_IF_FAILED(az_json_writer_append_property_name(
-      ref_json_writer, AZ_SPAN_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_STATE)));
+  _az_RETURN_IF_FAILED(az_json_writer_append_name(
+      ref_json_writer, AZ_JSON_NAME_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_STATE)));
   _az_RETURN_IF_FAILED(az_json_writer_append_int32(ref_json_writer, (int32_t)agent_state));
 
   /* Fill the workflow.  */
   if (workflow != NULL && (az_span_ptr(workflow->id) != NULL && az_span_size(workflow->id) > 0))
   {
-    _az_RETURN_IF_FAILED(az_json_writer_append_property_name(
-        ref_json_writer, AZ_SPAN_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_WORKFLOW)));
+    _az_RETURN_IF_FAILED(az_json_writer_append_name(
+        ref_json_writer, AZ_JSON_NAME_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_WORKFLOW)));
     _az_RETURN_IF_FAILED(az_json_writer_append_begin_object(ref_json_writer));
 
-    _az_RETURN_IF_FAILED(az_json_writer_append_property_name(
-        ref_json_writer, AZ_SPAN_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_ACTION)));
+    _az_RETURN_IF_FAILED(az_json_writer_append_name(
+        ref_json_writer, AZ_JSON_NAME_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_ACTION)));
     _az_RETURN_IF_FAILED(az_json_writer_append_int32(ref_json_writer, (int32_t)workflow->action));
 
-    _az_RETURN_IF_FAILED(az_json_writer_append_property_name(
-        ref_json_writer, AZ_SPAN_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_ID)));
+    _az_RETURN_IF_FAILED(az_json_writer_append_name(
+        ref_json_writer, AZ_JSON_NAME_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_ID)));
     _az_RETURN_IF_FAILED(az_json_writer_append_string(ref_json_writer, workflow->id));
 
     /* Append retry timestamp in workflow if existed.  */
     if (!az_span_is_content_equal(workflow->retry_timestamp, AZ_SPAN_EMPTY))
     {
-      _az_RETURN_IF_FAILED(az_json_writer_append_property_name(
+      _az_RETURN_IF_FAILED(az_json_writer_append_name(
           ref_json_writer,
-          AZ_SPAN_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_RETRY_TIMESTAMP)));
+          AZ_JSON_NAME_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_RETRY_TIMESTAMP)));
       _az_RETURN_IF_FAILED(
           az_json_writer_append_string(ref_json_writer, workflow->retry_timestamp));
     }
@@ -328,9 +476,9 @@ AZ_NODISCARD az_result az_iot_adu_client_get_agent_state_payload(
   }
 
   /* Fill installed update id. */
-  _az_RETURN_IF_FAILED(az_json_writer_append_property_name(
+  _az_RETURN_IF_FAILED(az_json_writer_append_name(
       ref_json_writer,
-      AZ_SPAN_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_INSTALLED_UPDATE_ID)));
+      AZ_JSON_NAME_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_INSTALLED_UPDATE_ID)));
   _az_RETURN_IF_FAILED(az_json_writer_append_string(ref_json_writer, device_properties->update_id));
 
   _az_RETURN_IF_FAILED(az_json_writer_append_end_object(ref_json_writer));
@@ -369,10 +517,9 @@ AZ_NODISCARD az_result az_iot_adu_client_parse_service_properties(
   while (ref_json_reader->token.kind != AZ_JSON_TOKEN_END_OBJECT)
   {
     RETURN_IF_JSON_TOKEN_NOT_TYPE(ref_json_reader, AZ_JSON_TOKEN_PROPERTY_NAME);
+    int32_t const key = _az_iot_adu_client_find_property_name(&ref_json_reader->token);
 
-    if (az_json_token_is_text_equal(
-            &ref_json_reader->token,
-            AZ_SPAN_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_WORKFLOW)))
+    if (key == _az_IOT_ADU_CLIENT_KEY_WORKFLOW)
     {
       _az_RETURN_IF_FAILED(az_json_reader_next_token(ref_json_reader));
       RETURN_IF_JSON_TOKEN_NOT_TYPE(ref_json_reader, AZ_JSON_TOKEN_BEGIN_OBJECT);
@@ -381,26 +528,21 @@ AZ_NODISCARD az_result az_iot_adu_client_parse_service_properties(
       while (ref_json_reader->token.kind != AZ_JSON_TOKEN_END_OBJECT)
       {
         RETURN_IF_JSON_TOKEN_NOT_TYPE(ref_json_reader, AZ_JSON_TOKEN_PROPERTY_NAME);
+        int32_t const workflow_key = _az_iot_adu_client_find_property_name(&ref_json_reader->token);
 
-        if (az_json_token_is_text_equal(
-                &ref_json_reader->token,
-                AZ_SPAN_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_ACTION)))
+        if (workflow_key == _az_IOT_ADU_CLIENT_KEY_ACTION)
         {
           _az_RETURN_IF_FAILED(az_json_reader_next_token(ref_json_reader));
           _az_RETURN_IF_FAILED(az_json_token_get_int32(
               &ref_json_reader->token, (int32_t*)&update_request->workflow.action));
         }
-        else if (az_json_token_is_text_equal(
-                     &ref_json_reader->token,
-                     AZ_SPAN_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_ID)))
+        else if (workflow_key == _az_IOT_ADU_CLIENT_KEY_ID)
         {
           _az_RETURN_IF_FAILED(az_json_reader_next_token(ref_json_reader));
 
           update_request->workflow.id = ref_json_reader->token.slice;
         }
-        else if (az_json_token_is_text_equal(
-                     &ref_json_reader->token,
-                     AZ_SPAN_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_RETRY_TIMESTAMP)))
+        else if (workflow_key == _az_IOT_ADU_CLIENT_KEY_RETRY_TIMESTAMP)
         {
           _az_RETURN_IF_FAILED(az_json_reader_next_token(ref_json_reader));
           update_request->workflow.retry_timestamp = ref_json_reader->token.slice;
@@ -417,9 +559,7 @@ AZ_NODISCARD az_result az_iot_adu_client_parse_service_properties(
         _az_RETURN_IF_FAILED(az_json_reader_next_token(ref_json_reader));
       }
     }
-    else if (az_json_token_is_text_equal(
-                 &ref_json_reader->token,
-                 AZ_SPAN_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_UPDATE_MANIFEST)))
+    else if (key == _az_IOT_ADU_CLIENT_KEY_UPDATE_MANIFEST)
     {
       _az_RETURN_IF_FAILED(az_json_reader_next_token(ref_json_reader));
 
@@ -428,9 +568,7 @@ AZ_NODISCARD az_result az_iot_adu_client_parse_service_properties(
         update_request->update_manifest = ref_json_reader->token.slice;
       }
     }
-    else if (az_json_token_is_text_equal(
-                 &ref_json_reader->token,
-                 AZ_SPAN_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_UPDATE_MANIFEST_SIGNATURE)))
+    else if (key == _az_IOT_ADU_CLIENT_KEY_UPDATE_MANIFEST_SIGNATURE)
     {
       _az_RETURN_IF_FAILED(az_json_reader_next_token(ref_json_reader));
 
@@ -439,9 +577,7 @@ AZ_NODISCARD az_result az_iot_adu_client_parse_service_properties(
         update_request->update_manifest_signature = ref_json_reader->token.slice;
       }
     }
-    else if (az_json_token_is_text_equal(
-                 &ref_json_reader->token,
-                 AZ_SPAN_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_FILEURLS)))
+    else if (key == _az_IOT_ADU_CLIENT_KEY_FILEURLS)
     {
       _az_RETURN_IF_FAILED(az_json_reader_next_token(ref_json_reader));
       if (ref_json_reader->token.kind != AZ_JSON_TOKEN_NULL)
@@ -545,20 +681,17 @@ AZ_NODISCARD az_result az_iot_adu_client_parse_update_manifest(
   while (ref_json_reader->token.kind != AZ_JSON_TOKEN_END_OBJECT)
   {
     RETURN_IF_JSON_TOKEN_NOT_TYPE((ref_json_reader), AZ_JSON_TOKEN_PROPERTY_NAME);
+    int32_t const key = _az_iot_adu_client_find_property_name(&ref_json_reader->token);
 
     bool property_parsed = true;
 
-    if (az_json_token_is_text_equal(
-            &ref_json_reader->token,
-            AZ_SPAN_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_MANIFEST_VERSION)))
+    if (key == _az_IOT_ADU_CLIENT_KEY_MANIFEST_VERSION)
     {
       _az_RETURN_IF_FAILED(az_json_reader_next_token(ref_json_reader));
       RETURN_IF_JSON_TOKEN_NOT_TYPE((ref_json_reader), AZ_JSON_TOKEN_STRING);
       update_manifest->manifest_version = ref_json_reader->token.slice;
     }
-    else if (az_json_token_is_text_equal(
-                 &ref_json_reader->token,
-                 AZ_SPAN_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_INSTRUCTIONS)))
+    else if (key == _az_IOT_ADU_CLIENT_KEY_INSTRUCTIONS)
     {
       _az_RETURN_IF_FAILED(az_json_reader_next_token(ref_json_reader));
       RETURN_IF_JSON_TOKEN_NOT_TYPE((ref_json_reader), AZ_JSON_TOKEN_BEGIN_OBJECT);
@@ -585,10 +718,9 @@ AZ_NODISCARD az_result az_iot_adu_client_parse_update_manifest(
           while (ref_json_reader->token.kind != AZ_JSON_TOKEN_END_OBJECT)
           {
             RETURN_IF_JSON_TOKEN_NOT_TYPE((ref_json_reader), AZ_JSON_TOKEN_PROPERTY_NAME);
+            int32_t const step_key = _az_iot_adu_client_find_property_name(&ref_json_reader->token);
 
-            if (az_json_token_is_text_equal(
-                    &ref_json_reader->token,
-                    AZ_SPAN_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_HANDLER)))
+            if (step_key == _az_IOT_ADU_CLIENT_KEY_HANDLER)
             {
               _az_RETURN_IF_FAILED(az_json_reader_next_token(ref_json_reader));
               RETURN_IF_JSON_TOKEN_NOT_TYPE((ref_json_reader), AZ_JSON_TOKEN_STRING);
@@ -596,9 +728,7 @@ AZ_NODISCARD az_result az_iot_adu_client_parse_update_manifest(
               update_manifest->instructions.steps[step_index].handler
                   = ref_json_reader->token.slice;
             }
-            else if (az_json_token_is_text_equal(
-                         &ref_json_reader->token,
-                         AZ_SPAN_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_FILES)))
+            else if (step_key == _az_IOT_ADU_CLIENT_KEY_FILES)
             {
               _az_RETURN_IF_FAILED(az_json_reader_next_token(ref_json_reader));
               RETURN_IF_JSON_TOKEN_NOT_TYPE((ref_json_reader), AZ_JSON_TOKEN_BEGIN_ARRAY);
@@ -625,10 +755,7 @@ AZ_NODISCARD az_result az_iot_adu_client_parse_update_manifest(
                 _az_RETURN_IF_FAILED(az_json_reader_next_token(ref_json_reader));
               }
             }
-            else if (az_json_token_is_text_equal(
-                         &ref_json_reader->token,
-                         AZ_SPAN_FROM_STR(
-                             AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_HANDLER_PROPERTIES)))
+            else if (step_key == _az_IOT_ADU_CLIENT_KEY_HANDLER_PROPERTIES)
             {
               _az_RETURN_IF_FAILED(az_json_reader_next_token(ref_json_reader));
               RETURN_IF_JSON_TOKEN_NOT_TYPE((ref_json_reader), AZ_JSON_TOKEN_BEGIN_OBJECT);
@@ -676,9 +803,7 @@ AZ_NODISCARD az_result az_iot_adu_client_parse_update_manifest(
         return AZ_ERROR_JSON_INVALID_STATE;
       }
     }
-    else if (az_json_token_is_text_equal(
-                 &ref_json_reader->token,
-                 AZ_SPAN_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_UPDATE_ID)))
+    else if (key == _az_IOT_ADU_CLIENT_KEY_UPDATE_ID)
     {
       _az_RETURN_IF_FAILED(az_json_reader_next_token(ref_json_reader));
       RETURN_IF_JSON_TOKEN_NOT_TYPE((ref_json_reader), AZ_JSON_TOKEN_BEGIN_OBJECT);
@@ -687,26 +812,22 @@ AZ_NODISCARD az_result az_iot_adu_client_parse_update_manifest(
       while (ref_json_reader->token.kind != AZ_JSON_TOKEN_END_OBJECT)
       {
         RETURN_IF_JSON_TOKEN_NOT_TYPE((ref_json_reader), AZ_JSON_TOKEN_PROPERTY_NAME);
+        int32_t const update_id_key
+            = _az_iot_adu_client_find_property_name(&ref_json_reader->token);
 
-        if (az_json_token_is_text_equal(
-                &ref_json_reader->token,
-                AZ_SPAN_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_PROVIDER)))
+        if (update_id_key == _az_IOT_ADU_CLIENT_KEY_PROVIDER)
         {
           _az_RETURN_IF_FAILED(az_json_reader_next_token(ref_json_reader));
           RETURN_IF_JSON_TOKEN_NOT_TYPE((ref_json_reader), AZ_JSON_TOKEN_STRING);
           update_manifest->update_id.provider = ref_json_reader->token.slice;
         }
-        else if (az_json_token_is_text_equal(
-                     &ref_json_reader->token,
-                     AZ_SPAN_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_NAME)))
+        else if (update_id_key == _az_IOT_ADU_CLIENT_KEY_NAME)
         {
           _az_RETURN_IF_FAILED(az_json_reader_next_token(ref_json_reader));
           RETURN_IF_JSON_TOKEN_NOT_TYPE((ref_json_reader), AZ_JSON_TOKEN_STRING);
           update_manifest->update_id.name = ref_json_reader->token.slice;
         }
-        else if (az_json_token_is_text_equal(
-                     &ref_json_reader->token,
-                     AZ_SPAN_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_VERSION)))
+        else if (update_id_key == _az_IOT_ADU_CLIENT_KEY_VERSION)
         {
           _az_RETURN_IF_FAILED(az_json_reader_next_token(ref_json_reader));
           RETURN_IF_JSON_TOKEN_NOT_TYPE((ref_json_reader), AZ_JSON_TOKEN_STRING);
@@ -724,9 +845,7 @@ AZ_NODISCARD az_result az_iot_adu_client_parse_update_manifest(
         _az_RETURN_IF_FAILED(az_json_reader_next_token(ref_json_reader));
       }
     }
-    else if (az_json_token_is_text_equal(
-                 &ref_json_reader->token,
-                 AZ_SPAN_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_COMPATIBILITY)))
+    else if (key == _az_IOT_ADU_CLIENT_KEY_COMPATIBILITY)
     {
       /*
        * According to ADU design, the ADU service compatibility properties
@@ -735,9 +854,7 @@ AZ_NODISCARD az_result az_iot_adu_client_parse_update_manifest(
        */
       _az_RETURN_IF_FAILED(az_json_reader_skip_children(ref_json_reader));
     }
-    else if (az_json_token_is_text_equal(
-                 &ref_json_reader->token,
-                 AZ_SPAN_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_FILES)))
+    else if (key == _az_IOT_ADU_CLIENT_KEY_FILES)
     {
       _az_RETURN_IF_FAILED(az_json_reader_next_token(ref_json_reader));
       RETURN_IF_JSON_TOKEN_NOT_TYPE((ref_json_reader), AZ_JSON_TOKEN_BEGIN_OBJECT);
@@ -764,18 +881,15 @@ AZ_NODISCARD az_result az_iot_adu_client_parse_update_manifest(
         while (ref_json_reader->token.kind != AZ_JSON_TOKEN_END_OBJECT)
         {
           RETURN_IF_JSON_TOKEN_NOT_TYPE((ref_json_reader), AZ_JSON_TOKEN_PROPERTY_NAME);
+          int32_t const file_key = _az_iot_adu_client_find_property_name(&ref_json_reader->token);
 
-          if (az_json_token_is_text_equal(
-                  &ref_json_reader->token,
-                  AZ_SPAN_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_FILE_NAME)))
+          if (file_key == _az_IOT_ADU_CLIENT_KEY_FILE_NAME)
           {
             _az_RETURN_IF_FAILED(az_json_reader_next_token(ref_json_reader));
             RETURN_IF_JSON_TOKEN_NOT_TYPE((ref_json_reader), AZ_JSON_TOKEN_STRING);
             update_manifest->files[files_index].file_name = ref_json_reader->token.slice;
           }
-          else if (az_json_token_is_text_equal(
-                       &ref_json_reader->token,
-                       AZ_SPAN_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_SIZE_IN_BYTES)))
+          else if (file_key == _az_IOT_ADU_CLIENT_KEY_SIZE_IN_BYTES)
           {
             _az_RETURN_IF_FAILED(az_json_reader_next_token(ref_json_reader));
             RETURN_IF_JSON_TOKEN_NOT_TYPE((ref_json_reader), AZ_JSON_TOKEN_NUMBER);
@@ -783,9 +897,7 @@ AZ_NODISCARD az_result az_iot_adu_client_parse_update_manifest(
             _az_RETURN_IF_FAILED(az_json_token_get_int64(
                 &ref_json_reader->token, &update_manifest->files[files_index].size_in_bytes));
           }
-          else if (az_json_token_is_text_equal(
-                       &ref_json_reader->token,
-                       AZ_SPAN_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_HASHES)))
+          else if (file_key == _az_IOT_ADU_CLIENT_KEY_HASHES)
           {
             _az_RETURN_IF_FAILED(az_json_reader_next_token(ref_json_reader));
             RETURN_IF_JSON_TOKEN_NOT_TYPE((ref_json_reader), AZ_JSON_TOKEN_BEGIN_OBJECT);
@@ -814,21 +926,15 @@ AZ_NODISCARD az_result az_iot_adu_client_parse_update_manifest(
            * Embedded C SDK will not support delta updates at this time, so relatedFiles,
            * downloadHandler, and mimeType are not exposed or processed.
            */
-          else if (az_json_token_is_text_equal(
-                       &ref_json_reader->token,
-                       AZ_SPAN_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_RELATED_FILES)))
+          else if (file_key == _az_IOT_ADU_CLIENT_KEY_RELATED_FILES)
           {
             _az_RETURN_IF_FAILED(az_json_reader_skip_children(ref_json_reader));
           }
-          else if (az_json_token_is_text_equal(
-                       &ref_json_reader->token,
-                       AZ_SPAN_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_DOWNLOAD_HANDLER)))
+          else if (file_key == _az_IOT_ADU_CLIENT_KEY_DOWNLOAD_HANDLER)
           {
             _az_RETURN_IF_FAILED(az_json_reader_skip_children(ref_json_reader));
           }
-          else if (az_json_token_is_text_equal(
-                       &ref_json_reader->token,
-                       AZ_SPAN_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_MIME_TYPE)))
+          else if (file_key == _az_IOT_ADU_CLIENT_KEY_MIME_TYPE)
           {
             _az_RETURN_IF_FAILED(az_json_reader_next_token(ref_json_reader));
           }
@@ -845,9 +951,7 @@ AZ_NODISCARD az_result az_iot_adu_client_parse_update_manifest(
         _az_RETURN_IF_FAILED(az_json_reader_next_token(ref_json_reader));
       }
     }
-    else if (az_json_token_is_text_equal(
-                 &ref_json_reader->token,
-                 AZ_SPAN_FROM_STR(AZ_IOT_ADU_CLIENT_AGENT_PROPERTY_NAME_CREATED_DATE_TIME)))
+    else if (key == _az_IOT_ADU_CLIENT_KEY_CREATED_DATE_TIME)
     {
       _az_RETURN_IF_FAILED(az_json_reader_next_token(ref_json_reader));
       RETURN_IF_JSON_TOKEN_NOT_TYPE((ref_json_reader), AZ_JSON_TOKEN_STRING);
@@ -151,7 +151,7 @@ static az_result json_child_token_move(az_json_reader* ref_jr, az_span property_
     }
     else if (ref_jr->token.kind == AZ_JSON_TOKEN_BEGIN_OBJECT)
     {
-      if (az_result_failed(az_json_reader_skip_children(ref_jr)))
+      if (az_result_failed(az_json_reader_skip_children_fast(ref_jr)))
       {
         return AZ_ERROR_UNEXPECTED_CHAR;
       }
@@ -10,6 +10,7 @@
 #include <azure/core/internal/az_span_internal.h>
 #include <azure/iot/az_iot_common.h>
 #include <azure/iot/az_iot_provisioning_client.h>
+#include <azure/iot/internal/az_iot_common_internal.h>
 
 #include <azure/core/_az_cfg.h>
 
@@ -241,6 +242,159 @@ _az_iot_provisioning_registration_state_default()
                                                           .payload = { 0 } };
 }
 
+// Finds which of `keys` the property name `name` is, among the `key_count` of them from
+// `first_key`, or returns -1.
+static int32_t _az_iot_provisioning_find_key(
+    az_json_token const* name,
+    az_span const keys[],
+    int32_t first_key,
+    int32_t key_count)
+{
+  for (int32_t key = first_key; key < first_key + key_count; key++)
+  {
+    if (az_json_token_is_text_equal(name, keys[key]))
+    {
+      return key;
+    }
+  }
+
+  return -1;
+}
+
+// The indexes of these names in _az_iot_provisioning_registration_state_keys. The names that start
+// with the same byte are next to each other.
+enum
+{
+  _az_IOT_PROVISIONING_REGISTRATION_STATE_ASSIGNED_HUB,
+  _az_IOT_PROVISIONING_REGISTRATION_STATE_DEVICE_ID,
+  _az_IOT_PROVISIONING_REGISTRATION_STATE_ERROR_CODE,
+  _az_IOT_PROVISIONING_REGISTRATION_STATE_ERROR_MESSAGE,
+  _az_IOT_PROVISIONING_REGISTRATION_STATE_LAST_UPDATED,
+  _az_IOT_PROVISIONING_REGISTRATION_STATE_PAYLOAD,
+  _az_IOT_PROVISIONING_REGISTRATION_STATE_KEY_COUNT,
+};
+
+static az_span const
+    _az_iot_provisioning_registration_state_keys[_az_IOT_PROVISIONING_REGISTRATION_STATE_KEY_COUNT]
+    = {
+  AZ_SPAN_LITERAL_FROM_STR("assignedHub"),
+  AZ_SPAN_LITERAL_FROM_STR("deviceId"),
+  AZ_SPAN_LITERAL_FROM_STR("errorCode"),
+  AZ_SPAN_LITERAL_FROM_STR("errorMessage"),
+  AZ_SPAN_LITERAL_FROM_STR("lastUpdatedDateTimeUtc"),
+  AZ_SPAN_LITERAL_FROM_STR("payload"),
+};
+
+// Finds which of _az_iot_provisioning_registration_state_keys the property name `name` is, or
+// returns -1. Its first byte narrows it down to at most two of them, unless it has escaped
+// characters or straddles several buffers, in which case it is compared with each of them.
+static int32_t _az_iot_provisioning_find_registration_state_key(az_json_token const* name)
+{
+  int32_t first_key = 0;
+  int32_t key_count = _az_IOT_PROVISIONING_REGISTRATION_STATE_KEY_COUNT;
+
+  if (name->size > 0 && _az_iot_json_token_is_contiguous_unescaped(name))
+  {
+    switch (az_span_ptr(name->slice)[0])
+    {
+      case 'a':
+        first_key = _az_IOT_PROVISIONING_REGISTRATION_STATE_ASSIGNED_HUB;
+        key_count = 1;
+        break;
+      case 'd':
+        first_key = _az_IOT_PROVISIONING_REGISTRATION_STATE_DEVICE_ID;
+        key_count = 1;
+        break;
+      case 'e':
+        first_key = _az_IOT_PROVISIONING_REGISTRATION_STATE_ERROR_CODE;
+        key_count = 2;
+        break;
+      case 'l':
+        first_key = _az_IOT_PROVISIONING_REGISTRATION_STATE_LAST_UPDATED;
+        key_count = 1;
+        break;
+      case 'p':
+        first_key = _az_IOT_PROVISIONING_REGISTRATION_STATE_PAYLOAD;
+        key_count = 1;
+        break;
+      default:
+        return -1;
+    }
+  }
+
+  return _az_iot_provisioning_find_key(
+      name, _az_iot_provisioning_registration_state_keys, first_key, key_count);
+}
+
+// The indexes of these names in _az_iot_provisioning_response_keys. The names that start with the
+// same byte are next to each other.
+enum
+{
+  _az_IOT_PROVISIONING_RESPONSE_ERROR_CODE,
+  _az_IOT_PROVISIONING_RESPONSE_MESSAGE,
+  _az_IOT_PROVISIONING_RESPONSE_OPERATION_ID,
+  _az_IOT_PROVISIONING_RESPONSE_REGISTRATION_STATE,
+  _az_IOT_PROVISIONING_RESPONSE_STATUS,
+  _az_IOT_PROVISIONING_RESPONSE_TIMESTAMP,
+  _az_IOT_PROVISIONING_RESPONSE_TRACKING_ID,
+  _az_IOT_PROVISIONING_RESPONSE_KEY_COUNT,
+};
+
+static az_span const _az_iot_provisioning_response_keys[_az_IOT_PROVISIONING_RESPONSE_KEY_COUNT]
+    = {
+  AZ_SPAN_LITERAL_FROM_STR("errorCode"),
+  AZ_SPAN_LITERAL_FROM_STR("message"),
+  AZ_SPAN_LITERAL_FROM_STR("operationId"),
+  AZ_SPAN_LITERAL_FROM_STR("registrationState"),
+  AZ_SPAN_LITERAL_FROM_STR("status"),
+  AZ_SPAN_LITERAL_FROM_STR("timestampUtc"),
+  AZ_SPAN_LITERAL_FROM_STR("trackingId"),
+};
+
+// Finds which of _az_iot_provisioning_response_keys the property name `name` is, or returns -1, the
+// same way as _az_iot_provisioning_find_registration_state_key().
+static int32_t _az_iot_provisioning_find_response_key(az_json_token const* name)
+{
+  int32_t first_key = 0;
+  int32_t key_count = _az_IOT_PROVISIONING_RESPONSE_KEY_COUNT;
+
+  if (name->size > 0 && _az_iot_json_token_is_contiguous_unescaped(name))
+  {
+    switch (az_span_ptr(name->slice)[0])
+    {
+      case 'e':
+        first_key = _az_IOT_PROVISIONING_RESPONSE_ERROR_CODE;
+        key_count = 1;
+        break;
+      case 'm':
+        first_key = _az_IOT_PROVISIONING_RESPONSE_MESSAGE;
+        key_count = 1;
+        break;
+      case 'o':
+        first_key = _az_IOT_PROVISIONING_RESPONSE_OPERATION_ID;
+        key_count = 1;
+        break;
+      case 'r':
+        first_key = _az_IOT_PROVISIONING_RESPONSE_REGISTRATION_STATE;
+        key_count = 1;
+        break;
+      case 's':
+        first_key = _az_IOT_PROVISIONING_RESPONSE_STATUS;
+        key_count = 1;
+        break;
+      case 't':
+        first_key = _az_IOT_PROVISIONING_RESPONSE_TIMESTAMP;
+        key_count = 2;
+        break;
+      default:
+        return -1;
+    }
+  }
+
+  return _az_iot_provisioning_find_key(
+      name, _az_iot_provisioning_response_keys, first_key, key_count);
+}
+
 AZ_INLINE az_iot_status _az_iot_status_from_extended_status(uint32_t extended_status)
 {
   // NOLINTNEXTLINE(readability-magic-numbers, cppcoreguidelines-avoid-magic-numbers)
@@ -265,16 +419,11 @@ AZ_INLINE az_result _az_iot_provisioning_client_parse_payload_error_code(
     az_json_reader* jr,
     az_iot_provisioning_client_registration_state* out_state)
 {
-  if (az_json_token_is_text_equal(&jr->token, AZ_SPAN_FROM_STR("errorCode")))
-  {
-    _az_RETURN_IF_FAILED(az_json_reader_next_token(jr));
-    _az_RETURN_IF_FAILED(az_json_token_get_uint32(&jr->token, &out_state->extended_error_code));
-    out_state->error_code = _az_iot_status_from_extended_status(out_state->extended_error_code);
+  _az_RETURN_IF_FAILED(az_json_reader_next_token(jr));
+  _az_RETURN_IF_FAILED(az_json_token_get_uint32(&jr->token, &out_state->extended_error_code));
+  out_state->error_code = _az_iot_status_from_extended_status(out_state->extended_error_code);
 
-    return AZ_OK;
-  }
-
-  return AZ_ERROR_ITEM_NOT_FOUND;
+  return AZ_OK;
 }
 
 AZ_INLINE az_result
@@ -317,59 +466,64 @@ AZ_INLINE az_result _az_iot_provisioning_client_payload_registration_state_parse
   while (az_result_succeeded(az_json_reader_next_token(jr))
          && jr->token.kind != AZ_JSON_TOKEN_END_OBJECT)
   {
-    if (az_json_token_is_text_equal(&jr->token, AZ_SPAN_FROM_STR("assignedHub")))
-    {
-      _az_RETURN_IF_FAILED(az_json_reader_next_token(jr));
-      if (jr->token.kind != AZ_JSON_TOKEN_STRING)
-      {
-        return AZ_ERROR_ITEM_NOT_FOUND;
-      }
-      out_state->assigned_hub_hostname = jr->token.slice;
-      found_assigned_hub = true;
-    }
-    else if (az_json_token_is_text_equal(&jr->token, AZ_SPAN_FROM_STR("deviceId")))
-    {
-      _az_RETURN_IF_FAILED(az_json_reader_next_token(jr));
-      if (jr->token.kind != AZ_JSON_TOKEN_STRING)
-      {
-        return AZ_ERROR_ITEM_NOT_FOUND;
-      }
-      out_state->device_id = jr->token.slice;
-      found_device_id = true;
-    }
-    else if (az_json_token_is_text_equal(&jr->token, AZ_SPAN_FROM_STR("payload")))
-    {
-      _az_RETURN_IF_FAILED(az_json_reader_next_token(jr));
-      _az_RETURN_IF_FAILED(
-          _az_iot_provisioning_client_get_json_object_span(jr, &out_state->payload));
-    }
-    else if (az_json_token_is_text_equal(&jr->token, AZ_SPAN_FROM_STR("errorMessage")))
-    {
-      _az_RETURN_IF_FAILED(az_json_reader_next_token(jr));
-      if (jr->token.kind != AZ_JSON_TOKEN_STRING)
-      {
-        return AZ_ERROR_ITEM_NOT_FOUND;
-      }
-      out_state->error_message = jr->token.slice;
-    }
-    else if (az_json_token_is_text_equal(&jr->token, AZ_SPAN_FROM_STR("lastUpdatedDateTimeUtc")))
-    {
-      _az_RETURN_IF_FAILED(az_json_reader_next_token(jr));
-      if (jr->token.kind != AZ_JSON_TOKEN_STRING)
-      {
-        return AZ_ERROR_ITEM_NOT_FOUND;
-      }
-      out_state->error_timestamp = jr->token.slice;
-    }
-    else if (az_result_succeeded(
-                 _az_iot_provisioning_client_parse_payload_error_code(jr, out_state)))
-    {
-      // Do nothing
-    }
-    else
+    switch (_az_iot_provisioning_find_registration_state_key(&jr->token))
     {
-      // ignore other tokens
-      _az_RETURN_IF_FAILED(az_json_reader_skip_children(jr));
+      case _az_IOT_PROVISIONING_REGISTRATION_STATE_ASSIGNED_HUB:
+        _az_RETURN_IF_FAILED(az_json_reader_next_token(jr));
+        if (jr->token.kind != AZ_JSON_TOKEN_STRING)
+        {
+          return AZ_ERROR_ITEM_NOT_FOUND;
+        }
+        out_state->assigned_hub_hostname = jr->token.slice;
+        found_assigned_hub = true;
+        break;
+
+      case _az_IOT_PROVISIONING_REGISTRATION_STATE_DEVICE_ID:
+        _az_RETURN_IF_FAILED(az_json_reader_next_token(jr));
+        if (jr->token.kind != AZ_JSON_TOKEN_STRING)
+        {
+          return AZ_ERROR_ITEM_NOT_FOUND;
+        }
+        out_state->device_id = jr->token.slice;
+        found_device_id = true;
+        break;
+
+      case _az_IOT_PROVISIONING_REGISTRATION_STATE_PAYLOAD:
+        _az_RETURN_IF_FAILED(az_json_reader_next_token(jr));
+        _az_RETURN_IF_FAILED(
+            _az_iot_provisioning_client_get_json_object_span(jr, &out_state->payload));
+        break;
+
+      case _az_IOT_PROVISIONING_REGISTRATION_STATE_ERROR_MESSAGE:
+        _az_RETURN_IF_FAILED(az_json_reader_next_token(jr));
+        if (jr->token.kind != AZ_JSON_TOKEN_STRING)
+        {
+          return AZ_ERROR_ITEM_NOT_FOUND;
+        }
+        out_state->error_message = jr->token.slice;
+        break;
+
+      case _az_IOT_PROVISIONING_REGISTRATION_STATE_LAST_UPDATED:
+        _az_RETURN_IF_FAILED(az_json_reader_next_token(jr));
+        if (jr->token.kind != AZ_JSON_TOKEN_STRING)
+        {
+          return AZ_ERROR_ITEM_NOT_FOUND;
+        }
+        out_state->error_timestamp = jr->token.slice;
+        break;
+
+      case _az_IOT_PROVISIONING_REGISTRATION_STATE_ERROR_CODE:
+        if (az_result_failed(_az_iot_provisioning_client_parse_payload_error_code(jr, out_state)))
+        {
+          // ignore error codes that aren't numbers
+          _az_RETURN_IF_FAILED(az_json_reader_skip_children(jr));
+        }
+        break;
+
+      default:
+        // ignore other tokens
+        _az_RETURN_IF_FAILED(az_json_reader_skip_children(jr));
+        break;
     }
   }
 
@@ -439,70 +593,80 @@ AZ_INLINE az_result az_iot_provisioning_client_parse_payload(
   while (az_result_succeeded(az_json_reader_next_token(&jr))
          && jr.token.kind != AZ_JSON_TOKEN_END_OBJECT)
   {
-    if (az_json_token_is_text_equal(&jr.token, AZ_SPAN_FROM_STR("operationId")))
-    {
-      _az_RETURN_IF_FAILED(az_json_reader_next_token(&jr));
-      if (jr.token.kind != AZ_JSON_TOKEN_STRING)
-      {
-        return AZ_ERROR_ITEM_NOT_FOUND;
-      }
-      out_response->operation_id = jr.token.slice;
-      found_operation_id = true;
-    }
-    else if (az_json_token_is_text_equal(&jr.token, AZ_SPAN_FROM_STR("status")))
-    {
-      _az_RETURN_IF_FAILED(az_json_reader_next_token(&jr));
-      if (jr.token.kind != AZ_JSON_TOKEN_STRING)
-      {
-        return AZ_ERROR_ITEM_NOT_FOUND;
-      }
-      _az_RETURN_IF_FAILED(_az_iot_provisioning_client_parse_operation_status(
-          jr.token.slice, &out_response->operation_status));
-
-      found_operation_status = true;
-    }
-    else if (az_json_token_is_text_equal(&jr.token, AZ_SPAN_FROM_STR("registrationState")))
-    {
-      _az_RETURN_IF_FAILED(az_json_reader_next_token(&jr));
-      _az_RETURN_IF_FAILED(_az_iot_provisioning_client_payload_registration_state_parse(
-          &jr, &out_response->registration_state));
-    }
-    else if (az_json_token_is_text_equal(&jr.token, AZ_SPAN_FROM_STR("trackingId")))
-    {
-      _az_RETURN_IF_FAILED(az_json_reader_next_token(&jr));
-      if (jr.token.kind != AZ_JSON_TOKEN_STRING)
-      {
-        return AZ_ERROR_ITEM_NOT_FOUND;
-      }
-      out_response->registration_state.error_tracking_id = jr.token.slice;
-    }
-    else if (az_json_token_is_text_equal(&jr.token, AZ_SPAN_FROM_STR("message")))
-    {
-      _az_RETURN_IF_FAILED(az_json_reader_next_token(&jr));
-      if (jr.token.kind != AZ_JSON_TOKEN_STRING)
-      {
-        return AZ_ERROR_ITEM_NOT_FOUND;
-      }
-      out_response->registration_state.error_message = jr.token.slice;
-    }
-    else if (az_json_token_is_text_equal(&jr.token, AZ_SPAN_FROM_STR("timestampUtc")))
-    {
-      _az_RETURN_IF_FAILED(az_json_reader_next_token(&jr));
-      if (jr.token.kind != AZ_JSON_TOKEN_STRING)
-      {
-        return AZ_ERROR_ITEM_NOT_FOUND;
-      }
-      out_response->registration_state.error_timestamp = jr.token.slice;
-    }
-    else if (az_result_succeeded(_az_iot_provisioning_client_parse_payload_error_code(
-                 &jr, &out_response->registration_state)))
-    {
-      found_error = true;
-    }
-    else
+    switch (_az_iot_provisioning_find_response_key(&jr.token))
     {
-      // ignore other tokens
-      _az_RETURN_IF_FAILED(az_json_reader_skip_children(&jr));
+      case _az_IOT_PROVISIONING_RESPONSE_OPERATION_ID:
+        _az_RETURN_IF_FAILED(az_json_reader_next_token(&jr));
+        if (jr.token.kind != AZ_JSON_TOKEN_STRING)
+        {
+          return AZ_ERROR_ITEM_NOT_FOUND;
+        }
+        out_response->operation_id = jr.token.slice;
+        found_operation_id = true;
+        break;
+
+      case _az_IOT_PROVISIONING_RESPONSE_STATUS:
+        _az_RETURN_IF_FAILED(az_json_reader_next_token(&jr));
+        if (jr.token.kind != AZ_JSON_TOKEN_STRING)
+        {
+          return AZ_ERROR_ITEM_NOT_FOUND;
+        }
+        _az_RETURN_IF_FAILED(_az_iot_provisioning_client_parse_operation_status(
+            jr.token.slice, &out_response->operation_status));
+
+        found_operation_status = true;
+        break;
+
+      case _az_IOT_PROVISIONING_RESPONSE_REGISTRATION_STATE:
+        _az_RETURN_IF_FAILED(az_json_reader_next_token(&jr));
+        _az_RETURN_IF_FAILED(_az_iot_provisioning_client_payload_registration_state_parse(
+            &jr, &out_response->registration_state));
+        break;
+
+      case _az_IOT_PROVISIONING_RESPONSE_TRACKING_ID:
+        _az_RETURN_IF_FAILED(az_json_reader_next_token(&jr));
+        if (jr.token.kind != AZ_JSON_TOKEN_STRING)
+        {
+          return AZ_ERROR_ITEM_NOT_FOUND;
+        }
+        out_response->registration_state.error_tracking_id = jr.token.slice;
+        break;
+
+      case _az_IOT_PROVISIONING_RESPONSE_MESSAGE:
+        _az_RETURN_IF_FAILED(az_json_reader_next_token(&jr));
+        if (jr.token.kind != AZ_JSON_TOKEN_STRING)
+        {
+          return AZ_ERROR_ITEM_NOT_FOUND;
+        }
+        out_response->registration_state.error_message = jr.token.slice;
+        break;
+
+      case _az_IOT_PROVISIONING_RESPONSE_TIMESTAMP:
+        _az_RETURN_IF_FAILED(az_json_reader_next_token(&jr));
+        if (jr.token.kind != AZ_JSON_TOKEN_STRING)
+        {
+          return AZ_ERROR_ITEM_NOT_FOUND;
+        }
+        out_response->registration_state.error_timestamp = jr.token.slice;
+        break;
+
+      case _az_IOT_PROVISIONING_RESPONSE_ERROR_CODE:
+        if (az_result_succeeded(_az_iot_provisioning_client_parse_payload_error_code(
+                &jr, &out_response->registration_state)))
+        {
+          found_error = true;
+        }
+        else
+        {
+          // ignore error codes that aren't numbers
+          _az_RETURN_IF_FAILED(az_json_reader_skip_children(&jr));
+        }
+        break;
+
+      default:
+        // ignore other tokens
+        _az_RETURN_IF_FAILED(az_json_reader_skip_children(&jr));
+        break;
     }
   }
 
@@ -313,37 +313,15 @@ static AZ_NODISCARD az_result _az_http_client_curl_send_delete_request(CURL* ref
 }
 
 /**
- * handles POST request. It handles seting up a body for request
+ * @brief The part of a request body that hasn't been handed to libcurl yet, as read by
+ * #_az_http_client_curl_upload_read_callback.
  */
-static AZ_NODISCARD az_result
-_az_http_client_curl_send_post_request(CURL* ref_curl, az_http_request const* request)
+typedef struct
 {
-  _az_PRECONDITION_NOT_NULL(ref_curl);
-  _az_PRECONDITION_NOT_NULL(request);
-
-  // Method
-  az_span request_body = { 0 };
-  _az_RETURN_IF_FAILED(az_http_request_get_body(request, &request_body));
-  az_span body = { 0 };
-  int32_t const required_length = az_span_size(request_body) + az_span_size(AZ_SPAN_FROM_STR("\0"));
-
-  _az_RETURN_IF_FAILED(_az_span_malloc(required_length, &body));
-
-  char* b = (char*)az_span_ptr(body);
-  az_span_to_str(b, required_length, request_body);
-
-  az_result res_code
-      = _az_http_client_curl_code_to_result(curl_easy_setopt(ref_curl, CURLOPT_POSTFIELDS, b));
-  if (az_result_succeeded(res_code))
-  {
-    res_code = _az_http_client_curl_code_to_result(curl_easy_perform(ref_curl));
-  }
-
-  _az_span_free(&body);
-  _az_RETURN_IF_FAILED(res_code);
-
-  return AZ_OK;
-}
+  az_span_list body;
+  int32_t next_segment;
+  az_span remaining_in_segment;
+} _az_http_client_curl_upload_state;
 
 /**
  * @brief UPLOAD requests are done via callbacks.  The callback is passed in a buffer address which
@@ -355,7 +333,7 @@ _az_http_client_curl_send_post_request(CURL* ref_curl, az_http_request const* re
  * @param size Size of an item
  * @param nmemb Number of items to copy
  * @param userdata Source data to upload
- *                 Passed as the pointer to an az_span
+ *                 Passed as the pointer to an _az_http_client_curl_upload_state
  * @return int
  */
 static int32_t _az_http_client_curl_upload_read_callback(
@@ -365,7 +343,7 @@ static int32_t _az_http_client_curl_upload_read_callback(
     void* userdata)
 {
 
-  az_span* upload_content = (az_span*)userdata;
+  _az_http_client_curl_upload_state* upload_state = (_az_http_client_curl_upload_state*)userdata;
 
   // Calculate the size of the *dst buffer
   int32_t dst_buffer_size = (int32_t)(nmemb * size);
@@ -376,29 +354,118 @@ static int32_t _az_http_client_curl_upload_read_callback(
     return CURL_READFUNC_ABORT;
   }
 
-  int32_t userdata_length = az_span_size(*upload_content);
+  // Fill as much of the dst buffer as possible, gathering from as many segments of the body as
+  // needed. Once all of the segments are consumed, 0 is returned, which ends the upload.
+  int32_t bytes_copied = 0;
+  while (bytes_copied < dst_buffer_size)
+  {
+    if (az_span_size(upload_state->remaining_in_segment) == 0)
+    {
+      if (upload_state->next_segment >= az_span_list_get_segment_count(upload_state->body))
+      {
+        break;
+      }
+
+      upload_state->remaining_in_segment
+          = az_span_list_get_segment(upload_state->body, upload_state->next_segment);
+      upload_state->next_segment++;
+      continue;
+    }
+
+    int32_t const dst_left = dst_buffer_size - bytes_copied;
+    int32_t const segment_left = az_span_size(upload_state->remaining_in_segment);
+    int32_t const size_of_copy = (segment_left < dst_left) ? segment_left : dst_left;
+
+    // NOLINTNEXTLINE(clang-analyzer-security.insecureAPI.DeprecatedOrUnsafeBufferHandling)
+    memcpy(
+        (uint8_t*)dst + bytes_copied,
+        az_span_ptr(upload_state->remaining_in_segment),
+        (size_t)size_of_copy);
+
+    upload_state->remaining_in_segment
+        = az_span_slice_to_end(upload_state->remaining_in_segment, size_of_copy);
+    bytes_copied += size_of_copy;
+  }
+
+  return bytes_copied;
+}
+
+/**
+ * @brief Sets up libcurl to read the request body through
+ * #_az_http_client_curl_upload_read_callback, straight from the segments of the body.
+ */
+static AZ_NODISCARD az_result _az_http_client_curl_set_upload_body(
+    CURL* ref_curl,
+    _az_http_client_curl_upload_state* ref_upload_state)
+{
+  _az_RETURN_IF_CURL_FAILED(
+      curl_easy_setopt(ref_curl, CURLOPT_READFUNCTION, _az_http_client_curl_upload_read_callback));
+
+  // The read callback receives the address of the upload state
+  _az_RETURN_IF_CURL_FAILED(curl_easy_setopt(ref_curl, CURLOPT_READDATA, ref_upload_state));
+
+  return AZ_OK;
+}
 
-  // Return if nothing to copy
-  if (userdata_length < 1)
+/**
+ * @brief Gets the body of \p request as a list of segments, whether it was set as a list or as a
+ * single span, in which case \p ref_single_segment receives that span.
+ */
+static AZ_NODISCARD az_result _az_http_client_curl_get_body(
+    az_http_request const* request,
+    az_span* ref_single_segment,
+    az_span_list* out_body)
+{
+  _az_RETURN_IF_FAILED(az_http_request_get_body_span_list(request, out_body));
+  if (az_span_list_get_segment_count(*out_body) == 0)
   {
-    return CURLE_OK; // Success, all bytes copied
+    _az_RETURN_IF_FAILED(az_http_request_get_body(request, ref_single_segment));
+    *out_body = az_span_list_create(ref_single_segment, 1);
   }
+  return AZ_OK;
+}
 
-  // Calculate how many bytes can we copy from customer data (upload_content)
-  // Curl provides dst buffer with a max size of dest_buffer_size, if customer data size is less
-  // than the max, we can copy all customer data directly and have it uploaded at once.
-  // If not, we can only copy the max dst size from customer data and wait for another upload to
-  // copy a next chunk of data
-  int32_t size_of_copy = (userdata_length < dst_buffer_size) ? userdata_length : dst_buffer_size;
+/**
+ * handles POST request. It handles seting up a body for request
+ */
+static AZ_NODISCARD az_result
+_az_http_client_curl_send_post_request(CURL* ref_curl, az_http_request const* request)
+{
+  _az_PRECONDITION_NOT_NULL(ref_curl);
+  _az_PRECONDITION_NOT_NULL(request);
 
-  // NOLINTNEXTLINE(clang-analyzer-security.insecureAPI.DeprecatedOrUnsafeBufferHandling)
-  memcpy(dst, az_span_ptr(*upload_content), (size_t)size_of_copy);
+  az_span single_segment = AZ_SPAN_EMPTY;
+  az_span_list body = { 0 };
+  _az_RETURN_IF_FAILED(_az_http_client_curl_get_body(request, &single_segment, &body));
+  curl_off_t const body_size = (curl_off_t)az_span_list_size(body);
 
-  // Update the userdata span. If we already copied all content, slice will set upload_content with
-  // 0 length
-  *upload_content = az_span_slice_to_end(*upload_content, size_of_copy);
+  _az_http_client_curl_upload_state upload_state = {
+    .body = body,
+    .next_segment = 0,
+    .remaining_in_segment = AZ_SPAN_EMPTY,
+  };
 
-  return size_of_copy;
+  // Setting the size explicitly lets libcurl send the body as is, without needing it to be
+  // null-terminated.
+  _az_RETURN_IF_CURL_FAILED(curl_easy_setopt(ref_curl, CURLOPT_POSTFIELDSIZE_LARGE, body_size));
+
+  if (az_span_list_get_segment_count(body) > 1)
+  {
+    _az_RETURN_IF_CURL_FAILED(curl_easy_setopt(ref_curl, CURLOPT_POST, 1L));
+    _az_RETURN_IF_FAILED(_az_http_client_curl_set_upload_body(ref_curl, &upload_state));
+  }
+  else
+  {
+    // A contiguous body is sent from the request's buffer directly. Even an empty body must not
+    // be NULL, as that would make libcurl read it from a callback instead.
+    az_span const segment = az_span_list_get_segment(body, 0);
+    char const* const fields = body_size == 0 ? "" : (char const*)az_span_ptr(segment);
+    _az_RETURN_IF_CURL_FAILED(curl_easy_setopt(ref_curl, CURLOPT_POSTFIELDS, fields));
+  }
+
+  _az_RETURN_IF_FAILED(_az_http_client_curl_code_to_result(curl_easy_perform(ref_curl)));
+
+  return AZ_OK;
 }
 
 /**
@@ -411,20 +478,22 @@ _az_http_client_curl_send_upload_request(CURL* ref_curl, az_http_request const*
   _az_PRECONDITION_NOT_NULL(ref_curl);
   _az_PRECONDITION_NOT_NULL(request);
 
-  az_span body = { 0 };
-  _az_RETURN_IF_FAILED(az_http_request_get_body(request, &body));
+  az_span single_segment = AZ_SPAN_EMPTY;
+  az_span_list body = { 0 };
+  _az_RETURN_IF_FAILED(_az_http_client_curl_get_body(request, &single_segment, &body));
 
-  _az_RETURN_IF_CURL_FAILED(curl_easy_setopt(ref_curl, CURLOPT_UPLOAD, 1L));
-  _az_RETURN_IF_CURL_FAILED(
-      curl_easy_setopt(ref_curl, CURLOPT_READFUNCTION, _az_http_client_curl_upload_read_callback));
+  _az_http_client_curl_upload_state upload_state = {
+    .body = body,
+    .next_segment = 0,
+    .remaining_in_segment = AZ_SPAN_EMPTY,
+  };
 
-  // Setup the request to pass body into the read callback
-  // The read callback receives the address of body
-  _az_RETURN_IF_CURL_FAILED(curl_easy_setopt(ref_curl, CURLOPT_READDATA, &body));
+  _az_RETURN_IF_CURL_FAILED(curl_easy_setopt(ref_curl, CURLOPT_UPLOAD, 1L));
+  _az_RETURN_IF_FAILED(_az_http_client_curl_set_upload_body(ref_curl, &upload_state));
 
   // Set the size of the upload
   _az_RETURN_IF_CURL_FAILED(
-      curl_easy_setopt(ref_curl, CURLOPT_INFILESIZE, (curl_off_t)az_span_size(body)));
+      curl_easy_setopt(ref_curl, CURLOPT_INFILESIZE, (curl_off_t)az_span_list_size(body)));
 
   // Do the curl work
   // curl_easy_perform does not return until the CURLOPT_READFUNCTION callbacks complete.
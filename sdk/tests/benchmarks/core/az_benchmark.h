@@ -0,0 +1,71 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+/**
+ * @file
+ *
+ * @brief Minimal helpers for the core microbenchmarks.
+ *
+ * @details Each benchmark runs a function a fixed number of times and prints the average time per
+ * call. Results are only meaningful relative to each other, on the same machine and build.
+ */
+
+#ifndef _az_BENCHMARK_H
+#define _az_BENCHMARK_H
+
+#include <stdint.h>
+#include <stdio.h>
+#include <time.h>
+
+#include <azure/core/_az_cfg_prefix.h>
+
+/**
+ * @brief A function to benchmark. It should return a value derived from its work, so that the
+ * compiler can't optimize the work away.
+ */
+typedef uint64_t (*az_benchmark_fn)(void* context);
+
+/**
+ * @brief Runs \p fn \p iterations times and prints the average time per call in nanoseconds.
+ *
+ * @return The average time per call in nanoseconds.
+ */
+AZ_INLINE double
+az_benchmark_run(char const* name, az_benchmark_fn fn, void* context, int32_t iterations)
+{
+  static volatile uint64_t sink = 0;
+
+  // Warm up caches and branch predictors.
+  for (int32_t i = 0; i < iterations / 10; i++)
+  {
+    sink += fn(context);
+  }
+
+  clock_t const start = clock();
+  for (int32_t i = 0; i < iterations; i++)
+  {
+    sink += fn(context);
+  }
+  clock_t const end = clock();
+
+  double const nanoseconds
+      = ((double)(end - start) * 1e9) / ((double)CLOCKS_PER_SEC * (double)iterations);
+  printf("  %-60s %10.1f ns/op\n", name, nanoseconds);
+  return nanoseconds;
+}
+
+/**
+ * @brief Prints the ratio between a baseline and an optimized timing.
+ */
+AZ_INLINE void az_benchmark_print_speedup(double baseline_nanoseconds, double nanoseconds)
+{
+  printf("  %-60s %10.2fx\n", "speedup", nanoseconds > 0 ? baseline_nanoseconds / nanoseconds : 0);
+}
+
+// Benchmark suites, each defined in its own benchmark_az_*.c file.
+void benchmark_az_json(void);
+void benchmark_az_span(void);
+
+#include <azure/core/_az_cfg_suffix.h>
+
+#endif // _az_BENCHMARK_H
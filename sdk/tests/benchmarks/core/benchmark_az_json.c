@@ -0,0 +1,864 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "az_benchmark.h"
+#include "az_json_private.h"
+#include "az_span_private.h"
+#include <azure/core/az_json.h>
+#include <azure/core/az_json_document.h>
+#include <azure/core/az_json_keyset.h>
+#include <azure/core/az_json_pointer.h>
+#include <azure/core/az_span.h>
+#include <azure/core/internal/az_span_internal.h>
+
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include <azure/core/_az_cfg.h>
+
+enum
+{
+  _az_BENCHMARK_ITERATIONS = 100000,
+  _az_BENCHMARK_TAPE_SIZE = 128,
+};
+
+// A device twin as the service returns it, and the same document as a device config file would
+// have it, indented by two spaces per level.
+static az_span const minified_twin = AZ_SPAN_LITERAL_FROM_STR(
+    "{\"deviceId\":\"thermostat-kitchen-01\",\"etag\":\"AAAAAAAAAAc=\","
+    "\"status\":\"enabled\",\"connectionState\":\"Connected\","
+    "\"lastActivityTime\":\"2023-01-10T18:42:07.3526354Z\",\"version\":42,"
+    "\"properties\":{\"desired\":{\"targetTemperature\":21.5,\"fanSpeed\":3,"
+    "\"schedule\":[{\"day\":\"weekday\",\"start\":\"06:30\",\"end\":\"22:00\","
+    "\"temperature\":21.5},{\"day\":\"weekend\",\"start\":\"08:00\",\"end\":\"23:30\","
+    "\"temperature\":22}],\"ecoMode\":false,\"$version\":17},"
+    "\"reported\":{\"currentTemperature\":20.75,\"humidity\":41,"
+    "\"firmware\":{\"version\":\"1.4.2\",\"installedOn\":\"2022-12-01T09:15:00Z\","
+    "\"pending\":null},\"sensors\":[{\"id\":\"temp-0\",\"ok\":true,\"readings\":[20.5,20.75,"
+    "20.75,21]},{\"id\":\"humidity-0\",\"ok\":true,\"readings\":[40,41,41,42]}],"
+    "\"$version\":311}},\"tags\":{\"building\":\"43\",\"floor\":2,\"room\":\"kitchen\"}}");
+
+static az_span const pretty_printed_twin = AZ_SPAN_LITERAL_FROM_STR(
+    "{\n"
+    "  \"deviceId\": \"thermostat-kitchen-01\",\n"
+    "  \"etag\": \"AAAAAAAAAAc=\",\n"
+    "  \"status\": \"enabled\",\n"
+    "  \"connectionState\": \"Connected\",\n"
+    "  \"lastActivityTime\": \"2023-01-10T18:42:07.3526354Z\",\n"
+    "  \"version\": 42,\n"
+    "  \"properties\": {\n"
+    "    \"desired\": {\n"
+    "      \"targetTemperature\": 21.5,\n"
+    "      \"fanSpeed\": 3,\n"
+    "      \"schedule\": [\n"
+    "        {\n"
+    "          \"day\": \"weekday\",\n"
+    "          \"start\": \"06:30\",\n"
+    "          \"end\": \"22:00\",\n"
+    "          \"temperature\": 21.5\n"
+    "        },\n"
+    "        {\n"
+    "          \"day\": \"weekend\",\n"
+    "          \"start\": \"08:00\",\n"
+    "          \"end\": \"23:30\",\n"
+    "          \"temperature\": 22\n"
+    "        }\n"
+    "      ],\n"
+    "      \"ecoMode\": false,\n"
+    "      \"$version\": 17\n"
+    "    },\n"
+    "    \"reported\": {\n"
+    "      \"currentTemperature\": 20.75,\n"
+    "      \"humidity\": 41,\n"
+    "      \"firmware\": {\n"
+    "        \"version\": \"1.4.2\",\n"
+    "        \"installedOn\": \"2022-12-01T09:15:00Z\",\n"
+    "        \"pending\": null\n"
+    "      },\n"
+    "      \"sensors\": [\n"
+    "        {\n"
+    "          \"id\": \"temp-0\",\n"
+    "          \"ok\": true,\n"
+    "          \"readings\": [\n"
+    "            20.5,\n"
+    "            20.75,\n"
+    "            20.75,\n"
+    "            21\n"
+    "          ]\n"
+    "        },\n"
+    "        {\n"
+    "          \"id\": \"humidity-0\",\n"
+    "          \"ok\": true,\n"
+    "          \"readings\": [\n"
+    "            40,\n"
+    "            41,\n"
+    "            41,\n"
+    "            42\n"
+    "          ]\n"
+    "        }\n"
+    "      ],\n"
+    "      \"$version\": 311\n"
+    "    }\n"
+    "  },\n"
+    "  \"tags\": {\n"
+    "    \"building\": \"43\",\n"
+    "    \"floor\": 2,\n"
+    "    \"room\": \"kitchen\"\n"
+    "  }\n"
+    "}\n");
+
+static uint64_t _read_json(void* context)
+{
+  az_json_reader reader = { 0 };
+  if (az_json_reader_init(&reader, *(az_span const*)context, NULL) != AZ_OK)
+  {
+    return 0;
+  }
+
+  uint64_t token_bytes = 0;
+  while (az_result_succeeded(az_json_reader_next_token(&reader)))
+  {
+    token_bytes += (uint64_t)reader.token.size;
+  }
+  return token_bytes;
+}
+
+// Skips every run of whitespace in the pretty-printed document the way the reader used to, one
+// byte at a time, as a baseline.
+static uint64_t _skip_whitespace_bytewise(void* context)
+{
+  (void)context;
+  az_span remaining = pretty_printed_twin;
+  uint64_t skipped = 0;
+  while (az_span_size(remaining) > 0)
+  {
+    az_span const trimmed = _az_span_trim_whitespace_from_start(remaining);
+    skipped += (uint64_t)_az_span_diff(trimmed, remaining);
+    remaining = az_span_size(trimmed) > 0 ? az_span_slice_to_end(trimmed, 1) : trimmed;
+  }
+  return skipped;
+}
+
+static uint64_t _skip_whitespace(void* context)
+{
+  (void)context;
+  uint8_t const* const ptr = az_span_ptr(pretty_printed_twin);
+  int32_t const size = az_span_size(pretty_printed_twin);
+  uint64_t skipped = 0;
+  int32_t i = 0;
+  while (i < size)
+  {
+    int32_t const whitespace = _az_json_count_whitespace(ptr + i, size - i);
+    skipped += (uint64_t)whitespace;
+    i += whitespace + 1;
+  }
+  return skipped;
+}
+
+// Epoch times in milliseconds, sequence numbers and byte counts, as telemetry messages have them.
+static int64_t const telemetry_integers[] = {
+  1673376127352LL, 1673376127353LL, 4294967296LL, 17LL, 987654321012LL, -42LL, 1073741824LL, 0LL,
+};
+
+static uint64_t _write_integers(bool as_int64)
+{
+  uint8_t buffer[256];
+  az_json_writer writer = { 0 };
+  if (az_json_writer_init(&writer, AZ_SPAN_FROM_BUFFER(buffer), NULL) != AZ_OK
+      || az_json_writer_append_begin_array(&writer) != AZ_OK)
+  {
+    return 0;
+  }
+
+  for (size_t i = 0; i < _az_COUNTOF(telemetry_integers); i++)
+  {
+    az_result const result = as_int64
+        ? az_json_writer_append_int64(&writer, telemetry_integers[i])
+        : az_json_writer_append_double(&writer, (double)telemetry_integers[i], 0);
+    if (result != AZ_OK)
+    {
+      return 0;
+    }
+  }
+  return (uint64_t)az_span_size(az_json_writer_get_bytes_used_in_destination(&writer));
+}
+
+static uint64_t _write_integers_as_doubles(void* context)
+{
+  (void)context;
+  return _write_integers(false);
+}
+
+static uint64_t _write_integers_as_int64(void* context)
+{
+  (void)context;
+  return _write_integers(true);
+}
+
+// The string properties of a telemetry message and of a reported property update, one of which
+// needs escaping.
+static az_span const telemetry_strings[][2] = {
+  { AZ_SPAN_LITERAL_FROM_STR("deviceId"), AZ_SPAN_LITERAL_FROM_STR("thermostat-kitchen-01") },
+  { AZ_SPAN_LITERAL_FROM_STR("timestamp"),
+    AZ_SPAN_LITERAL_FROM_STR("2023-01-10T18:42:07.3526354Z") },
+  { AZ_SPAN_LITERAL_FROM_STR("firmwareVersion"),
+    AZ_SPAN_LITERAL_FROM_STR("1.4.2-rc.3+build.5117") },
+  { AZ_SPAN_LITERAL_FROM_STR("status"),
+    AZ_SPAN_LITERAL_FROM_STR("Temperature sensor recalibrated after the scheduled maintenance "
+                             "window; readings are back within the expected tolerance.") },
+  { AZ_SPAN_LITERAL_FROM_STR("payload"),
+    AZ_SPAN_LITERAL_FROM_STR("eyJ0ZW1wZXJhdHVyZSI6MjAuNzUsImh1bWlkaXR5Ijo0MSwiYmF0dGVyeSI6"
+                             "OTcsInNpZ25hbCI6LTY3LCJ1cHRpbWUiOjM2MDAwMDB9eyJ0ZW1wZXJhdHVy"
+                             "ZSI6MjAuNzUsImh1") },
+  { AZ_SPAN_LITERAL_FROM_STR("logPath"),
+    AZ_SPAN_LITERAL_FROM_STR("C:\\ProgramData\\thermostat\\logs\\agent.log") },
+};
+
+// The size of the text of the strings, to report throughput.
+static int32_t _telemetry_strings_size(void)
+{
+  int32_t size = 0;
+  for (size_t i = 0; i < _az_COUNTOF(telemetry_strings); i++)
+  {
+    size += az_span_size(telemetry_strings[i][0]) + az_span_size(telemetry_strings[i][1]);
+  }
+  return size;
+}
+
+static uint64_t _write_strings_to(bool measure_only)
+{
+  uint8_t buffer[1024];
+  az_json_writer writer = { 0 };
+  az_result const result = measure_only
+      ? az_json_writer_measure_init(&writer, az_span_create(buffer, 64), NULL)
+      : az_json_writer_init(&writer, AZ_SPAN_FROM_BUFFER(buffer), NULL);
+  if (result != AZ_OK || az_json_writer_append_begin_object(&writer) != AZ_OK)
+  {
+    return 0;
+  }
+
+  for (size_t i = 0; i < _az_COUNTOF(telemetry_strings); i++)
+  {
+    if (az_json_writer_append_property_name(&writer, telemetry_strings[i][0]) != AZ_OK
+        || az_json_writer_append_string(&writer, telemetry_strings[i][1]) != AZ_OK)
+    {
+      return 0;
+    }
+  }
+  return (uint64_t)writer.total_bytes_written;
+}
+
+static uint64_t _write_strings(void* context)
+{
+  (void)context;
+  return _write_strings_to(false);
+}
+
+static uint64_t _measure_strings(void* context)
+{
+  (void)context;
+  return _write_strings_to(true);
+}
+
+// The property names of the device properties the ADU agent reports, as spans and pre-escaped.
+static az_span const reported_names[] = {
+  AZ_SPAN_LITERAL_FROM_STR("manufacturer"), AZ_SPAN_LITERAL_FROM_STR("model"),
+  AZ_SPAN_LITERAL_FROM_STR("contractModelId"), AZ_SPAN_LITERAL_FROM_STR("aduVer"),
+  AZ_SPAN_LITERAL_FROM_STR("doVersion"), AZ_SPAN_LITERAL_FROM_STR("compatPropertyNames"),
+  AZ_SPAN_LITERAL_FROM_STR("installedUpdateId"), AZ_SPAN_LITERAL_FROM_STR("state"),
+};
+
+static az_json_name const reported_json_names[] = {
+  AZ_JSON_NAME_LITERAL("manufacturer"), AZ_JSON_NAME_LITERAL("model"),
+  AZ_JSON_NAME_LITERAL("contractModelId"), AZ_JSON_NAME_LITERAL("aduVer"),
+  AZ_JSON_NAME_LITERAL("doVersion"), AZ_JSON_NAME_LITERAL("compatPropertyNames"),
+  AZ_JSON_NAME_LITERAL("installedUpdateId"), AZ_JSON_NAME_LITERAL("state"),
+};
+
+static uint64_t _write_names(bool pre_escaped)
+{
+  uint8_t buffer[512];
+  az_json_writer writer = { 0 };
+  if (az_json_writer_init(&writer, AZ_SPAN_FROM_BUFFER(buffer), NULL) != AZ_OK
+      || az_json_writer_append_begin_object(&writer) != AZ_OK)
+  {
+    return 0;
+  }
+
+  for (size_t i = 0; i < _az_COUNTOF(reported_names); i++)
+  {
+    az_result const result = pre_escaped
+        ? az_json_writer_append_name(&writer, reported_json_names[i])
+        : az_json_writer_append_property_name(&writer, reported_names[i]);
+    if (result != AZ_OK || az_json_writer_append_int32(&writer, (int32_t)i) != AZ_OK)
+    {
+      return 0;
+    }
+  }
+  return (uint64_t)az_span_size(az_json_writer_get_bytes_used_in_destination(&writer));
+}
+
+static uint64_t _write_property_names(void* context)
+{
+  (void)context;
+  return _write_names(false);
+}
+
+static uint64_t _write_pre_escaped_names(void* context)
+{
+  (void)context;
+  return _write_names(true);
+}
+
+// Embeds the minified twin, as a cached sub-document, in a reported property update.
+static uint64_t _write_fragment(bool trusted)
+{
+  uint8_t buffer[2048];
+  az_json_writer writer = { 0 };
+  if (az_json_writer_init(&writer, AZ_SPAN_FROM_BUFFER(buffer), NULL) != AZ_OK
+      || az_json_writer_append_begin_object(&writer) != AZ_OK
+      || az_json_writer_append_property_name(&writer, AZ_SPAN_FROM_STR("cached")) != AZ_OK)
+  {
+    return 0;
+  }
+
+  az_result const result = trusted
+      ? az_json_writer_append_json_text_trusted(&writer, minified_twin)
+      : az_json_writer_append_json_text(&writer, minified_twin);
+  if (result != AZ_OK || az_json_writer_append_end_object(&writer) != AZ_OK)
+  {
+    return 0;
+  }
+  return (uint64_t)az_span_size(az_json_writer_get_bytes_used_in_destination(&writer));
+}
+
+static uint64_t _write_validated_fragment(void* context)
+{
+  (void)context;
+  return _write_fragment(false);
+}
+
+static uint64_t _write_trusted_fragment(void* context)
+{
+  (void)context;
+  return _write_fragment(true);
+}
+
+// Skips over the whole pretty-printed twin, as if it was a subtree the application ignores.
+static uint64_t _skip_twin(bool fast)
+{
+  az_json_reader reader = { 0 };
+  if (az_json_reader_init(&reader, pretty_printed_twin, NULL) != AZ_OK
+      || az_json_reader_next_token(&reader) != AZ_OK
+      || (fast ? az_json_reader_skip_children_fast(&reader)
+               : az_json_reader_skip_children(&reader))
+          != AZ_OK)
+  {
+    return 0;
+  }
+  return (uint64_t)reader.token.kind;
+}
+
+static uint64_t _skip_children(void* context)
+{
+  (void)context;
+  return _skip_twin(false);
+}
+
+static uint64_t _skip_children_fast(void* context)
+{
+  (void)context;
+  return _skip_twin(true);
+}
+
+// The properties an application typically looks up in a twin, in the order it looks them up. Paths
+// with fewer than 3 names end with empty spans.
+static az_span const twin_paths[][3] = {
+  { AZ_SPAN_LITERAL_FROM_STR("properties"),
+    AZ_SPAN_LITERAL_FROM_STR("desired"),
+    AZ_SPAN_LITERAL_FROM_STR("$version") },
+  { AZ_SPAN_LITERAL_FROM_STR("properties"),
+    AZ_SPAN_LITERAL_FROM_STR("reported"),
+    AZ_SPAN_LITERAL_FROM_STR("$version") },
+  { AZ_SPAN_LITERAL_FROM_STR("tags"), AZ_SPAN_LITERAL_FROM_STR("room") },
+  { AZ_SPAN_LITERAL_FROM_STR("etag") },
+};
+
+// Finds the value at path by reading the twin from the start, skipping over the objects and
+// arrays that aren't on the path, as applications do with a forward-only reader.
+static int32_t _find_with_reader(az_span const path[3])
+{
+  az_json_reader reader = { 0 };
+  if (az_json_reader_init(&reader, minified_twin, NULL) != AZ_OK
+      || az_json_reader_next_token(&reader) != AZ_OK)
+  {
+    return 0;
+  }
+
+  int32_t level = 0;
+  while (az_json_reader_next_token(&reader) == AZ_OK
+         && reader.token.kind == AZ_JSON_TOKEN_PROPERTY_NAME)
+  {
+    if (!az_json_token_is_text_equal(&reader.token, path[level]))
+    {
+      if (az_json_reader_skip_children(&reader) != AZ_OK)
+      {
+        return 0;
+      }
+      continue;
+    }
+
+    if (az_json_reader_next_token(&reader) != AZ_OK)
+    {
+      return 0;
+    }
+
+    level++;
+    if (level == 3 || az_span_size(path[level]) == 0)
+    {
+      return reader.token.size;
+    }
+  }
+  return 0;
+}
+
+static uint64_t _find_properties_with_reader(void* context)
+{
+  (void)context;
+  uint64_t found = 0;
+  for (size_t i = 0; i < _az_COUNTOF(twin_paths); i++)
+  {
+    found += (uint64_t)_find_with_reader(twin_paths[i]);
+  }
+  return found;
+}
+
+static uint64_t _find_properties_with_document(void* context)
+{
+  (void)context;
+  az_json_tape_entry tape[_az_BENCHMARK_TAPE_SIZE];
+  az_json_document document = { 0 };
+  if (az_json_document_parse(&document, minified_twin, tape, _az_BENCHMARK_TAPE_SIZE, NULL)
+      != AZ_OK)
+  {
+    return 0;
+  }
+
+  uint64_t found = 0;
+  for (size_t i = 0; i < _az_COUNTOF(twin_paths); i++)
+  {
+    int32_t index = 0;
+    for (int32_t level = 0; level < 3 && az_span_size(twin_paths[i][level]) > 0; level++)
+    {
+      if (az_json_document_find_property(&document, index, twin_paths[i][level], &index) != AZ_OK)
+      {
+        return 0;
+      }
+    }
+    found += (uint64_t)az_json_document_get_token(&document, index).size;
+  }
+  return found;
+}
+
+// The same paths as twin_paths, as JSON pointers.
+static az_span const twin_pointers[] = {
+  AZ_SPAN_LITERAL_FROM_STR("/properties/desired/$version"),
+  AZ_SPAN_LITERAL_FROM_STR("/properties/reported/$version"),
+  AZ_SPAN_LITERAL_FROM_STR("/tags/room"),
+  AZ_SPAN_LITERAL_FROM_STR("/etag"),
+};
+
+static uint64_t _find_properties_with_pointers(void* context)
+{
+  az_json_pointer const* const pointers = (az_json_pointer const*)context;
+  uint64_t found = 0;
+  for (size_t i = 0; i < _az_COUNTOF(twin_pointers); i++)
+  {
+    az_json_reader reader = { 0 };
+    az_json_token token = { 0 };
+    if (az_json_reader_init(&reader, minified_twin, NULL) != AZ_OK
+        || az_json_pointer_find(&pointers[i], &reader, &token) != AZ_OK)
+    {
+      return 0;
+    }
+    found += (uint64_t)token.size;
+  }
+  return found;
+}
+
+// A flattened update manifest, with more fields than a handler typically cares about.
+static az_span const manifest = AZ_SPAN_LITERAL_FROM_STR(
+    "{\"manifestVersion\":\"5\",\"provider\":\"Contoso\",\"name\":\"Thermostat\","
+    "\"version\":\"1.2.3\",\"isDeployable\":true,\"createdDateTime\":\"2022-06-01T00:00:00Z\","
+    "\"deviceManufacturer\":\"Contoso\",\"deviceModel\":\"T-100\","
+    "\"handler\":\"microsoft/script:1\","
+    "\"handlerProperties\":{\"scriptFileName\":\"install.sh\",\"arguments\":\"--restart\"},"
+    "\"fileName\":\"firmware.bin\",\"sizeInBytes\":4194304,\"hashes\":{\"sha256\":"
+    "\"Ve2wT7ZYf1Yw2Pa6Uy4tZ9Qd5a6Jm0f4S3Jb8u2KZrA=\"},\"relatedFiles\":[],"
+    "\"downloadHandler\":{\"id\":\"microsoft/delta:1\"},\"steps\":[{\"type\":\"inline\","
+    "\"handler\":\"microsoft/swupdate:1\",\"files\":[\"f1\"]}],\"compatibility\":["
+    "{\"manufacturer\":\"Contoso\",\"model\":\"T-100\"}],\"description\":\"Monthly update\","
+    "\"releaseNotes\":\"https://contoso.com/notes\",\"workflowId\":\"7a6f2c\","
+    "\"retryTimestamp\":\"2022-06-02T00:00:00Z\",\"action\":3,\"rolloutPolicy\":\"all\","
+    "\"timeoutInMinutes\":60,\"restartRequired\":false,\"installedCriteria\":\"1.2.3\"}");
+
+// The fields a handler looks at.
+static az_span const manifest_keys[] = {
+  AZ_SPAN_LITERAL_FROM_STR("manifestVersion"), AZ_SPAN_LITERAL_FROM_STR("provider"),
+  AZ_SPAN_LITERAL_FROM_STR("name"), AZ_SPAN_LITERAL_FROM_STR("version"),
+  AZ_SPAN_LITERAL_FROM_STR("createdDateTime"), AZ_SPAN_LITERAL_FROM_STR("handler"),
+  AZ_SPAN_LITERAL_FROM_STR("fileName"), AZ_SPAN_LITERAL_FROM_STR("sizeInBytes"),
+  AZ_SPAN_LITERAL_FROM_STR("hashes"), AZ_SPAN_LITERAL_FROM_STR("steps"),
+  AZ_SPAN_LITERAL_FROM_STR("compatibility"), AZ_SPAN_LITERAL_FROM_STR("workflowId"),
+  AZ_SPAN_LITERAL_FROM_STR("retryTimestamp"), AZ_SPAN_LITERAL_FROM_STR("action"),
+  AZ_SPAN_LITERAL_FROM_STR("timeoutInMinutes"), AZ_SPAN_LITERAL_FROM_STR("installedCriteria"),
+};
+
+// Reads the manifest comparing each property name with each of the fields in turn, as the
+// handlers' chains of az_json_token_is_text_equal() calls do.
+static uint64_t _extract_with_comparisons(void* context)
+{
+  (void)context;
+  az_json_token values[_az_COUNTOF(manifest_keys)];
+  az_json_reader reader = { 0 };
+  if (az_json_reader_init(&reader, manifest, NULL) != AZ_OK
+      || az_json_reader_next_token(&reader) != AZ_OK)
+  {
+    return 0;
+  }
+
+  uint64_t found = 0;
+  while (az_json_reader_next_token(&reader) == AZ_OK
+         && reader.token.kind == AZ_JSON_TOKEN_PROPERTY_NAME)
+  {
+    size_t key_index = 0;
+    while (key_index < _az_COUNTOF(manifest_keys)
+           && !az_json_token_is_text_equal(&reader.token, manifest_keys[key_index]))
+    {
+      key_index++;
+    }
+
+    if (az_json_reader_next_token(&reader) != AZ_OK)
+    {
+      return 0;
+    }
+
+    if (key_index < _az_COUNTOF(manifest_keys))
+    {
+      values[key_index] = reader.token;
+      found += (uint64_t)values[key_index].size;
+    }
+
+    if (az_json_reader_skip_children(&reader) != AZ_OK)
+    {
+      return 0;
+    }
+  }
+  return found;
+}
+
+static uint64_t _extract_with_keyset(void* context)
+{
+  az_json_keyset const* const keyset = (az_json_keyset const*)context;
+  az_json_token values[_az_COUNTOF(manifest_keys)];
+  az_json_reader reader = { 0 };
+  if (az_json_reader_init(&reader, manifest, NULL) != AZ_OK
+      || az_json_keyset_extract(keyset, &reader, values) != AZ_OK)
+  {
+    return 0;
+  }
+
+  uint64_t found = 0;
+  for (size_t i = 0; i < _az_COUNTOF(manifest_keys); i++)
+  {
+    found += (uint64_t)values[i].size;
+  }
+  return found;
+}
+
+// The update manifest as the service sends it, escaped within a JSON string, and where it is
+// unescaped to.
+static uint8_t escaped_manifest_buffer[8192];
+
+// Release notes, as they would be within the manifest, with few escape sequences.
+static az_span const release_notes = AZ_SPAN_LITERAL_FROM_STR(
+    "Thermostat firmware 1.2.3\\n\\n"
+    "Fixes an issue where the thermostat would not reconnect to the hub after a power failure, "
+    "until it was restarted manually from the device menu.\\n"
+    "Fixes the humidity sensor readings being reported twice when the reporting interval was set "
+    "to less than a minute, which doubled the telemetry sent by the device.\\n"
+    "Improves the accuracy of the temperature readings when the fan runs at its highest speed, by "
+    "sampling the sensor between two fan cycles rather than at a fixed interval.\\n"
+    "Reduces the time the device takes to apply a new schedule, from up to a minute to a few "
+    "seconds, and reports the schedule it applied in its properties.\\n"
+    "The eco mode now lowers the target temperature by two degrees rather than one, as described "
+    "in the \\\"Saving energy\\\" section of the user manual.\\n");
+static uint8_t unescaped_manifest_buffer[1024];
+
+// Unescapes the manifest one byte at a time, as az_json_string_unescape() did.
+static uint64_t _unescape_byte_by_byte(void* context)
+{
+  az_span const escaped = *(az_span const*)context;
+  uint8_t const* const source = az_span_ptr(escaped);
+  int32_t const size = az_span_size(escaped);
+  int32_t written = 0;
+  for (int32_t i = 0; i < size; i++)
+  {
+    uint8_t current_char = source[i];
+    if (current_char == '\\' && i < size - 1)
+    {
+      if (!_az_is_valid_escaped_character(source[i + 1]))
+      {
+        break;
+      }
+      current_char = _az_json_unescape_single_byte(source[++i]);
+    }
+    else if (current_char == '\\')
+    {
+      break;
+    }
+    unescaped_manifest_buffer[written++] = current_char;
+  }
+  return (uint64_t)written;
+}
+
+static uint64_t _unescape_in_bulk(void* context)
+{
+  az_span const escaped = *(az_span const*)context;
+  return (uint64_t)az_span_size(
+      az_json_string_unescape(escaped, AZ_SPAN_FROM_BUFFER(unescaped_manifest_buffer)));
+}
+
+// Telemetry of a device that reports its counters as integers, with timestamps in milliseconds.
+static az_span const counters = AZ_SPAN_LITERAL_FROM_STR(
+    "[[1673376127352,4096,0,17,-3,65536,1048576,2147483647],"
+    "[1673376128352,4111,1,17,-4,65537,1048571,2147483646],"
+    "[1673376129352,4125,0,18,-2,65539,1048569,2147483641],"
+    "[1673376130352,4139,2,18,-1,65540,1048560,2147483633]]");
+
+// Reads the counters and parses the text of each one again, as az_json_token_get_int64() did.
+static uint64_t _sum_counters_parsed(void* context)
+{
+  az_json_reader reader = { 0 };
+  if (az_json_reader_init(&reader, *(az_span const*)context, NULL) != AZ_OK)
+  {
+    return 0;
+  }
+
+  uint64_t sum = 0;
+  while (az_json_reader_next_token(&reader) == AZ_OK)
+  {
+    int64_t value = 0;
+    if (reader.token.kind == AZ_JSON_TOKEN_NUMBER
+        && az_span_atoi64(reader.token.slice, &value) == AZ_OK)
+    {
+      sum += (uint64_t)value;
+    }
+  }
+  return sum;
+}
+
+static uint64_t _sum_counters(void* context)
+{
+  az_json_reader reader = { 0 };
+  if (az_json_reader_init(&reader, *(az_span const*)context, NULL) != AZ_OK)
+  {
+    return 0;
+  }
+
+  uint64_t sum = 0;
+  while (az_json_reader_next_token(&reader) == AZ_OK)
+  {
+    int64_t value = 0;
+    if (reader.token.kind == AZ_JSON_TOKEN_NUMBER
+        && az_json_token_get_int64(&reader.token, &value) == AZ_OK)
+    {
+      sum += (uint64_t)value;
+    }
+  }
+  return sum;
+}
+
+void benchmark_az_json(void)
+{
+  printf(
+      "az_json_reader_next_token (%d byte minified and %d byte pretty-printed twins)\n",
+      (int)az_span_size(minified_twin),
+      (int)az_span_size(pretty_printed_twin));
+  double const minified = az_benchmark_run(
+      "minified", _read_json, (void*)(uintptr_t)&minified_twin, _az_BENCHMARK_ITERATIONS);
+  double const pretty_printed = az_benchmark_run(
+      "pretty-printed",
+      _read_json,
+      (void*)(uintptr_t)&pretty_printed_twin,
+      _az_BENCHMARK_ITERATIONS);
+  printf(
+      "  %-60s %10.2fx\n",
+      "pretty-printed / minified",
+      minified > 0 ? pretty_printed / minified : 0);
+
+  printf(
+      "whitespace skipping (%d byte pretty-printed twin)\n",
+      (int)az_span_size(pretty_printed_twin));
+  double const skip_baseline = az_benchmark_run(
+      "_az_span_trim_whitespace_from_start",
+      _skip_whitespace_bytewise,
+      NULL,
+      _az_BENCHMARK_ITERATIONS * 10);
+  double const skip_optimized = az_benchmark_run(
+      "_az_json_count_whitespace", _skip_whitespace, NULL, _az_BENCHMARK_ITERATIONS * 10);
+  az_benchmark_print_speedup(skip_baseline, skip_optimized);
+
+  printf(
+      "subtree skipping (%d byte pretty-printed twin)\n", (int)az_span_size(pretty_printed_twin));
+  double const skip_children_baseline = az_benchmark_run(
+      "az_json_reader_skip_children", _skip_children, NULL, _az_BENCHMARK_ITERATIONS);
+  double const skip_children_optimized = az_benchmark_run(
+      "az_json_reader_skip_children_fast", _skip_children_fast, NULL, _az_BENCHMARK_ITERATIONS);
+  az_benchmark_print_speedup(skip_children_baseline, skip_children_optimized);
+
+  printf("property lookups (%d paths in the minified twin)\n", (int)_az_COUNTOF(twin_paths));
+  double const lookup_baseline = az_benchmark_run(
+      "az_json_reader, from the start for each path",
+      _find_properties_with_reader,
+      NULL,
+      _az_BENCHMARK_ITERATIONS);
+  double const lookup_optimized = az_benchmark_run(
+      "az_json_document, parsed once",
+      _find_properties_with_document,
+      NULL,
+      _az_BENCHMARK_ITERATIONS);
+  az_benchmark_print_speedup(lookup_baseline, lookup_optimized);
+
+  az_json_pointer pointers[_az_COUNTOF(twin_pointers)];
+  for (size_t i = 0; i < _az_COUNTOF(twin_pointers); i++)
+  {
+    if (az_json_pointer_parse(&pointers[i], twin_pointers[i]) != AZ_OK)
+    {
+      return;
+    }
+  }
+  double const pointer_optimized = az_benchmark_run(
+      "az_json_pointer_find, from the start for each path",
+      _find_properties_with_pointers,
+      pointers,
+      _az_BENCHMARK_ITERATIONS);
+  az_benchmark_print_speedup(lookup_baseline, pointer_optimized);
+
+  printf("integer values (%d in an array)\n", (int)_az_COUNTOF(telemetry_integers));
+  double const integers_baseline = az_benchmark_run(
+      "az_json_writer_append_double, with no fractional digits",
+      _write_integers_as_doubles,
+      NULL,
+      _az_BENCHMARK_ITERATIONS);
+  double const integers_optimized = az_benchmark_run(
+      "az_json_writer_append_int64", _write_integers_as_int64, NULL, _az_BENCHMARK_ITERATIONS);
+  az_benchmark_print_speedup(integers_baseline, integers_optimized);
+
+  printf(
+      "string values (%d properties, %d bytes of text)\n",
+      (int)_az_COUNTOF(telemetry_strings),
+      (int)_telemetry_strings_size());
+  double const strings_written = az_benchmark_run(
+      "az_json_writer_append_string", _write_strings, NULL, _az_BENCHMARK_ITERATIONS);
+  double const strings_measured = az_benchmark_run(
+      "az_json_writer_append_string, measuring only",
+      _measure_strings,
+      NULL,
+      _az_BENCHMARK_ITERATIONS);
+  printf(
+      "  %-60s %10.2fx\n",
+      "measuring / writing",
+      strings_written > 0 ? strings_measured / strings_written : 0);
+
+  printf("property names (%d, with integer values)\n", (int)_az_COUNTOF(reported_names));
+  double const names_baseline = az_benchmark_run(
+      "az_json_writer_append_property_name",
+      _write_property_names,
+      NULL,
+      _az_BENCHMARK_ITERATIONS);
+  double const names_optimized = az_benchmark_run(
+      "az_json_writer_append_name", _write_pre_escaped_names, NULL, _az_BENCHMARK_ITERATIONS);
+  az_benchmark_print_speedup(names_baseline, names_optimized);
+
+  printf("embedded JSON text (%d byte minified twin)\n", (int)az_span_size(minified_twin));
+  double const fragment_baseline = az_benchmark_run(
+      "az_json_writer_append_json_text",
+      _write_validated_fragment,
+      NULL,
+      _az_BENCHMARK_ITERATIONS);
+  double const fragment_optimized = az_benchmark_run(
+      "az_json_writer_append_json_text_trusted",
+      _write_trusted_fragment,
+      NULL,
+      _az_BENCHMARK_ITERATIONS);
+  az_benchmark_print_speedup(fragment_baseline, fragment_optimized);
+
+  printf(
+      "field extraction (%d of the fields of a %d byte manifest)\n",
+      (int)_az_COUNTOF(manifest_keys),
+      (int)az_span_size(manifest));
+  az_json_keyset keyset = { 0 };
+  if (az_json_keyset_init(&keyset, manifest_keys, (int32_t)_az_COUNTOF(manifest_keys)) != AZ_OK)
+  {
+    return;
+  }
+  double const extract_baseline = az_benchmark_run(
+      "az_json_token_is_text_equal, for each field in turn",
+      _extract_with_comparisons,
+      NULL,
+      _az_BENCHMARK_ITERATIONS);
+  double const extract_optimized = az_benchmark_run(
+      "az_json_keyset_extract", _extract_with_keyset, &keyset, _az_BENCHMARK_ITERATIONS);
+  az_benchmark_print_speedup(extract_baseline, extract_optimized);
+
+  az_json_writer writer = { 0 };
+  if (az_json_writer_init(&writer, AZ_SPAN_FROM_BUFFER(escaped_manifest_buffer), NULL) != AZ_OK
+      || az_json_writer_append_string(&writer, manifest) != AZ_OK)
+  {
+    return;
+  }
+  az_span const written = az_json_writer_get_bytes_used_in_destination(&writer);
+  az_span const escaped_manifest = az_span_slice(written, 1, az_span_size(written) - 1);
+  printf(
+      "string unescaping (%d byte manifest, escaped within a JSON string, and %d bytes of release "
+      "notes)\n",
+      (int)az_span_size(escaped_manifest),
+      (int)az_span_size(release_notes));
+  double const manifest_baseline = az_benchmark_run(
+      "manifest, byte by byte",
+      _unescape_byte_by_byte,
+      (void*)(uintptr_t)&escaped_manifest,
+      _az_BENCHMARK_ITERATIONS);
+  double const manifest_optimized = az_benchmark_run(
+      "manifest, az_json_string_unescape",
+      _unescape_in_bulk,
+      (void*)(uintptr_t)&escaped_manifest,
+      _az_BENCHMARK_ITERATIONS);
+  az_benchmark_print_speedup(manifest_baseline, manifest_optimized);
+  double const notes_baseline = az_benchmark_run(
+      "release notes, byte by byte",
+      _unescape_byte_by_byte,
+      (void*)(uintptr_t)&release_notes,
+      _az_BENCHMARK_ITERATIONS);
+  double const notes_optimized = az_benchmark_run(
+      "release notes, az_json_string_unescape",
+      _unescape_in_bulk,
+      (void*)(uintptr_t)&release_notes,
+      _az_BENCHMARK_ITERATIONS);
+  az_benchmark_print_speedup(notes_baseline, notes_optimized);
+
+  printf("integer number tokens (%d byte telemetry)\n", (int)az_span_size(counters));
+  double const counters_baseline = az_benchmark_run(
+      "read, then parse the text",
+      _sum_counters_parsed,
+      (void*)(uintptr_t)&counters,
+      _az_BENCHMARK_ITERATIONS);
+  double const counters_optimized = az_benchmark_run(
+      "read, then az_json_token_get_int64",
+      _sum_counters,
+      (void*)(uintptr_t)&counters,
+      _az_BENCHMARK_ITERATIONS);
+  az_benchmark_print_speedup(counters_baseline, counters_optimized);
+}
@@ -0,0 +1,562 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "az_benchmark.h"
+#include <azure/core/az_span.h>
+#include <azure/core/internal/az_span_internal.h>
+
+#include <ctype.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+
+#include <azure/core/_az_cfg.h>
+
+enum
+{
+  _az_BENCHMARK_ITERATIONS = 1000000,
+  _az_BENCHMARK_DOUBLE_BUFFER_SIZE = 400,
+  _az_BENCHMARK_SEARCHER_HAYSTACK_SIZE = 4096,
+};
+
+// Header names from a typical Azure service response, in the casing the service sends them.
+static az_span const response_header_names[] = {
+  AZ_SPAN_LITERAL_FROM_STR("Content-Type"),
+  AZ_SPAN_LITERAL_FROM_STR("Content-Length"),
+  AZ_SPAN_LITERAL_FROM_STR("Date"),
+  AZ_SPAN_LITERAL_FROM_STR("Server"),
+  AZ_SPAN_LITERAL_FROM_STR("ETag"),
+  AZ_SPAN_LITERAL_FROM_STR("Last-Modified"),
+  AZ_SPAN_LITERAL_FROM_STR("Strict-Transport-Security"),
+  AZ_SPAN_LITERAL_FROM_STR("x-ms-request-id"),
+  AZ_SPAN_LITERAL_FROM_STR("x-ms-client-request-id"),
+  AZ_SPAN_LITERAL_FROM_STR("x-ms-version"),
+  AZ_SPAN_LITERAL_FROM_STR("x-ms-correlation-request-id"),
+  AZ_SPAN_LITERAL_FROM_STR("x-ms-routing-request-id"),
+  AZ_SPAN_LITERAL_FROM_STR("Access-Control-Expose-Headers"),
+  AZ_SPAN_LITERAL_FROM_STR("Access-Control-Allow-Credentials"),
+  AZ_SPAN_LITERAL_FROM_STR("X-Content-Type-Options"),
+  AZ_SPAN_LITERAL_FROM_STR("Retry-After"),
+};
+
+// The names the retry policy looks for, plus a few longer ones an application might look for.
+static az_span const candidate_header_names[] = {
+  AZ_SPAN_LITERAL_FROM_STR("retry-after-ms"),
+  AZ_SPAN_LITERAL_FROM_STR("x-ms-retry-after-ms"),
+  AZ_SPAN_LITERAL_FROM_STR("retry-after"),
+  AZ_SPAN_LITERAL_FROM_STR("x-ms-client-request-id"),
+  AZ_SPAN_LITERAL_FROM_STR("access-control-expose-headers"),
+  AZ_SPAN_LITERAL_FROM_STR("access-control-allow-credentials"),
+};
+
+static az_span const long_text = AZ_SPAN_LITERAL_FROM_STR(
+    "Content-Type: application/json; charset=utf-8\r\n"
+    "Strict-Transport-Security: max-age=31536000; includeSubDomains\r\n"
+    "x-ms-client-request-id: 9f4b6d2e-8c1a-4e5f-b3a7-2d6c8e0f1a4b\r\n"
+    "Access-Control-Expose-Headers: x-ms-request-id,x-ms-client-request-id\r\n"
+    "X-Content-Type-Options: nosniff\r\n"
+    "x-ms-retry-after-ms: 1500\r\n");
+
+// The byte-by-byte comparison that az_span_is_content_equal_ignoring_case used to do, as a
+// baseline.
+static bool _bytewise_is_content_equal_ignoring_case(az_span span1, az_span span2)
+{
+  int32_t const size = az_span_size(span1);
+  if (size != az_span_size(span2))
+  {
+    return false;
+  }
+
+  for (int32_t i = 0; i < size; ++i)
+  {
+    uint8_t c1 = az_span_ptr(span1)[i];
+    uint8_t c2 = az_span_ptr(span2)[i];
+    c1 = (c1 >= 'A' && c1 <= 'Z') ? (uint8_t)(c1 + ('a' - 'A')) : c1;
+    c2 = (c2 >= 'A' && c2 <= 'Z') ? (uint8_t)(c2 + ('a' - 'A')) : c2;
+    if (c1 != c2)
+    {
+      return false;
+    }
+  }
+  return true;
+}
+
+static int32_t _bytewise_find_ignoring_case(az_span source, az_span target)
+{
+  int32_t const target_size = az_span_size(target);
+  for (int32_t i = 0; i <= az_span_size(source) - target_size; i++)
+  {
+    if (_bytewise_is_content_equal_ignoring_case(
+            az_span_slice(source, i, i + target_size), target))
+    {
+      return i;
+    }
+  }
+  return -1;
+}
+
+// Called through a pointer so the baseline isn't inlined into the loop, just like the SDK function.
+static bool (*volatile bytewise_is_content_equal_ignoring_case)(az_span, az_span)
+    = _bytewise_is_content_equal_ignoring_case;
+
+static uint64_t _match_headers_bytewise(void* context)
+{
+  (void)context;
+  uint64_t matches = 0;
+  for (size_t h = 0; h < _az_COUNTOF(response_header_names); h++)
+  {
+    for (size_t c = 0; c < _az_COUNTOF(candidate_header_names); c++)
+    {
+      matches += bytewise_is_content_equal_ignoring_case(
+          response_header_names[h], candidate_header_names[c]);
+    }
+  }
+  return matches;
+}
+
+static uint64_t _match_headers(void* context)
+{
+  (void)context;
+  uint64_t matches = 0;
+  for (size_t h = 0; h < _az_COUNTOF(response_header_names); h++)
+  {
+    for (size_t c = 0; c < _az_COUNTOF(candidate_header_names); c++)
+    {
+      matches += az_span_is_content_equal_ignoring_case(
+          response_header_names[h], candidate_header_names[c]);
+    }
+  }
+  return matches;
+}
+
+static uint64_t _find_in_headers_bytewise(void* context)
+{
+  return (uint64_t)_bytewise_find_ignoring_case(long_text, *(az_span const*)context);
+}
+
+static uint64_t _find_in_headers(void* context)
+{
+  return (uint64_t)az_span_find_ignoring_case(long_text, *(az_span const*)context);
+}
+
+// A long haystack, such as a CSV log of readings, where a marker only occurs at the end. Apart
+// from its first byte, none of the bytes of the marker occur in the readings, so the searcher moves
+// past a whole marker's length at a time, while az_span_find() looks at each byte. That is where
+// the searcher wins in the default build; with SIMD, the vectorized az_span_find() stays ahead.
+static uint8_t searcher_haystack[_az_BENCHMARK_SEARCHER_HAYSTACK_SIZE];
+static az_span const searcher_target
+    = AZ_SPAN_LITERAL_FROM_STR("-- ALERT: OVERHEAT IN BOILER ROOM B --");
+
+static az_span _searcher_haystack_init(void)
+{
+  az_span const line = AZ_SPAN_FROM_STR("1697040000.125,23.875,-0.0625\n");
+  az_span remainder = AZ_SPAN_FROM_BUFFER(searcher_haystack);
+  while (az_span_size(remainder) >= az_span_size(line) + az_span_size(searcher_target))
+  {
+    remainder = az_span_copy(remainder, line);
+  }
+  remainder = az_span_copy(remainder, searcher_target);
+  return az_span_create(
+      searcher_haystack, _az_BENCHMARK_SEARCHER_HAYSTACK_SIZE - az_span_size(remainder));
+}
+
+typedef struct
+{
+  az_span haystack;
+  az_span_searcher searcher;
+} _az_searcher_benchmark_context;
+
+static uint64_t _find_in_long_text(void* context)
+{
+  return (uint64_t)az_span_find(
+      ((_az_searcher_benchmark_context const*)context)->haystack, searcher_target);
+}
+
+static uint64_t _find_in_long_text_with_searcher(void* context)
+{
+  _az_searcher_benchmark_context const* const searcher_context
+      = (_az_searcher_benchmark_context const*)context;
+  return (uint64_t)az_span_searcher_find(&searcher_context->searcher, searcher_context->haystack);
+}
+
+// Integers as they appear in JSON payloads, twin versions, status codes and Retry-After headers.
+static az_span const integer_values[] = {
+  AZ_SPAN_LITERAL_FROM_STR("200"),
+  AZ_SPAN_LITERAL_FROM_STR("1500"),
+  AZ_SPAN_LITERAL_FROM_STR("42"),
+  AZ_SPAN_LITERAL_FROM_STR("1700000000"),
+  AZ_SPAN_LITERAL_FROM_STR("4294967295"),
+  AZ_SPAN_LITERAL_FROM_STR("1700000000123"),
+  AZ_SPAN_LITERAL_FROM_STR("9223372036854775807"),
+  AZ_SPAN_LITERAL_FROM_STR("18446744073709551615"),
+};
+
+// The digit-by-digit parsing that az_span_atou64 used to do, as a baseline.
+static uint64_t _bytewise_atou64(az_span source)
+{
+  uint64_t value = 0;
+  for (int32_t i = 0; i < az_span_size(source); ++i)
+  {
+    uint8_t const next_byte = az_span_ptr(source)[i];
+    if (!isdigit(next_byte))
+    {
+      return 0;
+    }
+    uint64_t const d = (uint64_t)next_byte - '0';
+    if ((UINT64_MAX - d) / 10 < value)
+    {
+      return 0;
+    }
+    value = value * 10 + d;
+  }
+  return value;
+}
+
+// Called through a pointer so the baseline isn't inlined into the loop, just like the SDK function.
+static uint64_t (*volatile bytewise_atou64)(az_span) = _bytewise_atou64;
+
+static uint64_t _parse_integers_bytewise(void* context)
+{
+  (void)context;
+  uint64_t sum = 0;
+  for (size_t i = 0; i < _az_COUNTOF(integer_values); i++)
+  {
+    sum += bytewise_atou64(integer_values[i]);
+  }
+  return sum;
+}
+
+static uint64_t _parse_integers(void* context)
+{
+  (void)context;
+  uint64_t sum = 0;
+  for (size_t i = 0; i < _az_COUNTOF(integer_values); i++)
+  {
+    uint64_t value = 0;
+    if (az_span_atou64(integer_values[i], &value) == AZ_OK)
+    {
+      sum += value;
+    }
+  }
+  return sum;
+}
+
+// Request IDs, twin versions, status codes and SAS expiry times, as written into topics and
+// payloads.
+static uint64_t const integers_to_write[] = {
+  1, 42, 200, 1500, 65535, 1700000000, 4294967295, 1700000000123, 9223372036854775807,
+};
+
+// The digit-at-a-time division that az_span_u64toa used to do, as a baseline.
+static int32_t _divide_per_digit_u64toa(uint8_t* buffer, uint64_t n)
+{
+  uint64_t div = 10000000000000000000ULL;
+  while (div > 1 && n / div == 0)
+  {
+    div /= 10;
+  }
+
+  int32_t size = 0;
+  while (div > 1)
+  {
+    buffer[size++] = (uint8_t)('0' + (n / div));
+    n %= div;
+    div /= 10;
+  }
+  buffer[size++] = (uint8_t)('0' + n);
+  return size;
+}
+
+// Called through a pointer so the baseline isn't inlined into the loop, just like the SDK function.
+static int32_t (*volatile divide_per_digit_u64toa)(uint8_t*, uint64_t) = _divide_per_digit_u64toa;
+
+static uint64_t _write_integers_divide_per_digit(void* context)
+{
+  (void)context;
+  uint8_t buffer[_az_MAX_SIZE_FOR_UINT64];
+  uint64_t written = 0;
+  for (size_t i = 0; i < _az_COUNTOF(integers_to_write); i++)
+  {
+    written += (uint64_t)divide_per_digit_u64toa(buffer, integers_to_write[i]);
+  }
+  return written;
+}
+
+static uint64_t _write_integers(void* context)
+{
+  (void)context;
+  uint8_t buffer[_az_MAX_SIZE_FOR_UINT64];
+  uint64_t written = 0;
+  for (size_t i = 0; i < _az_COUNTOF(integers_to_write); i++)
+  {
+    az_span out_span = AZ_SPAN_EMPTY;
+    if (az_span_u64toa(AZ_SPAN_FROM_BUFFER(buffer), integers_to_write[i], &out_span) == AZ_OK)
+    {
+      written += (uint64_t)(_az_MAX_SIZE_FOR_UINT64 - az_span_size(out_span));
+    }
+  }
+  return written;
+}
+
+// The hostname, device and module IDs and resource URI that SAS tokens encode on every refresh.
+static az_span const url_encode_values[] = {
+  AZ_SPAN_LITERAL_FROM_STR("contoso-iot-hub-westus2.azure-devices.net"),
+  AZ_SPAN_LITERAL_FROM_STR("gateway-07/devices/thermostat-0042"),
+  AZ_SPAN_LITERAL_FROM_STR("temperature_sensor.module~v2"),
+  AZ_SPAN_LITERAL_FROM_STR("global.azure-devices-provisioning.net/0ne00000001/registrations"),
+};
+
+static bool _old_url_should_encode(uint8_t c)
+{
+  switch (c)
+  {
+    case '-':
+    case '_':
+    case '.':
+    case '~':
+      return false;
+    default:
+      return !(('0' <= c && c <= '9') || ('A' <= c && c <= 'Z') || ('a' <= c && c <= 'z'));
+  }
+}
+
+// The length calculation followed by byte-by-byte encoding that URL encoding used to do, as a
+// baseline.
+static int32_t _two_pass_url_encode(uint8_t* destination, int32_t destination_size, az_span source)
+{
+  int32_t required = 0;
+  for (int32_t i = 0; i < az_span_size(source); i++)
+  {
+    required += _old_url_should_encode(az_span_ptr(source)[i]) ? 3 : 1;
+  }
+  if (required > destination_size)
+  {
+    return 0;
+  }
+
+  static char const hex[] = "0123456789ABCDEF";
+  int32_t length = 0;
+  for (int32_t i = 0; i < az_span_size(source); i++)
+  {
+    uint8_t const c = az_span_ptr(source)[i];
+    if (!_old_url_should_encode(c))
+    {
+      destination[length++] = c;
+    }
+    else
+    {
+      destination[length++] = '%';
+      destination[length++] = (uint8_t)hex[c >> 4U];
+      destination[length++] = (uint8_t)hex[c & 0xFU];
+    }
+  }
+  return length;
+}
+
+// Called through a pointer so the baseline isn't inlined into the loop, just like the SDK function.
+static int32_t (*volatile two_pass_url_encode)(uint8_t*, int32_t, az_span) = _two_pass_url_encode;
+
+static uint64_t _url_encode_two_pass(void* context)
+{
+  (void)context;
+  uint8_t buffer[256];
+  uint64_t written = 0;
+  for (size_t i = 0; i < _az_COUNTOF(url_encode_values); i++)
+  {
+    written += (uint64_t)two_pass_url_encode(buffer, (int32_t)sizeof(buffer), url_encode_values[i]);
+  }
+  return written;
+}
+
+static uint64_t _url_encode(void* context)
+{
+  (void)context;
+  uint8_t buffer[256];
+  uint64_t written = 0;
+  for (size_t i = 0; i < _az_COUNTOF(url_encode_values); i++)
+  {
+    int32_t length = 0;
+    if (_az_span_url_encode(AZ_SPAN_FROM_BUFFER(buffer), url_encode_values[i], &length) == AZ_OK)
+    {
+      written += (uint64_t)length;
+    }
+  }
+  return written;
+}
+
+// Numeric values as they appear in telemetry and device twin properties.
+static az_span const double_values[] = {
+  AZ_SPAN_LITERAL_FROM_STR("23.5"),
+  AZ_SPAN_LITERAL_FROM_STR("1013.25"),
+  AZ_SPAN_LITERAL_FROM_STR("-0.0001"),
+  AZ_SPAN_LITERAL_FROM_STR("47.641468"),
+  AZ_SPAN_LITERAL_FROM_STR("-122.124165"),
+  AZ_SPAN_LITERAL_FROM_STR("0.30000000000000004"),
+  AZ_SPAN_LITERAL_FROM_STR("6.02214076e23"),
+  AZ_SPAN_LITERAL_FROM_STR("1.7976931348623157e308"),
+};
+
+// Disable the following warning just for the baseline.
+// C4996: 'sscanf': This function or variable may be unsafe. Consider using sscanf_s instead.
+#ifdef _MSC_VER
+#pragma warning(push)
+#pragma warning(disable : 4996)
+#endif
+
+// The sscanf based parsing that az_span_atod used to do, as a baseline.
+static double _sscanf_atod(az_span source)
+{
+  int32_t const size = az_span_size(source);
+  char format[8] = "%00lf%n";
+  format[1] = (char)((size / 10) + '0');
+  format[2] = (char)((size % 10) + '0');
+
+  double value = 0;
+  int32_t chars_consumed = 0;
+  // NOLINTNEXTLINE(clang-analyzer-security.insecureAPI.DeprecatedOrUnsafeBufferHandling)
+  int32_t const n = sscanf((char*)az_span_ptr(source), format, &value, &chars_consumed);
+  return (n == 1 && chars_consumed == size) ? value : 0;
+}
+
+#ifdef _MSC_VER
+#pragma warning(pop)
+#endif
+
+static uint64_t _parse_doubles_sscanf(void* context)
+{
+  (void)context;
+  double sum = 0;
+  for (size_t i = 0; i < _az_COUNTOF(double_values); i++)
+  {
+    sum += _sscanf_atod(double_values[i]);
+  }
+  return (uint64_t)(sum > 0);
+}
+
+static uint64_t _parse_doubles(void* context)
+{
+  (void)context;
+  double sum = 0;
+  for (size_t i = 0; i < _az_COUNTOF(double_values); i++)
+  {
+    double value = 0;
+    if (az_span_atod(double_values[i], &value) == AZ_OK)
+    {
+      sum += value;
+    }
+  }
+  return (uint64_t)(sum > 0);
+}
+
+// Doubles whose shortest form needs from 1 to 17 significant digits.
+static double const doubles_to_write[] = {
+  23.5, 1013.25, -0.0001, 47.641468, -122.124165, 0.1 + 0.2, 6.02214076e23, 1.7976931348623157e308,
+};
+
+static uint64_t _write_doubles_fixed(void* context)
+{
+  (void)context;
+  uint8_t buffer[_az_BENCHMARK_DOUBLE_BUFFER_SIZE];
+  uint64_t written = 0;
+  for (size_t i = 0; i < _az_COUNTOF(doubles_to_write); i++)
+  {
+    az_span out_span = AZ_SPAN_EMPTY;
+    if (az_span_dtoa(AZ_SPAN_FROM_BUFFER(buffer), doubles_to_write[i], 15, &out_span) == AZ_OK)
+    {
+      written += (uint64_t)(_az_BENCHMARK_DOUBLE_BUFFER_SIZE - az_span_size(out_span));
+    }
+  }
+  return written;
+}
+
+static uint64_t _write_doubles_shortest(void* context)
+{
+  (void)context;
+  uint8_t buffer[_az_BENCHMARK_DOUBLE_BUFFER_SIZE];
+  uint64_t written = 0;
+  for (size_t i = 0; i < _az_COUNTOF(doubles_to_write); i++)
+  {
+    az_span out_span = AZ_SPAN_EMPTY;
+    if (az_span_dtoa_shortest(AZ_SPAN_FROM_BUFFER(buffer), doubles_to_write[i], &out_span) == AZ_OK)
+    {
+      written += (uint64_t)(_az_BENCHMARK_DOUBLE_BUFFER_SIZE - az_span_size(out_span));
+    }
+  }
+  return written;
+}
+
+void benchmark_az_span(void)
+{
+  printf(
+      "az_span_is_content_equal_ignoring_case (%d response headers x %d names)\n",
+      (int)_az_COUNTOF(response_header_names),
+      (int)_az_COUNTOF(candidate_header_names));
+  double const baseline = az_benchmark_run(
+      "byte-by-byte", _match_headers_bytewise, NULL, _az_BENCHMARK_ITERATIONS);
+  double const optimized = az_benchmark_run(
+      "az_span_is_content_equal_ignoring_case", _match_headers, NULL, _az_BENCHMARK_ITERATIONS);
+  az_benchmark_print_speedup(baseline, optimized);
+
+  az_span target = AZ_SPAN_FROM_STR("X-MS-RETRY-AFTER-MS");
+  printf("az_span_find_ignoring_case (%d byte header block)\n", (int)az_span_size(long_text));
+  double const find_baseline = az_benchmark_run(
+      "byte-by-byte", _find_in_headers_bytewise, &target, _az_BENCHMARK_ITERATIONS);
+  double const find_optimized = az_benchmark_run(
+      "az_span_find_ignoring_case", _find_in_headers, &target, _az_BENCHMARK_ITERATIONS);
+  az_benchmark_print_speedup(find_baseline, find_optimized);
+
+  _az_searcher_benchmark_context searcher_context = {
+    .haystack = _searcher_haystack_init(),
+    .searcher = az_span_searcher_create(searcher_target),
+  };
+  printf(
+      "az_span_searcher_find (%d byte target at the end of %d bytes, searcher reused)\n",
+      (int)az_span_size(searcher_target),
+      (int)az_span_size(searcher_context.haystack));
+  double const searcher_baseline = az_benchmark_run(
+      "az_span_find", _find_in_long_text, &searcher_context, _az_BENCHMARK_ITERATIONS / 10);
+  double const searcher_optimized = az_benchmark_run(
+      "az_span_searcher_find",
+      _find_in_long_text_with_searcher,
+      &searcher_context,
+      _az_BENCHMARK_ITERATIONS / 10);
+  az_benchmark_print_speedup(searcher_baseline, searcher_optimized);
+
+  printf("az_span_atou64 (%d values)\n", (int)_az_COUNTOF(integer_values));
+  double const atou64_baseline = az_benchmark_run(
+      "digit-by-digit", _parse_integers_bytewise, NULL, _az_BENCHMARK_ITERATIONS);
+  double const atou64_optimized
+      = az_benchmark_run("az_span_atou64", _parse_integers, NULL, _az_BENCHMARK_ITERATIONS);
+  az_benchmark_print_speedup(atou64_baseline, atou64_optimized);
+
+  printf("az_span_u64toa (%d values)\n", (int)_az_COUNTOF(integers_to_write));
+  double const u64toa_baseline = az_benchmark_run(
+      "division per digit", _write_integers_divide_per_digit, NULL, _az_BENCHMARK_ITERATIONS);
+  double const u64toa_optimized
+      = az_benchmark_run("az_span_u64toa", _write_integers, NULL, _az_BENCHMARK_ITERATIONS);
+  az_benchmark_print_speedup(u64toa_baseline, u64toa_optimized);
+
+  printf("_az_span_url_encode (%d values)\n", (int)_az_COUNTOF(url_encode_values));
+  double const url_encode_baseline = az_benchmark_run(
+      "length pass + byte-by-byte", _url_encode_two_pass, NULL, _az_BENCHMARK_ITERATIONS);
+  double const url_encode_optimized
+      = az_benchmark_run("_az_span_url_encode", _url_encode, NULL, _az_BENCHMARK_ITERATIONS);
+  az_benchmark_print_speedup(url_encode_baseline, url_encode_optimized);
+
+  printf("az_span_atod (%d values)\n", (int)_az_COUNTOF(double_values));
+  double const atod_baseline = az_benchmark_run(
+      "sscanf", _parse_doubles_sscanf, NULL, _az_BENCHMARK_ITERATIONS / 10);
+  double const atod_optimized
+      = az_benchmark_run("az_span_atod", _parse_doubles, NULL, _az_BENCHMARK_ITERATIONS / 10);
+  az_benchmark_print_speedup(atod_baseline, atod_optimized);
+
+  printf("az_span_dtoa_shortest (%d values)\n", (int)_az_COUNTOF(doubles_to_write));
+  double const dtoa_baseline = az_benchmark_run(
+      "az_span_dtoa, 15 fractional digits",
+      _write_doubles_fixed,
+      NULL,
+      _az_BENCHMARK_ITERATIONS / 10);
+  double const dtoa_optimized = az_benchmark_run(
+      "az_span_dtoa_shortest", _write_doubles_shortest, NULL, _az_BENCHMARK_ITERATIONS / 10);
+  az_benchmark_print_speedup(dtoa_baseline, dtoa_optimized);
+}
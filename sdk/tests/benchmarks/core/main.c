@@ -0,0 +1,13 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "az_benchmark.h"
+
+#include <azure/core/_az_cfg.h>
+
+int main()
+{
+  benchmark_az_span();
+  benchmark_az_json();
+  return 0;
+}
@@ -5,8 +5,13 @@ int test_az_base64();
 int test_az_context();
 int test_az_http();
 int test_az_json();
+int test_az_json_document();
+int test_az_json_keyset();
+int test_az_json_pointer();
 int test_az_logging();
 int test_az_pipeline();
 int test_az_policy();
 int test_az_span();
+int test_az_span_arena();
+int test_az_span_list();
 int test_az_url_encode();
@@ -23,10 +23,15 @@ int main()
   result += test_az_context();
   result += test_az_http();
   result += test_az_json();
+  result += test_az_json_document();
+  result += test_az_json_keyset();
+  result += test_az_json_pointer();
   result += test_az_logging();
   result += test_az_pipeline();
   result += test_az_policy();
   result += test_az_span();
+  result += test_az_span_arena();
+  result += test_az_span_list();
   result += test_az_url_encode();
 
   return result;
@@ -454,6 +454,102 @@ static void test_http_request(void** state)
   }
 }
 
+static void test_http_request_set_query_parameter_encoding_overflow_leaves_url_unchanged(
+    void** state)
+{
+  (void)state;
+
+  uint8_t buf[30];
+  uint8_t header_buf[(2 * sizeof(_az_http_request_header))];
+  memset(buf, 0, sizeof(buf));
+  memset(header_buf, 0, sizeof(header_buf));
+
+  az_span url_span = AZ_SPAN_FROM_BUFFER(buf);
+  az_span initial_url = AZ_SPAN_FROM_STR("http://example.com");
+  az_span_copy(url_span, initial_url);
+  az_http_request request;
+
+  TEST_EXPECT_SUCCESS(az_http_request_init(
+      &request,
+      &az_context_application,
+      az_http_method_get(),
+      url_span,
+      az_span_size(initial_url),
+      AZ_SPAN_FROM_BUFFER(header_buf),
+      AZ_SPAN_EMPTY));
+
+  // "?q=////" fits in the remaining 12 bytes, but "?q=%2F%2F%2F%2F" doesn't.
+  assert_int_equal(
+      az_http_request_set_query_parameter(
+          &request, AZ_SPAN_FROM_STR("q"), AZ_SPAN_FROM_STR("////"), false),
+      AZ_ERROR_NOT_ENOUGH_SPACE);
+
+  uint8_t result[30];
+  az_span url_result = AZ_SPAN_FROM_BUFFER(result);
+  assert_return_code(az_http_request_get_url(&request, &url_result), AZ_OK);
+  assert_true(az_span_is_content_equal(url_result, initial_url));
+
+  // The failed call must not have recorded the start of the query, so this one still uses '?'.
+  assert_return_code(
+      az_http_request_set_query_parameter(
+          &request, AZ_SPAN_FROM_STR("q"), AZ_SPAN_FROM_STR("a/b"), false),
+      AZ_OK);
+  assert_int_equal(
+      az_http_request_set_query_parameter(
+          &request, AZ_SPAN_FROM_STR("r"), AZ_SPAN_FROM_STR("//"), false),
+      AZ_ERROR_NOT_ENOUGH_SPACE);
+
+  url_result = AZ_SPAN_FROM_BUFFER(result);
+  assert_return_code(az_http_request_get_url(&request, &url_result), AZ_OK);
+  assert_true(az_span_is_content_equal(url_result, AZ_SPAN_FROM_STR("http://example.com?q=a%2Fb")));
+}
+
+static void test_http_request_body_span_list(void** state)
+{
+  (void)state;
+
+  uint8_t buf[30];
+  uint8_t header_buf[(2 * sizeof(_az_http_request_header))];
+  memset(buf, 0, sizeof(buf));
+  memset(header_buf, 0, sizeof(header_buf));
+
+  az_span url_span = AZ_SPAN_FROM_BUFFER(buf);
+  az_span initial_url = AZ_SPAN_FROM_STR("http://example.com");
+  az_span_copy(url_span, initial_url);
+  az_http_request request;
+
+  TEST_EXPECT_SUCCESS(az_http_request_init(
+      &request,
+      &az_context_application,
+      az_http_method_post(),
+      url_span,
+      az_span_size(initial_url),
+      AZ_SPAN_FROM_BUFFER(header_buf),
+      AZ_SPAN_FROM_STR("body")));
+
+  // A body provided as a single span isn't a list.
+  az_span_list body_list = { 0 };
+  TEST_EXPECT_SUCCESS(az_http_request_get_body_span_list(&request, &body_list));
+  assert_int_equal(az_span_list_get_segment_count(body_list), 0);
+
+  az_span segments[2] = { AZ_SPAN_FROM_STR("{\"a\":"), AZ_SPAN_FROM_STR("1}") };
+  TEST_EXPECT_SUCCESS(
+      az_http_request_set_body_span_list(&request, az_span_list_create(segments, 2)));
+
+  TEST_EXPECT_SUCCESS(az_http_request_get_body_span_list(&request, &body_list));
+  assert_int_equal(az_span_list_get_segment_count(body_list), 2);
+  assert_int_equal(az_span_list_size(body_list), 7);
+
+  // Transports that only take a contiguous body can't send it.
+  az_span body = AZ_SPAN_EMPTY;
+  assert_int_equal(az_http_request_get_body(&request, &body), AZ_ERROR_NOT_SUPPORTED);
+
+  TEST_EXPECT_SUCCESS(
+      az_http_request_set_body_span_list(&request, az_span_list_create(segments, 1)));
+  TEST_EXPECT_SUCCESS(az_http_request_get_body(&request, &body));
+  assert_true(az_span_is_content_equal(body, AZ_SPAN_FROM_STR("{\"a\":")));
+}
+
 #define EXAMPLE_BODY    \
   "{\r\n"               \
   "  \"somejson\":45\r" \
@@ -1067,6 +1163,8 @@ int test_az_http()
     cmocka_unit_test(test_http_response_append_null_response),
 #endif // AZ_NO_PRECONDITION_CHECKING
     cmocka_unit_test(test_http_request),
+    cmocka_unit_test(test_http_request_set_query_parameter_encoding_overflow_leaves_url_unchanged),
+    cmocka_unit_test(test_http_request_body_span_list),
     cmocka_unit_test(test_http_response),
     cmocka_unit_test(test_http_response_get_status_code),
     cmocka_unit_test(test_http_request_header_validation_range),
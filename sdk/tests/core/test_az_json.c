@@ -262,6 +262,37 @@ static void test_json_writer(void** state)
       assert_string_equal(array, "0");
     }
   }
+  {
+    uint8_t array[200] = { 0 };
+    az_json_writer writer = { 0 };
+    TEST_EXPECT_SUCCESS(az_json_writer_init(&writer, AZ_SPAN_FROM_BUFFER(array), NULL));
+
+    TEST_EXPECT_SUCCESS(az_json_writer_append_begin_array(&writer));
+    TEST_EXPECT_SUCCESS(az_json_writer_append_double_shortest(&writer, 12.1));
+    TEST_EXPECT_SUCCESS(az_json_writer_append_double_shortest(&writer, 0.1 + 0.2));
+    TEST_EXPECT_SUCCESS(az_json_writer_append_double_shortest(&writer, -1e-300));
+    TEST_EXPECT_SUCCESS(az_json_writer_append_double_shortest(&writer, 1e300));
+    TEST_EXPECT_SUCCESS(az_json_writer_append_double_shortest(&writer, 0));
+    TEST_EXPECT_SUCCESS(az_json_writer_append_end_array(&writer));
+
+    az_span_to_str((char*)array, 200, az_json_writer_get_bytes_used_in_destination(&writer));
+    assert_string_equal(array, "[12.1,0.30000000000000004,-1e-300,1e+300,0]");
+  }
+  {
+    // The longest shortest representation, plus the comma, fits with no bytes to spare.
+    uint8_t array[29] = { 0 };
+    az_json_writer writer = { 0 };
+    TEST_EXPECT_SUCCESS(az_json_writer_init(&writer, AZ_SPAN_FROM_BUFFER(array), NULL));
+
+    TEST_EXPECT_SUCCESS(az_json_writer_append_begin_array(&writer));
+    TEST_EXPECT_SUCCESS(az_json_writer_append_int32(&writer, 1));
+    TEST_EXPECT_SUCCESS(az_json_writer_append_double_shortest(&writer, -0.0000012345678901234567));
+    assert_int_equal(
+        az_json_writer_append_double_shortest(&writer, 1), AZ_ERROR_NOT_ENOUGH_SPACE);
+
+    az_span_to_str((char*)array, 29, az_json_writer_get_bytes_used_in_destination(&writer));
+    assert_string_equal(array, "[1,-0.0000012345678901234567");
+  }
   {
     // json with AZ_JSON_TOKEN_STRING
     uint8_t array[200] = { 0 };
@@ -1048,6 +1079,684 @@ static void test_json_writer_chunked_no_callback(void** state)
   }
 }
 
+static az_result _write_span_list_test_json(az_json_writer* ref_writer)
+{
+  _az_RETURN_IF_FAILED(az_json_writer_append_begin_object(ref_writer));
+  _az_RETURN_IF_FAILED(az_json_writer_append_property_name(ref_writer, AZ_SPAN_FROM_STR("id")));
+  _az_RETURN_IF_FAILED(az_json_writer_append_int32(ref_writer, 1234567));
+  _az_RETURN_IF_FAILED(
+      az_json_writer_append_property_name(ref_writer, AZ_SPAN_FROM_STR("readings")));
+  _az_RETURN_IF_FAILED(az_json_writer_append_begin_array(ref_writer));
+  for (int32_t i = 0; i < 20; i++)
+  {
+    _az_RETURN_IF_FAILED(az_json_writer_append_double(ref_writer, i * 1.5, 1));
+  }
+  _az_RETURN_IF_FAILED(az_json_writer_append_end_array(ref_writer));
+  _az_RETURN_IF_FAILED(az_json_writer_append_property_name(ref_writer, AZ_SPAN_FROM_STR("note")));
+  _az_RETURN_IF_FAILED(
+      az_json_writer_append_string(ref_writer, AZ_SPAN_FROM_STR("line one\nline \"two\"")));
+  return az_json_writer_append_end_object(ref_writer);
+}
+
+static void test_json_writer_span_list(void** state)
+{
+  (void)state;
+
+  uint8_t contiguous[512] = { 0 };
+  az_json_writer writer = { 0 };
+  TEST_EXPECT_SUCCESS(az_json_writer_init(&writer, AZ_SPAN_FROM_BUFFER(contiguous), NULL));
+  TEST_EXPECT_SUCCESS(_write_span_list_test_json(&writer));
+  az_span const expected = az_json_writer_get_bytes_used_in_destination(&writer);
+
+  // The 4 byte buffer is too small for the token that doesn't fit in the first buffer, so the
+  // writer moves on to the buffer after it.
+  uint8_t buffers[6][96] = { { 0 } };
+  az_span segments[6] = {
+    AZ_SPAN_FROM_BUFFER(buffers[0]), az_span_create(buffers[1], 4), AZ_SPAN_FROM_BUFFER(buffers[2]),
+    AZ_SPAN_FROM_BUFFER(buffers[3]), AZ_SPAN_FROM_BUFFER(buffers[4]), AZ_SPAN_FROM_BUFFER(buffers[5]),
+  };
+  az_span_list list = az_span_list_create(segments, 6);
+
+  TEST_EXPECT_SUCCESS(az_json_writer_span_list_init(&writer, &list, NULL));
+  TEST_EXPECT_SUCCESS(_write_span_list_test_json(&writer));
+
+  assert_true(az_span_list_get_segment_count(list) > 1);
+  assert_true(az_span_list_get_segment_count(list) <= 6);
+  assert_ptr_equal(az_span_ptr(az_span_list_get_segment(list, 1)), buffers[2]);
+  assert_ptr_equal(az_span_ptr(az_span_list_get_segment(list, 0)), buffers[0]);
+  assert_int_equal(az_span_list_size(list), az_span_size(expected));
+  assert_int_equal(writer.total_bytes_written, az_span_size(expected));
+
+  uint8_t gathered[512] = { 0 };
+  az_span_list_copy(AZ_SPAN_FROM_BUFFER(gathered), list);
+  assert_true(az_span_is_content_equal(
+      az_span_create(gathered, az_span_list_size(list)), expected));
+
+  // The segments can be read back as is.
+  az_json_reader reader = { 0 };
+  TEST_EXPECT_SUCCESS(az_json_reader_span_list_init(&reader, list, NULL));
+  int32_t token_count = 0;
+  while (az_result_succeeded(az_json_reader_next_token(&reader)))
+  {
+    token_count++;
+  }
+  // The object, 3 property names, the array with its 20 values, the string, and the end tokens.
+  assert_int_equal(token_count, 1 + 2 + 1 + 2 + 20 + 2 + 1);
+}
+
+static void test_json_writer_append_int64(void** state)
+{
+  (void)state;
+  {
+    uint8_t array[200] = { 0 };
+    az_json_writer writer = { 0 };
+    TEST_EXPECT_SUCCESS(az_json_writer_init(&writer, AZ_SPAN_FROM_BUFFER(array), NULL));
+
+    TEST_EXPECT_SUCCESS(az_json_writer_append_begin_array(&writer));
+    TEST_EXPECT_SUCCESS(az_json_writer_append_int64(&writer, 0));
+    TEST_EXPECT_SUCCESS(az_json_writer_append_int64(&writer, -1));
+    TEST_EXPECT_SUCCESS(az_json_writer_append_int64(&writer, INT64_MAX));
+    TEST_EXPECT_SUCCESS(az_json_writer_append_int64(&writer, INT64_MIN));
+    TEST_EXPECT_SUCCESS(az_json_writer_append_int64(&writer, 9007199254740993LL));
+    TEST_EXPECT_SUCCESS(az_json_writer_append_uint64(&writer, 0));
+    TEST_EXPECT_SUCCESS(az_json_writer_append_uint64(&writer, UINT64_MAX));
+    TEST_EXPECT_SUCCESS(az_json_writer_append_end_array(&writer));
+
+    az_span_to_str((char*)array, 200, az_json_writer_get_bytes_used_in_destination(&writer));
+    assert_string_equal(
+        array,
+        "[0,-1,9223372036854775807,-9223372036854775808,9007199254740993,0,"
+        "18446744073709551615]");
+
+    // The values read back exactly.
+    az_json_reader reader = { 0 };
+    TEST_EXPECT_SUCCESS(
+        az_json_reader_init(&reader, az_json_writer_get_bytes_used_in_destination(&writer), NULL));
+    int64_t int64_value = 0;
+    uint64_t uint64_value = 0;
+    for (int32_t i = 0; i < 5; i++)
+    {
+      TEST_EXPECT_SUCCESS(az_json_reader_next_token(&reader));
+    }
+    TEST_EXPECT_SUCCESS(az_json_token_get_int64(&reader.token, &int64_value));
+    assert_true(int64_value == INT64_MIN);
+    TEST_EXPECT_SUCCESS(az_json_reader_next_token(&reader));
+    TEST_EXPECT_SUCCESS(az_json_token_get_int64(&reader.token, &int64_value));
+    assert_true(int64_value == 9007199254740993LL);
+    TEST_EXPECT_SUCCESS(az_json_reader_next_token(&reader));
+    TEST_EXPECT_SUCCESS(az_json_reader_next_token(&reader));
+    TEST_EXPECT_SUCCESS(az_json_token_get_uint64(&reader.token, &uint64_value));
+    assert_true(uint64_value == UINT64_MAX);
+  }
+  {
+    // Only the space the number takes, plus the comma, is needed.
+    uint8_t array[24] = { 0 };
+    az_json_writer writer = { 0 };
+    TEST_EXPECT_SUCCESS(az_json_writer_init(&writer, AZ_SPAN_FROM_BUFFER(array), NULL));
+
+    TEST_EXPECT_SUCCESS(az_json_writer_append_begin_array(&writer));
+    TEST_EXPECT_SUCCESS(az_json_writer_append_int64(&writer, 1));
+    TEST_EXPECT_SUCCESS(az_json_writer_append_uint64(&writer, 10000000000000000000ULL));
+    assert_int_equal(az_json_writer_append_int64(&writer, 1), AZ_ERROR_NOT_ENOUGH_SPACE);
+    assert_int_equal(az_json_writer_append_uint64(&writer, 1), AZ_ERROR_NOT_ENOUGH_SPACE);
+
+    az_span_to_str((char*)array, 24, az_json_writer_get_bytes_used_in_destination(&writer));
+    assert_string_equal(array, "[1,10000000000000000000");
+  }
+  {
+    // Each number goes in the first buffer it fits in.
+    uint8_t buffers[4][21] = { { 0 } };
+    az_span segments[4] = {
+      az_span_create(buffers[0], 4),
+      AZ_SPAN_FROM_BUFFER(buffers[1]),
+      AZ_SPAN_FROM_BUFFER(buffers[2]),
+      AZ_SPAN_FROM_BUFFER(buffers[3]),
+    };
+    az_span_list list = az_span_list_create(segments, 4);
+    az_json_writer writer = { 0 };
+    TEST_EXPECT_SUCCESS(az_json_writer_span_list_init(&writer, &list, NULL));
+
+    TEST_EXPECT_SUCCESS(az_json_writer_append_begin_array(&writer));
+    TEST_EXPECT_SUCCESS(az_json_writer_append_int64(&writer, 42));
+    TEST_EXPECT_SUCCESS(az_json_writer_append_int64(&writer, -1234567890123456789LL));
+    TEST_EXPECT_SUCCESS(az_json_writer_append_uint64(&writer, 1234567890123456789ULL));
+    TEST_EXPECT_SUCCESS(az_json_writer_append_end_array(&writer));
+
+    assert_int_equal(az_span_list_get_segment_count(list), 3);
+    assert_true(az_span_is_content_equal(
+        az_span_list_get_segment(list, 0), AZ_SPAN_FROM_STR("[42")));
+    assert_true(az_span_is_content_equal(
+        az_span_list_get_segment(list, 1), AZ_SPAN_FROM_STR(",-1234567890123456789")));
+    assert_true(az_span_is_content_equal(
+        az_span_list_get_segment(list, 2), AZ_SPAN_FROM_STR(",1234567890123456789]")));
+  }
+}
+
+static az_json_name const temperature_name = AZ_JSON_NAME_LITERAL("temperature");
+
+static void test_json_writer_append_name(void** state)
+{
+  (void)state;
+  assert_true(az_span_is_content_equal(
+      az_json_name_get_text(temperature_name), AZ_SPAN_FROM_STR("temperature")));
+  assert_int_equal(az_span_size(az_json_name_get_text(AZ_JSON_NAME_FROM_STR(""))), 0);
+  {
+    // The same JSON text as appending the names as spans.
+    uint8_t array[100] = { 0 };
+    az_json_writer writer = { 0 };
+    TEST_EXPECT_SUCCESS(az_json_writer_init(&writer, AZ_SPAN_FROM_BUFFER(array), NULL));
+
+    TEST_EXPECT_SUCCESS(az_json_writer_append_begin_object(&writer));
+    TEST_EXPECT_SUCCESS(az_json_writer_append_name(&writer, temperature_name));
+    TEST_EXPECT_SUCCESS(az_json_writer_append_int32(&writer, 21));
+    TEST_EXPECT_SUCCESS(az_json_writer_append_name(&writer, AZ_JSON_NAME_FROM_STR("a\\\"b")));
+    TEST_EXPECT_SUCCESS(az_json_writer_append_begin_object(&writer));
+    TEST_EXPECT_SUCCESS(az_json_writer_append_name(&writer, AZ_JSON_NAME_FROM_STR("")));
+    TEST_EXPECT_SUCCESS(az_json_writer_append_null(&writer));
+    TEST_EXPECT_SUCCESS(az_json_writer_append_end_object(&writer));
+    TEST_EXPECT_SUCCESS(az_json_writer_append_end_object(&writer));
+
+    uint8_t expected_array[100] = { 0 };
+    az_json_writer expected_writer = { 0 };
+    TEST_EXPECT_SUCCESS(
+        az_json_writer_init(&expected_writer, AZ_SPAN_FROM_BUFFER(expected_array), NULL));
+
+    TEST_EXPECT_SUCCESS(az_json_writer_append_begin_object(&expected_writer));
+    TEST_EXPECT_SUCCESS(
+        az_json_writer_append_property_name(&expected_writer, AZ_SPAN_FROM_STR("temperature")));
+    TEST_EXPECT_SUCCESS(az_json_writer_append_int32(&expected_writer, 21));
+    TEST_EXPECT_SUCCESS(
+        az_json_writer_append_property_name(&expected_writer, AZ_SPAN_FROM_STR("a\"b")));
+    TEST_EXPECT_SUCCESS(az_json_writer_append_begin_object(&expected_writer));
+    TEST_EXPECT_SUCCESS(
+        az_json_writer_append_property_name(&expected_writer, AZ_SPAN_FROM_STR("")));
+    TEST_EXPECT_SUCCESS(az_json_writer_append_null(&expected_writer));
+    TEST_EXPECT_SUCCESS(az_json_writer_append_end_object(&expected_writer));
+    TEST_EXPECT_SUCCESS(az_json_writer_append_end_object(&expected_writer));
+
+    az_span_to_str((char*)array, 100, az_json_writer_get_bytes_used_in_destination(&writer));
+    assert_string_equal(array, "{\"temperature\":21,\"a\\\"b\":{\"\":null}}");
+    assert_true(az_span_is_content_equal(
+        az_json_writer_get_bytes_used_in_destination(&writer),
+        az_json_writer_get_bytes_used_in_destination(&expected_writer)));
+  }
+  {
+    // Only the space the name takes is needed.
+    uint8_t array[15] = { 0 };
+    az_json_writer writer = { 0 };
+    TEST_EXPECT_SUCCESS(az_json_writer_init(&writer, az_span_create(array, 14), NULL));
+    TEST_EXPECT_SUCCESS(az_json_writer_append_begin_object(&writer));
+    assert_int_equal(
+        az_json_writer_append_name(&writer, temperature_name), AZ_ERROR_NOT_ENOUGH_SPACE);
+
+    TEST_EXPECT_SUCCESS(az_json_writer_init(&writer, AZ_SPAN_FROM_BUFFER(array), NULL));
+    TEST_EXPECT_SUCCESS(az_json_writer_append_begin_object(&writer));
+    TEST_EXPECT_SUCCESS(az_json_writer_append_name(&writer, temperature_name));
+    assert_true(az_span_is_content_equal(
+        az_json_writer_get_bytes_used_in_destination(&writer),
+        AZ_SPAN_FROM_STR("{\"temperature\":")));
+  }
+  {
+    // Each name goes in the first buffer it fits in.
+    uint8_t buffers[3][32] = { { 0 } };
+    az_span segments[3] = {
+      az_span_create(buffers[0], 8),
+      az_span_create(buffers[1], 20),
+      AZ_SPAN_FROM_BUFFER(buffers[2]),
+    };
+    az_span_list list = az_span_list_create(segments, 3);
+    az_json_writer writer = { 0 };
+    TEST_EXPECT_SUCCESS(az_json_writer_span_list_init(&writer, &list, NULL));
+
+    TEST_EXPECT_SUCCESS(az_json_writer_append_begin_object(&writer));
+    TEST_EXPECT_SUCCESS(az_json_writer_append_name(&writer, temperature_name));
+    TEST_EXPECT_SUCCESS(az_json_writer_append_bool(&writer, true));
+    TEST_EXPECT_SUCCESS(az_json_writer_append_name(&writer, temperature_name));
+    TEST_EXPECT_SUCCESS(az_json_writer_append_bool(&writer, false));
+    TEST_EXPECT_SUCCESS(az_json_writer_append_end_object(&writer));
+
+    assert_int_equal(az_span_list_get_segment_count(list), 3);
+    assert_true(
+        az_span_is_content_equal(az_span_list_get_segment(list, 0), AZ_SPAN_FROM_STR("{")));
+    assert_true(az_span_is_content_equal(
+        az_span_list_get_segment(list, 1), AZ_SPAN_FROM_STR("\"temperature\":true")));
+    assert_true(az_span_is_content_equal(
+        az_span_list_get_segment(list, 2), AZ_SPAN_FROM_STR(",\"temperature\":false}")));
+  }
+}
+
+static void test_json_writer_append_json_text_trusted(void** state)
+{
+  (void)state;
+  {
+    // The same JSON text as appending validated fragments.
+    az_span const fragments[] = {
+      AZ_SPAN_LITERAL_FROM_STR("{\"resultCode\":700,\"resultDetails\":\"\"}"),
+      AZ_SPAN_LITERAL_FROM_STR("[1,[]]"),
+      AZ_SPAN_LITERAL_FROM_STR("\"a\""),
+      AZ_SPAN_LITERAL_FROM_STR("-12.5e3"),
+      AZ_SPAN_LITERAL_FROM_STR("0"),
+      AZ_SPAN_LITERAL_FROM_STR("true"),
+      AZ_SPAN_LITERAL_FROM_STR("false"),
+      AZ_SPAN_LITERAL_FROM_STR("null"),
+    };
+    uint8_t array[200] = { 0 };
+    uint8_t expected_array[200] = { 0 };
+    az_json_writer writer = { 0 };
+    az_json_writer expected_writer = { 0 };
+    TEST_EXPECT_SUCCESS(az_json_writer_init(&writer, AZ_SPAN_FROM_BUFFER(array), NULL));
+    TEST_EXPECT_SUCCESS(
+        az_json_writer_init(&expected_writer, AZ_SPAN_FROM_BUFFER(expected_array), NULL));
+
+    TEST_EXPECT_SUCCESS(az_json_writer_append_begin_array(&writer));
+    TEST_EXPECT_SUCCESS(az_json_writer_append_begin_array(&expected_writer));
+    for (int32_t i = 0; i < 8; i++)
+    {
+      TEST_EXPECT_SUCCESS(az_json_writer_append_json_text_trusted(&writer, fragments[i]));
+      TEST_EXPECT_SUCCESS(az_json_writer_append_json_text(&expected_writer, fragments[i]));
+    }
+    TEST_EXPECT_SUCCESS(az_json_writer_append_end_array(&writer));
+    TEST_EXPECT_SUCCESS(az_json_writer_append_end_array(&expected_writer));
+
+    az_span_to_str((char*)array, 200, az_json_writer_get_bytes_used_in_destination(&writer));
+    assert_string_equal(
+        array,
+        "[{\"resultCode\":700,\"resultDetails\":\"\"},[1,[]],\"a\",-12.5e3,0,true,false,null]");
+    assert_true(az_span_is_content_equal(
+        az_json_writer_get_bytes_used_in_destination(&writer),
+        az_json_writer_get_bytes_used_in_destination(&expected_writer)));
+  }
+  {
+    // Only the first and last bytes are looked at.
+    uint8_t array[64] = { 0 };
+    az_json_writer writer = { 0 };
+    TEST_EXPECT_SUCCESS(az_json_writer_init(&writer, AZ_SPAN_FROM_BUFFER(array), NULL));
+    az_span const invalid[] = {
+      AZ_SPAN_LITERAL_FROM_STR("{"),    AZ_SPAN_LITERAL_FROM_STR("[}"),
+      AZ_SPAN_LITERAL_FROM_STR("\""),   AZ_SPAN_LITERAL_FROM_STR(" 1"),
+      AZ_SPAN_LITERAL_FROM_STR("1 "),   AZ_SPAN_LITERAL_FROM_STR("1."),
+      AZ_SPAN_LITERAL_FROM_STR("nope"), AZ_SPAN_LITERAL_FROM_STR("trul"),
+      AZ_SPAN_LITERAL_FROM_STR("\"a\":1"),
+    };
+    for (size_t i = 0; i < sizeof(invalid) / sizeof(invalid[0]); i++)
+    {
+      assert_int_equal(
+          az_json_writer_append_json_text_trusted(&writer, invalid[i]), AZ_ERROR_UNEXPECTED_CHAR);
+    }
+    TEST_EXPECT_SUCCESS(
+        az_json_writer_append_json_text_trusted(&writer, AZ_SPAN_FROM_STR("{\"a\":[}")));
+    assert_int_equal(
+        az_json_writer_append_json_text_trusted(&writer, AZ_SPAN_FROM_STR("1")),
+        AZ_ERROR_JSON_INVALID_STATE);
+
+    TEST_EXPECT_SUCCESS(az_json_writer_init(&writer, AZ_SPAN_FROM_BUFFER(array), NULL));
+    TEST_EXPECT_SUCCESS(az_json_writer_append_begin_object(&writer));
+    assert_int_equal(
+        az_json_writer_append_json_text_trusted(&writer, AZ_SPAN_FROM_STR("1")),
+        AZ_ERROR_JSON_INVALID_STATE);
+  }
+  {
+    // Only the space the text takes, plus the comma, is needed.
+    uint8_t array[17] = { 0 };
+    az_json_writer writer = { 0 };
+    TEST_EXPECT_SUCCESS(az_json_writer_init(&writer, AZ_SPAN_FROM_BUFFER(array), NULL));
+
+    TEST_EXPECT_SUCCESS(az_json_writer_append_begin_array(&writer));
+    TEST_EXPECT_SUCCESS(
+        az_json_writer_append_json_text_trusted(&writer, AZ_SPAN_FROM_STR("{\"a\":1}")));
+    TEST_EXPECT_SUCCESS(
+        az_json_writer_append_json_text_trusted(&writer, AZ_SPAN_FROM_STR("[2,3]")));
+    assert_int_equal(
+        az_json_writer_append_json_text_trusted(&writer, AZ_SPAN_FROM_STR("[10]")),
+        AZ_ERROR_NOT_ENOUGH_SPACE);
+    TEST_EXPECT_SUCCESS(az_json_writer_append_json_text_trusted(&writer, AZ_SPAN_FROM_STR("4")));
+    TEST_EXPECT_SUCCESS(az_json_writer_append_end_array(&writer));
+
+    assert_true(az_span_is_content_equal(
+        az_json_writer_get_bytes_used_in_destination(&writer),
+        AZ_SPAN_FROM_STR("[{\"a\":1},[2,3],4]")));
+  }
+  {
+    // Text larger than a chunk goes across the buffers of a span list.
+    uint8_t text[300] = { 0 };
+    text[0] = '"';
+    for (int32_t i = 1; i < 299; i++)
+    {
+      text[i] = (uint8_t)('a' + i % 26);
+    }
+    text[299] = '"';
+
+    uint8_t buffers[4][128] = { { 0 } };
+    az_span segments[4] = {
+      AZ_SPAN_FROM_BUFFER(buffers[0]),
+      AZ_SPAN_FROM_BUFFER(buffers[1]),
+      AZ_SPAN_FROM_BUFFER(buffers[2]),
+      AZ_SPAN_FROM_BUFFER(buffers[3]),
+    };
+    az_span_list list = az_span_list_create(segments, 4);
+    az_json_writer writer = { 0 };
+    TEST_EXPECT_SUCCESS(az_json_writer_span_list_init(&writer, &list, NULL));
+
+    TEST_EXPECT_SUCCESS(az_json_writer_append_begin_array(&writer));
+    TEST_EXPECT_SUCCESS(
+        az_json_writer_append_json_text_trusted(&writer, AZ_SPAN_FROM_BUFFER(text)));
+    TEST_EXPECT_SUCCESS(az_json_writer_append_end_array(&writer));
+
+    uint8_t gathered[302] = { 0 };
+    assert_int_equal(az_span_list_size(list), 302);
+    az_span_list_copy(AZ_SPAN_FROM_BUFFER(gathered), list);
+    assert_int_equal(gathered[0], '[');
+    assert_true(az_span_is_content_equal(
+        az_span_slice(AZ_SPAN_FROM_BUFFER(gathered), 1, 301), AZ_SPAN_FROM_BUFFER(text)));
+    assert_int_equal(gathered[301], ']');
+  }
+}
+
+// Writes a payload with each kind of value, with long strings and names that take several chunks.
+static az_result _write_measured_payload(az_json_writer* ref_json_writer, az_span long_text)
+{
+  _az_RETURN_IF_FAILED(az_json_writer_append_begin_object(ref_json_writer));
+  _az_RETURN_IF_FAILED(az_json_writer_append_name(
+      ref_json_writer,
+      AZ_JSON_NAME_FROM_STR("aPropertyNameThatIsLongerThanTheChunksThatChunkedWritersAskFor")));
+  _az_RETURN_IF_FAILED(az_json_writer_append_string(ref_json_writer, long_text));
+  _az_RETURN_IF_FAILED(az_json_writer_append_property_name(ref_json_writer, long_text));
+  _az_RETURN_IF_FAILED(az_json_writer_append_begin_array(ref_json_writer));
+  _az_RETURN_IF_FAILED(az_json_writer_append_int32(ref_json_writer, -42));
+  _az_RETURN_IF_FAILED(az_json_writer_append_int64(ref_json_writer, INT64_MIN));
+  _az_RETURN_IF_FAILED(az_json_writer_append_double(ref_json_writer, 1.5, 3));
+  _az_RETURN_IF_FAILED(az_json_writer_append_double_shortest(ref_json_writer, 0.1));
+  _az_RETURN_IF_FAILED(az_json_writer_append_bool(ref_json_writer, true));
+  _az_RETURN_IF_FAILED(az_json_writer_append_null(ref_json_writer));
+  _az_RETURN_IF_FAILED(
+      az_json_writer_append_json_text(ref_json_writer, AZ_SPAN_FROM_STR("{\"a\":[1,2]}")));
+  _az_RETURN_IF_FAILED(az_json_writer_append_end_array(ref_json_writer));
+  _az_RETURN_IF_FAILED(az_json_writer_append_name(ref_json_writer, AZ_JSON_NAME_FROM_STR("z")));
+  _az_RETURN_IF_FAILED(az_json_writer_append_json_text_trusted(ref_json_writer, long_text));
+  return az_json_writer_append_end_object(ref_json_writer);
+}
+
+static void test_json_writer_measure(void** state)
+{
+  (void)state;
+  uint8_t long_text[200] = { 0 };
+  long_text[0] = '"';
+  for (int32_t i = 1; i < 199; i++)
+  {
+    long_text[i] = (uint8_t)('a' + i % 26);
+  }
+  long_text[199] = '"';
+  // A JSON string, with an escaped character, as the trusted JSON text.
+  long_text[20] = '\\';
+  long_text[21] = 'n';
+
+  uint8_t scratch[64] = { 0 };
+  az_json_writer measuring_writer = { 0 };
+  TEST_EXPECT_SUCCESS(
+      az_json_writer_measure_init(&measuring_writer, AZ_SPAN_FROM_BUFFER(scratch), NULL));
+  TEST_EXPECT_SUCCESS(_write_measured_payload(&measuring_writer, AZ_SPAN_FROM_BUFFER(long_text)));
+
+  uint8_t array[1024] = { 0 };
+  az_json_writer writer = { 0 };
+  TEST_EXPECT_SUCCESS(az_json_writer_init(&writer, AZ_SPAN_FROM_BUFFER(array), NULL));
+  TEST_EXPECT_SUCCESS(_write_measured_payload(&writer, AZ_SPAN_FROM_BUFFER(long_text)));
+  assert_int_equal(measuring_writer.total_bytes_written, writer.total_bytes_written);
+
+  // The state is still validated.
+  assert_int_equal(
+      az_json_writer_append_json_text(&measuring_writer, AZ_SPAN_FROM_STR("1")),
+      AZ_ERROR_JSON_INVALID_STATE);
+
+  // A buffer of the measured size, plus the slack, is large enough.
+  TEST_EXPECT_SUCCESS(az_json_writer_init(
+      &writer, az_span_create(array, measuring_writer.total_bytes_written + 64), NULL));
+  TEST_EXPECT_SUCCESS(_write_measured_payload(&writer, AZ_SPAN_FROM_BUFFER(long_text)));
+
+  // Measuring writers share nothing, so several can be used at once, with scratch buffers of any
+  // size from 64 bytes.
+  uint8_t other_scratch[100] = { 0 };
+  az_json_writer other_measuring_writer = { 0 };
+  TEST_EXPECT_SUCCESS(
+      az_json_writer_measure_init(&measuring_writer, AZ_SPAN_FROM_BUFFER(scratch), NULL));
+  TEST_EXPECT_SUCCESS(az_json_writer_measure_init(
+      &other_measuring_writer, AZ_SPAN_FROM_BUFFER(other_scratch), NULL));
+  TEST_EXPECT_SUCCESS(az_json_writer_append_begin_array(&measuring_writer));
+  TEST_EXPECT_SUCCESS(az_json_writer_append_begin_array(&other_measuring_writer));
+  for (int32_t i = 0; i < 20; i++)
+  {
+    az_span const string = az_span_create(long_text + 22, 50);
+    TEST_EXPECT_SUCCESS(az_json_writer_append_string(&measuring_writer, string));
+    TEST_EXPECT_SUCCESS(az_json_writer_append_string(&other_measuring_writer, string));
+  }
+  TEST_EXPECT_SUCCESS(az_json_writer_append_end_array(&measuring_writer));
+  TEST_EXPECT_SUCCESS(az_json_writer_append_end_array(&other_measuring_writer));
+  assert_int_equal(measuring_writer.total_bytes_written, 2 + 20 * 52 + 19);
+  assert_int_equal(other_measuring_writer.total_bytes_written, 2 + 20 * 52 + 19);
+}
+
+typedef struct
+{
+  az_span sent;
+  int32_t chunk_count;
+  int32_t empty_chunk_count;
+  int32_t fail_after;
+} _az_stream_context;
+
+// Sends each chunk by appending it to the JSON text sent so far.
+static az_result _send_chunk(void* user_context, az_span json_text)
+{
+  _az_stream_context* const context = (_az_stream_context*)user_context;
+  if (context->chunk_count == context->fail_after)
+  {
+    return AZ_ERROR_NOT_SUPPORTED;
+  }
+
+  assert_true(az_span_size(json_text) <= 64);
+  context->sent = az_span_copy(context->sent, json_text);
+  context->chunk_count++;
+  if (az_span_size(json_text) == 0)
+  {
+    context->empty_chunk_count++;
+  }
+  return AZ_OK;
+}
+
+static void test_json_writer_stream(void** state)
+{
+  (void)state;
+  uint8_t long_text[200] = { 0 };
+  long_text[0] = '"';
+  for (int32_t i = 1; i < 199; i++)
+  {
+    long_text[i] = (uint8_t)('a' + i % 26);
+  }
+  long_text[199] = '"';
+
+  uint8_t expected[1024] = { 0 };
+  az_json_writer writer = { 0 };
+  TEST_EXPECT_SUCCESS(az_json_writer_init(&writer, AZ_SPAN_FROM_BUFFER(expected), NULL));
+  TEST_EXPECT_SUCCESS(_write_measured_payload(&writer, AZ_SPAN_FROM_BUFFER(long_text)));
+  az_span const expected_json = az_json_writer_get_bytes_used_in_destination(&writer);
+
+  uint8_t sent[1024] = { 0 };
+  uint8_t chunk[64] = { 0 };
+  _az_stream_context context = { .sent = AZ_SPAN_FROM_BUFFER(sent), .fail_after = -1 };
+  TEST_EXPECT_SUCCESS(az_json_writer_stream_init(
+      &writer, AZ_SPAN_FROM_BUFFER(chunk), _send_chunk, &context, NULL));
+  TEST_EXPECT_SUCCESS(_write_measured_payload(&writer, AZ_SPAN_FROM_BUFFER(long_text)));
+  int32_t const chunk_count = context.chunk_count;
+  assert_true(chunk_count > az_span_size(expected_json) / 64);
+  assert_int_equal(context.empty_chunk_count, 0);
+
+  // The last chunk is only sent when flushing, and flushing again sends an empty chunk.
+  TEST_EXPECT_SUCCESS(az_json_writer_flush(&writer));
+  assert_int_equal(context.chunk_count, chunk_count + 1);
+  TEST_EXPECT_SUCCESS(az_json_writer_flush(&writer));
+  assert_int_equal(context.chunk_count, chunk_count + 2);
+
+  assert_int_equal(writer.total_bytes_written, az_span_size(expected_json));
+  assert_true(az_span_is_content_equal(
+      az_span_slice(AZ_SPAN_FROM_BUFFER(sent), 0, az_span_size(expected_json)), expected_json));
+
+  // A chunk that can't be sent fails the append that needed the space, with the callback's result.
+  context = (_az_stream_context){ .sent = AZ_SPAN_FROM_BUFFER(sent), .fail_after = 1 };
+  TEST_EXPECT_SUCCESS(az_json_writer_stream_init(
+      &writer, AZ_SPAN_FROM_BUFFER(chunk), _send_chunk, &context, NULL));
+  assert_int_equal(
+      _write_measured_payload(&writer, AZ_SPAN_FROM_BUFFER(long_text)), AZ_ERROR_NOT_SUPPORTED);
+  assert_int_equal(context.chunk_count, 1);
+  assert_int_equal(az_json_writer_flush(&writer), AZ_ERROR_NOT_SUPPORTED);
+
+  // Once the callback succeeds again, the chunk that stayed in the buffer is sent.
+  context.fail_after = -1;
+  TEST_EXPECT_SUCCESS(az_json_writer_flush(&writer));
+  assert_int_equal(context.chunk_count, 2);
+  assert_int_equal(context.empty_chunk_count, 0);
+
+  // The same goes for a string that is written in chunks.
+  context = (_az_stream_context){ .sent = AZ_SPAN_FROM_BUFFER(sent), .fail_after = 0 };
+  TEST_EXPECT_SUCCESS(az_json_writer_stream_init(
+      &writer, AZ_SPAN_FROM_BUFFER(chunk), _send_chunk, &context, NULL));
+  TEST_EXPECT_SUCCESS(az_json_writer_append_begin_array(&writer));
+  assert_int_equal(
+      az_json_writer_append_string(&writer, az_span_create(long_text + 1, 70)),
+      AZ_ERROR_NOT_SUPPORTED);
+  assert_int_equal(context.chunk_count, 0);
+}
+
+static void test_json_writer_span_list_not_enough_space(void** state)
+{
+  (void)state;
+
+  uint8_t buffers[2][8] = { { 0 } };
+  az_span segments[2] = { AZ_SPAN_FROM_BUFFER(buffers[0]), AZ_SPAN_FROM_BUFFER(buffers[1]) };
+  az_span_list list = az_span_list_create(segments, 2);
+
+  az_json_writer writer = { 0 };
+  TEST_EXPECT_SUCCESS(az_json_writer_span_list_init(&writer, &list, NULL));
+  TEST_EXPECT_SUCCESS(az_json_writer_append_begin_array(&writer));
+  TEST_EXPECT_SUCCESS(az_json_writer_append_bool(&writer, true));
+  TEST_EXPECT_SUCCESS(az_json_writer_append_bool(&writer, false));
+  assert_int_equal(az_json_writer_append_bool(&writer, false), AZ_ERROR_NOT_ENOUGH_SPACE);
+
+  assert_int_equal(az_span_list_get_segment_count(list), 2);
+  assert_true(
+      az_span_is_content_equal(az_span_list_get_segment(list, 0), AZ_SPAN_FROM_STR("[true")));
+  assert_true(
+      az_span_is_content_equal(az_span_list_get_segment(list, 1), AZ_SPAN_FROM_STR(",false")));
+}
+
+static void test_json_writer_span_list_fills_buffers(void** state)
+{
+  (void)state;
+
+  uint8_t contiguous[512] = { 0 };
+  uint8_t buffers[3][128] = { { 0 } };
+  az_json_writer writer = { 0 };
+
+  // A buffer that is too small for the first token isn't left as an empty segment.
+  az_span segments[3] = { az_span_create(buffers[0], 3), AZ_SPAN_FROM_BUFFER(buffers[1]) };
+  az_span_list list = az_span_list_create(segments, 2);
+  TEST_EXPECT_SUCCESS(az_json_writer_span_list_init(&writer, &list, NULL));
+  TEST_EXPECT_SUCCESS(az_json_writer_append_int32(&writer, 12345));
+  assert_int_equal(az_span_list_get_segment_count(list), 1);
+  assert_true(
+      az_span_is_content_equal(az_span_list_get_segment(list, 0), AZ_SPAN_FROM_STR("12345")));
+
+  az_json_reader reader = { 0 };
+  TEST_EXPECT_SUCCESS(az_json_reader_span_list_init(&reader, list, NULL));
+  TEST_EXPECT_SUCCESS(az_json_reader_next_token(&reader));
+  assert_int_equal(reader.token.kind, AZ_JSON_TOKEN_NUMBER);
+
+  // Strings of more than 10 bytes don't need a whole chunk to be left in the buffer.
+  segments[0] = az_span_create(buffers[0], 64);
+  segments[1] = az_span_create(buffers[1], 64);
+  segments[2] = az_span_create(buffers[2], 64);
+  list = az_span_list_create(segments, 3);
+  TEST_EXPECT_SUCCESS(az_json_writer_span_list_init(&writer, &list, NULL));
+  TEST_EXPECT_SUCCESS(az_json_writer_append_begin_object(&writer));
+  TEST_EXPECT_SUCCESS(az_json_writer_append_property_name(&writer, AZ_SPAN_FROM_STR("a")));
+  TEST_EXPECT_SUCCESS(az_json_writer_append_string(&writer, AZ_SPAN_FROM_STR("hello world")));
+  TEST_EXPECT_SUCCESS(az_json_writer_append_end_object(&writer));
+  assert_int_equal(az_span_list_get_segment_count(list), 1);
+  assert_true(az_span_is_content_equal(
+      az_span_list_get_segment(list, 0), AZ_SPAN_FROM_STR("{\"a\":\"hello world\"}")));
+
+  // They fill each buffer to the end, and continue in the next one.
+  TEST_EXPECT_SUCCESS(az_json_writer_init(&writer, AZ_SPAN_FROM_BUFFER(contiguous), NULL));
+  TEST_EXPECT_SUCCESS(az_json_writer_append_begin_array(&writer));
+  for (int32_t i = 0; i < 16; i++)
+  {
+    TEST_EXPECT_SUCCESS(az_json_writer_append_string(&writer, AZ_SPAN_FROM_STR("hello\tworld")));
+  }
+  TEST_EXPECT_SUCCESS(az_json_writer_append_end_array(&writer));
+  az_span const expected = az_json_writer_get_bytes_used_in_destination(&writer);
+  assert_int_equal(az_span_size(expected), 241);
+
+  segments[0] = AZ_SPAN_FROM_BUFFER(buffers[0]);
+  segments[1] = AZ_SPAN_FROM_BUFFER(buffers[1]);
+  list = az_span_list_create(segments, 2);
+  TEST_EXPECT_SUCCESS(az_json_writer_span_list_init(&writer, &list, NULL));
+  TEST_EXPECT_SUCCESS(az_json_writer_append_begin_array(&writer));
+  for (int32_t i = 0; i < 16; i++)
+  {
+    TEST_EXPECT_SUCCESS(az_json_writer_append_string(&writer, AZ_SPAN_FROM_STR("hello\tworld")));
+  }
+  TEST_EXPECT_SUCCESS(az_json_writer_append_end_array(&writer));
+  assert_int_equal(az_span_list_get_segment_count(list), 2);
+  assert_int_equal(az_span_size(az_span_list_get_segment(list, 0)), 128);
+
+  uint8_t gathered[512] = { 0 };
+  az_span_list_copy(AZ_SPAN_FROM_BUFFER(gathered), list);
+  assert_true(
+      az_span_is_content_equal(az_span_create(gathered, az_span_list_size(list)), expected));
+
+  TEST_EXPECT_SUCCESS(az_json_reader_span_list_init(&reader, list, NULL));
+  int32_t token_count = 0;
+  while (az_result_succeeded(az_json_reader_next_token(&reader)))
+  {
+    token_count++;
+  }
+  assert_int_equal(token_count, 18);
+}
+
+static void test_json_writer_span_list_rollback(void** state)
+{
+  (void)state;
+
+  // An append that runs out of buffers partway through leaves the list as it was, so that the
+  // buffers it had moved on to can still be used.
+  uint8_t buffers[3][16] = { { 0 } };
+  az_span segments[3] = { AZ_SPAN_FROM_BUFFER(buffers[0]),
+                          az_span_create(buffers[1], 4),
+                          AZ_SPAN_FROM_BUFFER(buffers[2]) };
+  az_span_list list = az_span_list_create(segments, 3);
+
+  az_json_writer writer = { 0 };
+  TEST_EXPECT_SUCCESS(az_json_writer_span_list_init(&writer, &list, NULL));
+  TEST_EXPECT_SUCCESS(az_json_writer_append_begin_array(&writer));
+  TEST_EXPECT_SUCCESS(az_json_writer_append_string(&writer, AZ_SPAN_FROM_STR("hello world")));
+  assert_int_equal(
+      az_json_writer_append_string(&writer, AZ_SPAN_FROM_STR("a string that is too long")),
+      AZ_ERROR_NOT_ENOUGH_SPACE);
+  assert_int_equal(writer.total_bytes_written, 14);
+  assert_int_equal(az_span_list_get_segment_count(list), 1);
+  assert_true(az_span_is_content_equal(
+      az_span_list_get_segment(list, 0), AZ_SPAN_FROM_STR("[\"hello world\"")));
+
+  TEST_EXPECT_SUCCESS(az_json_writer_append_string(&writer, AZ_SPAN_FROM_STR("other string")));
+  TEST_EXPECT_SUCCESS(az_json_writer_append_end_array(&writer));
+
+  uint8_t gathered[64] = { 0 };
+  az_span_list_copy(AZ_SPAN_FROM_BUFFER(gathered), list);
+  assert_true(az_span_is_content_equal(
+      az_span_create(gathered, az_span_list_size(list)),
+      AZ_SPAN_FROM_STR("[\"hello world\",\"other string\"]")));
+  assert_int_equal(az_span_list_get_segment_count(list), 3);
+  assert_ptr_equal(az_span_ptr(az_span_list_get_segment(list, 1)), buffers[1]);
+  assert_int_equal(az_span_size(az_span_list_get_segment(list, 1)), 4);
+}
+
 static uint8_t json_chunked_array_256[10][256] = { 0 };
 static az_span json_buffers[10] = { 0 };
 
@@ -1117,6 +1826,74 @@ static void test_json_writer_large_string_chunked(void** state)
   }
 }
 
+static void test_json_writer_escape_positions(void** state)
+{
+  (void)state;
+
+  // A byte that needs escaping, before, within, and after the first vector (or 8 bytes) of plain
+  // bytes, for names and values, into one buffer and across a list of buffers.
+  uint8_t const special[] = { '"', '\\', '\n', 0x01, 0x1F };
+  char const* const escaped[] = { "\\\"", "\\\\", "\\n", "\\u0001", "\\u001F" };
+  for (size_t s = 0; s < sizeof(special); s++)
+  {
+    for (int32_t position = 0; position < 70; position++)
+    {
+      uint8_t value_buffer[70];
+      for (int32_t i = 0; i < 70; i++)
+      {
+        value_buffer[i] = (uint8_t)('a' + i % 26);
+      }
+      value_buffer[position] = special[s];
+      az_span const value = AZ_SPAN_FROM_BUFFER(value_buffer);
+
+      uint8_t expected_buffer[200] = { 0 };
+      az_span remainder = AZ_SPAN_FROM_BUFFER(expected_buffer);
+      remainder = az_span_copy(remainder, AZ_SPAN_FROM_STR("{\""));
+      for (int32_t name = 0; name < 2; name++)
+      {
+        remainder = az_span_copy(remainder, az_span_slice(value, 0, position));
+        remainder = az_span_copy(remainder, az_span_create_from_str((char*)(uintptr_t)escaped[s]));
+        remainder = az_span_copy(remainder, az_span_slice_to_end(value, position + 1));
+        remainder = az_span_copy(
+            remainder, name == 0 ? AZ_SPAN_FROM_STR("\":\"") : AZ_SPAN_FROM_STR("\"}"));
+      }
+      az_span const expected = az_span_slice(
+          AZ_SPAN_FROM_BUFFER(expected_buffer),
+          0,
+          _az_span_diff(remainder, AZ_SPAN_FROM_BUFFER(expected_buffer)));
+
+      uint8_t array[256] = { 0 };
+      az_json_writer writer = { 0 };
+      TEST_EXPECT_SUCCESS(az_json_writer_init(&writer, AZ_SPAN_FROM_BUFFER(array), NULL));
+      TEST_EXPECT_SUCCESS(az_json_writer_append_begin_object(&writer));
+      TEST_EXPECT_SUCCESS(az_json_writer_append_property_name(&writer, value));
+      TEST_EXPECT_SUCCESS(az_json_writer_append_string(&writer, value));
+      TEST_EXPECT_SUCCESS(az_json_writer_append_end_object(&writer));
+      assert_true(
+          az_span_is_content_equal(az_json_writer_get_bytes_used_in_destination(&writer), expected));
+
+      uint8_t buffers[16][64] = { { 0 } };
+      az_span segments[16];
+      for (int32_t i = 0; i < 16; i++)
+      {
+        segments[i] = AZ_SPAN_FROM_BUFFER(buffers[i]);
+      }
+      az_span_list list = az_span_list_create(segments, 16);
+      TEST_EXPECT_SUCCESS(az_json_writer_span_list_init(&writer, &list, NULL));
+      TEST_EXPECT_SUCCESS(az_json_writer_append_begin_object(&writer));
+      TEST_EXPECT_SUCCESS(az_json_writer_append_property_name(&writer, value));
+      TEST_EXPECT_SUCCESS(az_json_writer_append_string(&writer, value));
+      TEST_EXPECT_SUCCESS(az_json_writer_append_end_object(&writer));
+      assert_int_equal(writer.total_bytes_written, az_span_size(expected));
+
+      uint8_t gathered[256] = { 0 };
+      az_span_list_copy(AZ_SPAN_FROM_BUFFER(gathered), list);
+      assert_true(az_span_is_content_equal(
+          az_span_create(gathered, az_span_list_size(list)), expected));
+    }
+  }
+}
+
 /** Json reader **/
 az_result read_write(az_span input, az_span* output, int32_t* o);
 az_result read_write_token(
@@ -1813,6 +2590,328 @@ static void test_json_reader_incomplete(void** state)
       AZ_SPAN_FROM_STR("{\"name\":[1, 2, [], 3] "), AZ_ERROR_UNEXPECTED_END);
 }
 
+// Reads all of the tokens of json, split into segments of segment_size bytes (or not split when 0),
+// and appends each string token's escape flag and value to ref_summary.
+static az_result _summarize_json_strings(az_span json, int32_t segment_size, az_span* ref_summary)
+{
+  az_span segments[512] = { 0 };
+  int32_t segment_count = 0;
+  if (segment_size == 0)
+  {
+    segments[segment_count++] = json;
+  }
+  else
+  {
+    for (int32_t i = 0; i < az_span_size(json); i += segment_size)
+    {
+      int32_t const end = i + segment_size < az_span_size(json) ? i + segment_size
+                                                                : az_span_size(json);
+      segments[segment_count++] = az_span_slice(json, i, end);
+    }
+  }
+
+  az_json_reader reader = { 0 };
+  _az_RETURN_IF_FAILED(az_json_reader_chunked_init(&reader, segments, segment_count, NULL));
+
+  az_result result = AZ_OK;
+  while (az_result_succeeded(result = az_json_reader_next_token(&reader)))
+  {
+    if (reader.token.kind == AZ_JSON_TOKEN_STRING
+        || reader.token.kind == AZ_JSON_TOKEN_PROPERTY_NAME)
+    {
+      *ref_summary = az_span_copy_u8(
+          *ref_summary, reader.token._internal.string_has_escaped_chars ? (uint8_t)'E' : '-');
+      *ref_summary = az_json_token_copy_into_span(&reader.token, *ref_summary);
+      *ref_summary = az_span_copy_u8(*ref_summary, '|');
+    }
+  }
+  return result == AZ_ERROR_JSON_READER_DONE ? AZ_OK : result;
+}
+
+static void test_json_reader_long_strings_chunked(void** state)
+{
+  (void)state;
+
+  az_span const json = AZ_SPAN_FROM_STR(
+      "{\"url\":\"https://contoso.blob.core.windows.net/updates/manifest-2023.01.10.json?sv=2021\","
+      "\"hash\":\"JX8bZ5e1Ym3nKq0f7m7cQ7oYw8P0yVbH3o1y2M8aXoQ=\","
+      "\"manifest\":\"{\\\"updateId\\\":{\\\"provider\\\":\\\"Contoso\\\"},\\\"files\\\":"
+      "[\\\"a.swu\\\"],\\\"note\\\":\\\"tab\\there\\\\u00e9\\u00E9\\\"}\","
+      "\"s\":\"x\",\"e\":\"\",\"tail\":\"0123456789abcdef0123456789abcdef0123456789\\/\"}");
+
+  uint8_t expected_buffer[1024] = { 0 };
+  az_span remainder = AZ_SPAN_FROM_BUFFER(expected_buffer);
+  TEST_EXPECT_SUCCESS(_summarize_json_strings(json, 0, &remainder));
+  az_span const expected = az_span_create(
+      expected_buffer, _az_span_diff(remainder, AZ_SPAN_FROM_BUFFER(expected_buffer)));
+
+  // Splitting the input at any point must not change the strings read, or whether they had
+  // escaped characters.
+  for (int32_t segment_size = 1; segment_size <= 70; segment_size++)
+  {
+    uint8_t actual_buffer[1024] = { 0 };
+    remainder = AZ_SPAN_FROM_BUFFER(actual_buffer);
+    TEST_EXPECT_SUCCESS(_summarize_json_strings(json, segment_size, &remainder));
+    az_span const actual = az_span_create(
+        actual_buffer, _az_span_diff(remainder, AZ_SPAN_FROM_BUFFER(actual_buffer)));
+    assert_true(az_span_is_content_equal(actual, expected));
+  }
+}
+
+static void test_json_reader_long_strings_invalid(void** state)
+{
+  (void)state;
+
+  // Invalid bytes and escapes far into a string, past the first vector or word of it.
+  az_span const invalid_json[] = {
+    AZ_SPAN_FROM_STR("\"0123456789abcdef0123456789abcdef0123456789\x01 abc\""),
+    AZ_SPAN_FROM_STR("\"0123456789abcdef0123456789abcdef0123456789\x1f\""),
+    AZ_SPAN_FROM_STR("\"0123456789abcdef0123456789abcdef0123456789\\x\""),
+    AZ_SPAN_FROM_STR("\"0123456789abcdef0123456789abcdef0123456789\\u12G4\""),
+    AZ_SPAN_FROM_STR("\"0123456789abcdef0123456789abcdef0123456789"),
+  };
+
+  for (size_t i = 0; i < sizeof(invalid_json) / sizeof(invalid_json[0]); i++)
+  {
+    for (int32_t segment_size = 0; segment_size <= 20; segment_size += 7)
+    {
+      uint8_t summary_buffer[256] = { 0 };
+      az_span summary = AZ_SPAN_FROM_BUFFER(summary_buffer);
+      assert_true(
+          az_result_failed(_summarize_json_strings(invalid_json[i], segment_size, &summary)));
+    }
+  }
+
+  // Non-ASCII bytes are read as is.
+  uint8_t summary_buffer[256] = { 0 };
+  az_span summary = AZ_SPAN_FROM_BUFFER(summary_buffer);
+  TEST_EXPECT_SUCCESS(_summarize_json_strings(
+      AZ_SPAN_FROM_STR("\"0123456789abcdef0123456789abcdef\xC3\xA9\x7F\xFF\""), 0, &summary));
+  assert_true(az_span_is_content_equal(
+      az_span_create(summary_buffer, 38),
+      AZ_SPAN_FROM_STR("-0123456789abcdef0123456789abcdef\xC3\xA9\x7F\xFF|")));
+}
+
+// Writes the kind and the (unescaped) text of every token in json, read with segments of
+// segment_size bytes (or in one segment when it's 0), into ref_summary.
+static az_result _summarize_json_tokens(az_span json, int32_t segment_size, az_span* ref_summary)
+{
+  if (segment_size == 0)
+  {
+    segment_size = az_span_size(json);
+  }
+
+  az_span segments[512] = { 0 };
+  int32_t segment_count = 0;
+  for (int32_t i = 0; i < az_span_size(json); i += segment_size)
+  {
+    int32_t const end
+        = i + segment_size < az_span_size(json) ? i + segment_size : az_span_size(json);
+    segments[segment_count++] = az_span_slice(json, i, end);
+  }
+
+  az_json_reader reader = { 0 };
+  _az_RETURN_IF_FAILED(az_json_reader_chunked_init(&reader, segments, segment_count, NULL));
+
+  az_result result = AZ_OK;
+  while (az_result_succeeded(result = az_json_reader_next_token(&reader)))
+  {
+    *ref_summary = az_span_copy_u8(*ref_summary, (uint8_t)('A' + reader.token.kind));
+    *ref_summary = az_json_token_copy_into_span(&reader.token, *ref_summary);
+    *ref_summary = az_span_copy_u8(*ref_summary, '|');
+  }
+  return result == AZ_ERROR_JSON_READER_DONE ? AZ_OK : result;
+}
+
+static void test_json_reader_pretty_printed(void** state)
+{
+  (void)state;
+
+  az_span const minified = AZ_SPAN_FROM_STR(
+      "{\"deviceId\":\"thermostat-01\",\"properties\":{\"desired\":{\"targetTemperature\":21.5,"
+      "\"schedule\":[6,12,-18,2.5e1,0],\"enabled\":true,\"mode\":null,\"eco\":false}},"
+      "\"tags\":[\"a\",\"b\"]}");
+  az_span const pretty_printed = AZ_SPAN_FROM_STR(
+      "\r\n{\n  \"deviceId\" : \"thermostat-01\",\n  \"properties\": {\n"
+      "                                          \"desired\": {\n"
+      "\t\t\t\"targetTemperature\":21.5  ,\n"
+      "      \"schedule\": [ 6,\n12\t,-18\r\n,2.5e1 , 0\n                 ],\n"
+      "      \"enabled\": true  ,\r\n      \"mode\": null\t,\n      \"eco\": false\n"
+      "    }\n  },\n  \"tags\": [\"a\",\"b\"]\n}\n                                        ");
+
+  uint8_t expected_buffer[512] = { 0 };
+  az_span remainder = AZ_SPAN_FROM_BUFFER(expected_buffer);
+  TEST_EXPECT_SUCCESS(_summarize_json_tokens(minified, 0, &remainder));
+  az_span const expected = az_span_create(
+      expected_buffer, _az_span_diff(remainder, AZ_SPAN_FROM_BUFFER(expected_buffer)));
+
+  // Whitespace, however long and wherever it is split, must not change the tokens read.
+  for (int32_t segment_size = 0; segment_size <= 50; segment_size++)
+  {
+    uint8_t actual_buffer[512] = { 0 };
+    remainder = AZ_SPAN_FROM_BUFFER(actual_buffer);
+    TEST_EXPECT_SUCCESS(_summarize_json_tokens(pretty_printed, segment_size, &remainder));
+    az_span const actual = az_span_create(
+        actual_buffer, _az_span_diff(remainder, AZ_SPAN_FROM_BUFFER(actual_buffer)));
+    assert_true(az_span_is_content_equal(actual, expected));
+  }
+
+  // Only space, tab, line feed and carriage return are whitespace, even far into a long run.
+  az_span const invalid_json[] = {
+    AZ_SPAN_FROM_STR("[1,                                        \v2]"),
+    AZ_SPAN_FROM_STR("[1,          \n\n\n\n\n\n\n\n\r\t\t\t\t\t\t\t\t\t\f2]"),
+    AZ_SPAN_FROM_STR("[1                                          \x01]"),
+    AZ_SPAN_FROM_STR("[1                                          \xA0]"),
+    AZ_SPAN_FROM_STR("[1\v]"),
+    AZ_SPAN_FROM_STR("{\"a\":                                       "),
+  };
+
+  for (size_t i = 0; i < sizeof(invalid_json) / sizeof(invalid_json[0]); i++)
+  {
+    for (int32_t segment_size = 0; segment_size <= 20; segment_size += 5)
+    {
+      uint8_t summary_buffer[256] = { 0 };
+      az_span summary = AZ_SPAN_FROM_BUFFER(summary_buffer);
+      assert_true(
+          az_result_failed(_summarize_json_tokens(invalid_json[i], segment_size, &summary)));
+    }
+  }
+}
+
+// Reads json as if it was received chunk_size bytes at a time, pushing each chunk to the reader
+// only once it needs more input.
+static az_result _summarize_pushed_json_tokens(
+    az_span json,
+    int32_t chunk_size,
+    az_span carry_buffer,
+    az_span* ref_summary)
+{
+  az_json_reader reader = { 0 };
+  _az_RETURN_IF_FAILED(az_json_reader_push_init(&reader, carry_buffer, NULL));
+
+  int32_t pushed_size = 0;
+  az_result result = AZ_ERROR_JSON_READER_NEED_MORE_INPUT;
+  while (true)
+  {
+    if (result == AZ_ERROR_JSON_READER_NEED_MORE_INPUT)
+    {
+      int32_t const end = pushed_size + chunk_size < az_span_size(json) ? pushed_size + chunk_size
+                                                                       : az_span_size(json);
+      _az_RETURN_IF_FAILED(az_json_reader_push(
+          &reader, az_span_slice(json, pushed_size, end), end == az_span_size(json)));
+      pushed_size = end;
+    }
+    else if (az_result_succeeded(result))
+    {
+      *ref_summary = az_span_copy_u8(*ref_summary, (uint8_t)('A' + reader.token.kind));
+      *ref_summary = az_json_token_copy_into_span(&reader.token, *ref_summary);
+      *ref_summary = az_span_copy_u8(*ref_summary, '|');
+    }
+    else
+    {
+      break;
+    }
+    result = az_json_reader_next_token(&reader);
+  }
+
+  return result == AZ_ERROR_JSON_READER_DONE ? AZ_OK : result;
+}
+
+static void test_json_reader_push(void** state)
+{
+  (void)state;
+
+  az_span const json = AZ_SPAN_FROM_STR(
+      "\r\n{\n  \"deviceId\" : \"thermostat-01\",\n  \"properties\": {\n"
+      "                                          \"desired\": {\n"
+      "\t\t\t\"targetTemperature\":21.5  ,\"n\\\"ame\":\"a\\\\b\\u00e9\\/\",\n"
+      "      \"schedule\": [ 6,\n12\t,-18\r\n,2.5e1 , 0\n                 ],\n"
+      "      \"enabled\": true  ,\r\n      \"mode\": null\t,\n      \"eco\": false\n"
+      "    }\n  },\n  \"tags\": [\"a\",\"b\", [], {}, -0.125e-2]\n}\n                          ");
+
+  uint8_t expected_buffer[512] = { 0 };
+  az_span remainder = AZ_SPAN_FROM_BUFFER(expected_buffer);
+  TEST_EXPECT_SUCCESS(_summarize_json_tokens(json, 0, &remainder));
+  az_span const expected = az_span_create(
+      expected_buffer, _az_span_diff(remainder, AZ_SPAN_FROM_BUFFER(expected_buffer)));
+
+  // Tokens read from pushed chunks are the same, wherever the chunks end.
+  uint8_t carry_buffer[32] = { 0 };
+  for (int32_t chunk_size = 1; chunk_size <= az_span_size(json); chunk_size++)
+  {
+    uint8_t actual_buffer[512] = { 0 };
+    remainder = AZ_SPAN_FROM_BUFFER(actual_buffer);
+    TEST_EXPECT_SUCCESS(_summarize_pushed_json_tokens(
+        json, chunk_size, AZ_SPAN_FROM_BUFFER(carry_buffer), &remainder));
+    az_span const actual = az_span_create(
+        actual_buffer, _az_span_diff(remainder, AZ_SPAN_FROM_BUFFER(actual_buffer)));
+    assert_true(az_span_is_content_equal(actual, expected));
+  }
+
+  // A single number, or literal, is only complete once the end of the payload is pushed.
+  az_json_reader reader = { 0 };
+  TEST_EXPECT_SUCCESS(az_json_reader_push_init(&reader, AZ_SPAN_FROM_BUFFER(carry_buffer), NULL));
+  assert_int_equal(az_json_reader_next_token(&reader), AZ_ERROR_JSON_READER_NEED_MORE_INPUT);
+  TEST_EXPECT_SUCCESS(az_json_reader_push(&reader, AZ_SPAN_FROM_STR(" 12"), false));
+  assert_int_equal(az_json_reader_next_token(&reader), AZ_ERROR_JSON_READER_NEED_MORE_INPUT);
+  TEST_EXPECT_SUCCESS(az_json_reader_push(&reader, AZ_SPAN_FROM_STR("34"), false));
+  assert_int_equal(az_json_reader_next_token(&reader), AZ_ERROR_JSON_READER_NEED_MORE_INPUT);
+  TEST_EXPECT_SUCCESS(az_json_reader_push(&reader, AZ_SPAN_EMPTY, true));
+  TEST_EXPECT_SUCCESS(az_json_reader_next_token(&reader));
+  assert_int_equal(reader.token.kind, AZ_JSON_TOKEN_NUMBER);
+  assert_true(az_span_is_content_equal(reader.token.slice, AZ_SPAN_FROM_STR("1234")));
+  assert_int_equal(az_json_reader_next_token(&reader), AZ_ERROR_JSON_READER_DONE);
+
+  TEST_EXPECT_SUCCESS(az_json_reader_push_init(&reader, AZ_SPAN_FROM_BUFFER(carry_buffer), NULL));
+  TEST_EXPECT_SUCCESS(az_json_reader_push(&reader, AZ_SPAN_FROM_STR("true"), false));
+  TEST_EXPECT_SUCCESS(az_json_reader_next_token(&reader));
+  assert_int_equal(reader.token.kind, AZ_JSON_TOKEN_TRUE);
+  assert_int_equal(az_json_reader_next_token(&reader), AZ_ERROR_JSON_READER_NEED_MORE_INPUT);
+  TEST_EXPECT_SUCCESS(az_json_reader_push(&reader, AZ_SPAN_FROM_STR(" x"), true));
+  assert_int_equal(az_json_reader_next_token(&reader), AZ_ERROR_UNEXPECTED_CHAR);
+
+  // Invalid JSON is reported wherever the chunks end, and so is a truncated payload once its end
+  // is pushed.
+  az_span const invalid_json[] = {
+    AZ_SPAN_FROM_STR("{\"a\":[1,2,]}"),
+    AZ_SPAN_FROM_STR("{\"a\":[1,2]"),
+    AZ_SPAN_FROM_STR("{\"a\" 1}"),
+    AZ_SPAN_FROM_STR("[\"a\tb\"]"),
+    AZ_SPAN_FROM_STR("[1] 2"),
+    AZ_SPAN_FROM_STR("   "),
+  };
+  for (size_t i = 0; i < sizeof(invalid_json) / sizeof(invalid_json[0]); i++)
+  {
+    for (int32_t chunk_size = 1; chunk_size <= az_span_size(invalid_json[i]); chunk_size++)
+    {
+      uint8_t summary_buffer[256] = { 0 };
+      az_span summary = AZ_SPAN_FROM_BUFFER(summary_buffer);
+      az_result const result = _summarize_pushed_json_tokens(
+          invalid_json[i], chunk_size, AZ_SPAN_FROM_BUFFER(carry_buffer), &summary);
+      assert_true(result == AZ_ERROR_UNEXPECTED_CHAR || result == AZ_ERROR_UNEXPECTED_END);
+    }
+  }
+
+  // A token, with the separator right before it, must fit in the carry buffer when it straddles two
+  // chunks.
+  uint8_t small_carry_buffer[16] = { 0 };
+  uint8_t summary_buffer[256] = { 0 };
+  az_span summary = AZ_SPAN_FROM_BUFFER(summary_buffer);
+  assert_int_equal(
+      _summarize_pushed_json_tokens(
+          AZ_SPAN_FROM_STR("[\"abcdefghijklmnopq\"]"),
+          4,
+          AZ_SPAN_FROM_BUFFER(small_carry_buffer),
+          &summary),
+      AZ_ERROR_NOT_ENOUGH_SPACE);
+  summary = AZ_SPAN_FROM_BUFFER(summary_buffer);
+  TEST_EXPECT_SUCCESS(_summarize_pushed_json_tokens(
+      AZ_SPAN_FROM_STR("[\"abcdefghij\"            ,\"abcdefghij\"]"),
+      4,
+      AZ_SPAN_FROM_BUFFER(small_carry_buffer),
+      &summary));
+}
+
 static void test_json_skip_children(void** state)
 {
   (void)state;
@@ -1855,6 +2954,91 @@ static void test_json_skip_children(void** state)
   assert_int_equal(reader.current_depth, 1);
 }
 
+static void test_json_skip_children_fast(void** state)
+{
+  (void)state;
+
+  // Brackets within strings, and escaped quotes and backslashes, around and across vector widths.
+  az_span const json = AZ_SPAN_FROM_STR(
+      "{\"$metadata\":{\"$lastUpdated\":\"2021-01-01T00:00:00Z\",\"a\":{\"b\":[1,2.5e3,true,null]},"
+      "\"text\":\"}]}]}]}]{[{[{[{[ \\\"}] \\\\\",\"long\":\"0123456789abcdef0123456789abcdef\\\\\"},"
+      "\"x\":[[],{},[[{\"y\":\"\\u005d\"}]]]   ,\"z\":1}");
+
+  az_json_reader expected = { 0 };
+  TEST_EXPECT_SUCCESS(az_json_reader_init(&expected, json, NULL));
+  TEST_EXPECT_SUCCESS(az_json_reader_next_token(&expected));
+  TEST_EXPECT_SUCCESS(az_json_reader_next_token(&expected));
+  TEST_EXPECT_SUCCESS(az_json_reader_skip_children(&expected));
+
+  // The same payload, over one buffer, then split in two at every position.
+  for (int32_t split = 0; split < az_span_size(json); split++)
+  {
+    az_span segments[2] = { az_span_slice(json, 0, split), az_span_slice_to_end(json, split) };
+    az_json_reader reader = { 0 };
+    if (split == 0)
+    {
+      TEST_EXPECT_SUCCESS(az_json_reader_init(&reader, json, NULL));
+    }
+    else
+    {
+      TEST_EXPECT_SUCCESS(az_json_reader_chunked_init(&reader, segments, 2, NULL));
+    }
+
+    TEST_EXPECT_SUCCESS(az_json_reader_next_token(&reader));
+    TEST_EXPECT_SUCCESS(az_json_reader_next_token(&reader));
+    assert_int_equal(reader.token.kind, AZ_JSON_TOKEN_PROPERTY_NAME);
+    TEST_EXPECT_SUCCESS(az_json_reader_skip_children_fast(&reader));
+    assert_int_equal(reader.token.kind, AZ_JSON_TOKEN_END_OBJECT);
+    assert_int_equal(reader.current_depth, 1);
+    assert_ptr_equal(az_span_ptr(reader.token.slice), az_span_ptr(expected.token.slice));
+
+    TEST_EXPECT_SUCCESS(az_json_reader_next_token(&reader));
+    assert_true(az_json_token_is_text_equal(&reader.token, AZ_SPAN_FROM_STR("x")));
+    TEST_EXPECT_SUCCESS(az_json_reader_next_token(&reader));
+    TEST_EXPECT_SUCCESS(az_json_reader_skip_children_fast(&reader));
+    assert_int_equal(reader.token.kind, AZ_JSON_TOKEN_END_ARRAY);
+    TEST_EXPECT_SUCCESS(az_json_reader_next_token(&reader));
+    TEST_EXPECT_SUCCESS(az_json_reader_next_token(&reader));
+    assert_int_equal(reader.token.kind, AZ_JSON_TOKEN_NUMBER);
+
+    // Values that aren't objects or arrays have no children.
+    TEST_EXPECT_SUCCESS(az_json_reader_skip_children_fast(&reader));
+    assert_int_equal(reader.token.kind, AZ_JSON_TOKEN_NUMBER);
+    TEST_EXPECT_SUCCESS(az_json_reader_next_token(&reader));
+    assert_int_equal(az_json_reader_next_token(&reader), AZ_ERROR_JSON_READER_DONE);
+  }
+
+  // Malformed children are reported, and leave the reader where it was, but only their brackets
+  // and strings are looked at.
+  az_span const invalid_json[] = {
+    AZ_SPAN_FROM_STR("[{]}"),
+    AZ_SPAN_FROM_STR("{\"a\":[1,2}"),
+    AZ_SPAN_FROM_STR("{\"a\":[1,2]"),
+    AZ_SPAN_FROM_STR("[\"a]\\\"]"),
+    AZ_SPAN_FROM_STR("[\"a\tb\"]"),
+  };
+  az_result const expected_results[] = {
+    AZ_ERROR_UNEXPECTED_CHAR, AZ_ERROR_UNEXPECTED_CHAR, AZ_ERROR_UNEXPECTED_END,
+    AZ_ERROR_UNEXPECTED_END,  AZ_ERROR_UNEXPECTED_CHAR,
+  };
+  for (size_t i = 0; i < sizeof(invalid_json) / sizeof(invalid_json[0]); i++)
+  {
+    az_json_reader reader = { 0 };
+    TEST_EXPECT_SUCCESS(az_json_reader_init(&reader, invalid_json[i], NULL));
+    TEST_EXPECT_SUCCESS(az_json_reader_next_token(&reader));
+    az_json_reader const before = reader;
+    assert_int_equal(az_json_reader_skip_children_fast(&reader), expected_results[i]);
+    assert_int_equal(reader._internal.bytes_consumed, before._internal.bytes_consumed);
+    assert_int_equal(reader.token.kind, before.token.kind);
+  }
+
+  az_json_reader reader = { 0 };
+  TEST_EXPECT_SUCCESS(az_json_reader_init(&reader, AZ_SPAN_FROM_STR("[[1,x,-],{:}]"), NULL));
+  TEST_EXPECT_SUCCESS(az_json_reader_next_token(&reader));
+  TEST_EXPECT_SUCCESS(az_json_reader_skip_children_fast(&reader));
+  assert_int_equal(reader.token.kind, AZ_JSON_TOKEN_END_ARRAY);
+}
+
 /** Json Value **/
 static void test_json_value(void** state)
 {
@@ -2564,6 +3748,122 @@ static void test_az_json_token_number_too_large(void** state)
   // assert_int_equal(az_json_token_get_double(&json_number, &actual_d), AZ_ERROR_UNEXPECTED_CHAR);
 }
 
+// The value of a number token must be that of its text, whether the reader kept it or not.
+static void _az_json_token_number_check(az_json_token const* json_number, az_span text)
+{
+  int32_t actual_i32 = 0;
+  int32_t expected_i32 = 0;
+  az_result result = az_span_atoi32(text, &expected_i32);
+  assert_int_equal(az_json_token_get_int32(json_number, &actual_i32), result);
+  assert_int_equal(actual_i32, az_result_succeeded(result) ? expected_i32 : 0);
+
+  uint32_t actual_u32 = 0;
+  uint32_t expected_u32 = 0;
+  result = az_span_atou32(text, &expected_u32);
+  assert_int_equal(az_json_token_get_uint32(json_number, &actual_u32), result);
+  assert_int_equal(actual_u32, az_result_succeeded(result) ? expected_u32 : 0);
+
+  int64_t actual_i64 = 0;
+  int64_t expected_i64 = 0;
+  result = az_span_atoi64(text, &expected_i64);
+  assert_int_equal(az_json_token_get_int64(json_number, &actual_i64), result);
+  assert_true(actual_i64 == (az_result_succeeded(result) ? expected_i64 : 0));
+
+  uint64_t actual_u64 = 0;
+  uint64_t expected_u64 = 0;
+  result = az_span_atou64(text, &expected_u64);
+  assert_int_equal(az_json_token_get_uint64(json_number, &actual_u64), result);
+  assert_true(actual_u64 == (az_result_succeeded(result) ? expected_u64 : 0));
+
+  // Compare the bits, so that -0 and 0 are told apart.
+  double actual_d = 0;
+  double expected_d = 0;
+  TEST_EXPECT_SUCCESS(az_span_atod(text, &expected_d));
+  TEST_EXPECT_SUCCESS(az_json_token_get_double(json_number, &actual_d));
+  assert_memory_equal(&actual_d, &expected_d, sizeof(double));
+}
+
+static void test_az_json_token_number_integer(void** state)
+{
+  (void)state;
+
+  az_span const numbers[] = {
+    AZ_SPAN_LITERAL_FROM_STR("0"),
+    AZ_SPAN_LITERAL_FROM_STR("-0"),
+    AZ_SPAN_LITERAL_FROM_STR("7"),
+    AZ_SPAN_LITERAL_FROM_STR("-42"),
+    AZ_SPAN_LITERAL_FROM_STR("2147483647"),
+    AZ_SPAN_LITERAL_FROM_STR("2147483648"),
+    AZ_SPAN_LITERAL_FROM_STR("-2147483648"),
+    AZ_SPAN_LITERAL_FROM_STR("-2147483649"),
+    AZ_SPAN_LITERAL_FROM_STR("4294967295"),
+    AZ_SPAN_LITERAL_FROM_STR("4294967296"),
+    AZ_SPAN_LITERAL_FROM_STR("9007199254740993"),
+    AZ_SPAN_LITERAL_FROM_STR("-9007199254740993"),
+    AZ_SPAN_LITERAL_FROM_STR("9223372036854775807"),
+    AZ_SPAN_LITERAL_FROM_STR("9223372036854775808"),
+    AZ_SPAN_LITERAL_FROM_STR("-9223372036854775808"),
+    AZ_SPAN_LITERAL_FROM_STR("-9223372036854775809"),
+    AZ_SPAN_LITERAL_FROM_STR("9999999999999999999"),
+    AZ_SPAN_LITERAL_FROM_STR("18446744073709551615"),
+    AZ_SPAN_LITERAL_FROM_STR("18446744073709551616"),
+    AZ_SPAN_LITERAL_FROM_STR("1.5"),
+    AZ_SPAN_LITERAL_FROM_STR("-10.0"),
+    AZ_SPAN_LITERAL_FROM_STR("1e3"),
+    AZ_SPAN_LITERAL_FROM_STR("-2E-2"),
+  };
+
+  for (size_t i = 0; i < sizeof(numbers) / sizeof(numbers[0]); i++)
+  {
+    az_span const text = numbers[i];
+    az_json_reader reader = { 0 };
+
+    TEST_EXPECT_SUCCESS(az_json_reader_init(&reader, text, NULL));
+    TEST_EXPECT_SUCCESS(az_json_reader_next_token(&reader));
+    assert_int_equal(reader.token.kind, AZ_JSON_TOKEN_NUMBER);
+    _az_json_token_number_check(&reader.token, text);
+
+    // Within an array, the number ends at a delimiter rather than at the end of the payload.
+    char array_buffer[32] = { 0 };
+    az_span array = AZ_SPAN_FROM_BUFFER(array_buffer);
+    az_span remainder = az_span_copy_u8(array, '[');
+    remainder = az_span_copy(remainder, text);
+    remainder = az_span_copy(remainder, AZ_SPAN_FROM_STR(",1]"));
+    array = az_span_slice(array, 0, _az_span_diff(remainder, array));
+
+    TEST_EXPECT_SUCCESS(az_json_reader_init(&reader, array, NULL));
+    TEST_EXPECT_SUCCESS(az_json_reader_next_token(&reader));
+    TEST_EXPECT_SUCCESS(az_json_reader_next_token(&reader));
+    _az_json_token_number_check(&reader.token, text);
+
+    // Read one byte at a time, so that every digit is in a different buffer.
+    _az_split_buffers_single_byte(array, _az_buffers64_one);
+    TEST_EXPECT_SUCCESS(
+        az_json_reader_chunked_init(&reader, _az_buffers64_one, az_span_size(array), NULL));
+    TEST_EXPECT_SUCCESS(az_json_reader_next_token(&reader));
+    TEST_EXPECT_SUCCESS(az_json_reader_next_token(&reader));
+    assert_true(reader.token._internal.is_multisegment);
+    _az_json_token_number_check(&reader.token, text);
+
+    // A token that wasn't read by a reader has its text parsed.
+    az_json_token const token = {
+      .slice = text,
+      .kind = AZ_JSON_TOKEN_NUMBER,
+      .size = az_span_size(text),
+    };
+    _az_json_token_number_check(&token, text);
+  }
+
+  // The value of the previous number isn't kept for the next one.
+  az_json_reader reader = { 0 };
+  TEST_EXPECT_SUCCESS(az_json_reader_init(&reader, AZ_SPAN_FROM_STR("[12,1.5]"), NULL));
+  TEST_EXPECT_SUCCESS(az_json_reader_next_token(&reader));
+  TEST_EXPECT_SUCCESS(az_json_reader_next_token(&reader));
+  TEST_EXPECT_SUCCESS(az_json_reader_next_token(&reader));
+  int64_t value = 0;
+  assert_int_equal(az_json_token_get_int64(&reader.token, &value), AZ_ERROR_UNEXPECTED_CHAR);
+}
+
 static void _az_json_token_literal_helper(az_span json, bool expected)
 {
   az_json_reader reader = { 0 };
@@ -3226,6 +4526,94 @@ static void test_az_json_string_unescape_same_buffer(void** state)
   }
 }
 
+static void test_az_json_string_unescape_unicode(void** state)
+{
+  (void)state;
+
+  // One, two, three and four byte UTF-8 sequences, and lone surrogates.
+  {
+    uint8_t buffer[64];
+    az_span const unescaped = az_json_string_unescape(
+        AZ_SPAN_FROM_STR("\\u0048i \\u00e9\\u20AC \\uD83D\\uDE00 \\uDE00\\uD83Dx\\uD83D"),
+        AZ_SPAN_FROM_BUFFER(buffer));
+    az_span const expected = AZ_SPAN_FROM_STR(
+        "Hi \xC3\xA9\xE2\x82\xAC \xF0\x9F\x98\x80 \xEF\xBF\xBD\xEF\xBF\xBDx\xEF\xBF\xBD");
+    assert_true(az_span_is_content_equal(expected, unescaped));
+  }
+
+  // In place, with long runs between the escape sequences.
+  {
+    az_span original = az_span_create_from_str(
+        strdup("a string long enough to be copied in bulk, \\u00e9, and some more of it\\n"
+               "\\uD83D\\uDE00\\uD83D\\uDE00 then the end of the string, with no escapes"));
+    az_span const expected = AZ_SPAN_FROM_STR(
+        "a string long enough to be copied in bulk, \xC3\xA9, and some more of it\n"
+        "\xF0\x9F\x98\x80\xF0\x9F\x98\x80 then the end of the string, with no escapes");
+
+    original = az_json_string_unescape(original, original);
+
+    assert_true(az_span_is_content_equal(expected, original));
+    _az_span_free(&original);
+  }
+
+  // Unescaping stops at a malformed escape sequence.
+  {
+    uint8_t buffer[16];
+    assert_true(az_span_is_content_equal(
+        AZ_SPAN_FROM_STR("ab"),
+        az_json_string_unescape(AZ_SPAN_FROM_STR("ab\\u00Xe"), AZ_SPAN_FROM_BUFFER(buffer))));
+    assert_true(az_span_is_content_equal(
+        AZ_SPAN_FROM_STR("ab"),
+        az_json_string_unescape(AZ_SPAN_FROM_STR("ab\\u00"), AZ_SPAN_FROM_BUFFER(buffer))));
+  }
+
+  // A string read from one buffer.
+  az_span const json = AZ_SPAN_FROM_STR("\"x\\u00e9\\uD83D\\uDE00\\\\y\\uDE00\\u20ACz\"");
+  az_span const expected
+      = AZ_SPAN_FROM_STR("x\xC3\xA9\xF0\x9F\x98\x80\\y\xEF\xBF\xBD\xE2\x82\xACz");
+  char dest[32];
+  int32_t length = 0;
+
+  az_json_reader reader = { 0 };
+  assert_int_equal(az_json_reader_init(&reader, json, NULL), AZ_OK);
+  assert_int_equal(az_json_reader_next_token(&reader), AZ_OK);
+  assert_int_equal(az_json_token_get_string(&reader.token, dest, 32, &length), AZ_OK);
+  assert_true(az_span_is_content_equal(expected, az_span_create((uint8_t*)dest, length)));
+  assert_int_equal(dest[length], 0);
+
+  // Not enough space for the null terminator, or in the middle of a UTF-8 sequence.
+  assert_int_equal(
+      az_json_token_get_string(&reader.token, dest, az_span_size(expected), &length),
+      AZ_ERROR_NOT_ENOUGH_SPACE);
+  assert_int_equal(
+      az_json_token_get_string(&reader.token, dest, 6, &length), AZ_ERROR_NOT_ENOUGH_SPACE);
+  assert_int_equal(
+      az_json_reader_init(
+          &reader, AZ_SPAN_FROM_STR("\"a run long enough to be copied in bulk, \\n\""), NULL),
+      AZ_OK);
+  assert_int_equal(az_json_reader_next_token(&reader), AZ_OK);
+  assert_int_equal(
+      az_json_token_get_string(&reader.token, dest, 32, &length), AZ_ERROR_NOT_ENOUGH_SPACE);
+
+  // The first string, split in three at every position.
+  int32_t const size = az_span_size(json);
+  for (int32_t first = 1; first < size - 1; first++)
+  {
+    for (int32_t second = first + 1; second < size; second++)
+    {
+      az_span segments[] = {
+        az_span_slice(json, 0, first),
+        az_span_slice(json, first, second),
+        az_span_slice_to_end(json, second),
+      };
+      assert_int_equal(az_json_reader_chunked_init(&reader, segments, 3, NULL), AZ_OK);
+      assert_int_equal(az_json_reader_next_token(&reader), AZ_OK);
+      assert_int_equal(az_json_token_get_string(&reader.token, dest, 32, &length), AZ_OK);
+      assert_true(az_span_is_content_equal(expected, az_span_create((uint8_t*)dest, length)));
+    }
+  }
+}
+
 int test_az_json()
 {
   const struct CMUnitTest tests[]
@@ -3237,20 +4625,37 @@ int test_az_json()
           cmocka_unit_test(test_json_writer_append_nested_invalid),
           cmocka_unit_test(test_json_writer_chunked),
           cmocka_unit_test(test_json_writer_chunked_no_callback),
+          cmocka_unit_test(test_json_writer_append_int64),
+          cmocka_unit_test(test_json_writer_append_name),
+          cmocka_unit_test(test_json_writer_append_json_text_trusted),
+          cmocka_unit_test(test_json_writer_measure),
+          cmocka_unit_test(test_json_writer_stream),
+          cmocka_unit_test(test_json_writer_span_list),
+          cmocka_unit_test(test_json_writer_span_list_not_enough_space),
+          cmocka_unit_test(test_json_writer_span_list_fills_buffers),
+          cmocka_unit_test(test_json_writer_span_list_rollback),
           cmocka_unit_test(test_json_writer_large_string_chunked),
+          cmocka_unit_test(test_json_writer_escape_positions),
           cmocka_unit_test(test_json_reader),
           cmocka_unit_test(test_json_reader_invalid),
           cmocka_unit_test(test_json_reader_incomplete),
+          cmocka_unit_test(test_json_reader_long_strings_chunked),
+          cmocka_unit_test(test_json_reader_long_strings_invalid),
+          cmocka_unit_test(test_json_reader_pretty_printed),
+          cmocka_unit_test(test_json_reader_push),
           cmocka_unit_test(test_json_skip_children),
+          cmocka_unit_test(test_json_skip_children_fast),
           cmocka_unit_test(test_json_value),
           cmocka_unit_test(test_az_json_token_get_string_and_text_equal),
           cmocka_unit_test(test_az_json_token_get_string_and_text_equal_discontiguous),
           cmocka_unit_test(test_az_json_reader_double),
           cmocka_unit_test(test_az_json_token_number_too_large),
+          cmocka_unit_test(test_az_json_token_number_integer),
           cmocka_unit_test(test_az_json_token_literal),
           cmocka_unit_test(test_az_json_token_copy),
           cmocka_unit_test(test_az_json_reader_chunked),
           cmocka_unit_test(test_az_json_string_unescape),
-          cmocka_unit_test(test_az_json_string_unescape_same_buffer) };
+          cmocka_unit_test(test_az_json_string_unescape_same_buffer),
+          cmocka_unit_test(test_az_json_string_unescape_unicode) };
   return cmocka_run_group_tests_name("az_core_json", tests, NULL, NULL);
 }
@@ -0,0 +1,195 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "az_test_definitions.h"
+#include <azure/core/az_json_document.h>
+
+#include <stdarg.h>
+#include <stddef.h>
+
+#include <setjmp.h>
+#include <stdint.h>
+
+#include <cmocka.h>
+
+#include <azure/core/_az_cfg.h>
+
+static az_span const twin_json = AZ_SPAN_LITERAL_FROM_STR(
+    "{\"desired\":{\"targetTemperature\":21.5,\"schedule\":[6,{\"at\":12},[]],\"n\\/me\":"
+    "\"k\\\"itchen\",\"$version\":17},\"reported\":{},\"$version\":311}");
+
+static void test_json_document_navigate(void** state)
+{
+  (void)state;
+  az_json_tape_entry tape[32] = { 0 };
+  az_json_document document = { 0 };
+  assert_int_equal(az_json_document_parse(&document, twin_json, tape, 32, NULL), AZ_OK);
+  assert_int_equal(az_json_document_get_entry_count(&document), 26);
+  assert_int_equal(az_json_document_get_kind(&document, 0), AZ_JSON_TOKEN_BEGIN_OBJECT);
+  assert_int_equal(az_json_document_get_kind(&document, 25), AZ_JSON_TOKEN_END_OBJECT);
+
+  // Properties can be looked up in any order, and nested objects are skipped over.
+  int32_t version = 0;
+  assert_int_equal(
+      az_json_document_find_property(&document, 0, AZ_SPAN_FROM_STR("$version"), &version),
+      AZ_OK);
+  az_json_token token = az_json_document_get_token(&document, version);
+  int32_t value = 0;
+  assert_int_equal(az_json_token_get_int32(&token, &value), AZ_OK);
+  assert_int_equal(value, 311);
+
+  int32_t desired = 0;
+  assert_int_equal(
+      az_json_document_find_property(&document, 0, AZ_SPAN_FROM_STR("desired"), &desired), AZ_OK);
+  assert_int_equal(
+      az_json_document_find_property(&document, desired, AZ_SPAN_FROM_STR("$version"), &version),
+      AZ_OK);
+  token = az_json_document_get_token(&document, version);
+  assert_int_equal(az_json_token_get_int32(&token, &value), AZ_OK);
+  assert_int_equal(value, 17);
+
+  // Names and strings are compared and copied unescaped.
+  int32_t name = 0;
+  assert_int_equal(
+      az_json_document_find_property(&document, desired, AZ_SPAN_FROM_STR("n/me"), &name), AZ_OK);
+  token = az_json_document_get_token(&document, name);
+  assert_int_equal(token.kind, AZ_JSON_TOKEN_STRING);
+  assert_true(az_json_token_is_text_equal(&token, AZ_SPAN_FROM_STR("k\"itchen")));
+  assert_true(az_span_is_content_equal(
+      az_json_document_get_json_text(&document, name), AZ_SPAN_FROM_STR("\"k\\\"itchen\"")));
+
+  int32_t missing = -1;
+  assert_int_equal(
+      az_json_document_find_property(&document, desired, AZ_SPAN_FROM_STR("reported"), &missing),
+      AZ_ERROR_ITEM_NOT_FOUND);
+  assert_int_equal(missing, -1);
+
+  // Siblings of an array skip over nested containers.
+  int32_t schedule = 0;
+  assert_int_equal(
+      az_json_document_find_property(&document, desired, AZ_SPAN_FROM_STR("schedule"), &schedule),
+      AZ_OK);
+  az_json_token_kind const expected_kinds[]
+      = { AZ_JSON_TOKEN_NUMBER, AZ_JSON_TOKEN_BEGIN_OBJECT, AZ_JSON_TOKEN_BEGIN_ARRAY };
+  int32_t element = 0;
+  int32_t element_count = 0;
+  az_result result = az_json_document_get_first_child(&document, schedule, &element);
+  while (az_result_succeeded(result))
+  {
+    assert_int_equal(az_json_document_get_kind(&document, element), expected_kinds[element_count]);
+    element_count++;
+    result = az_json_document_get_next_sibling(&document, element, &element);
+  }
+  assert_int_equal(result, AZ_ERROR_ITEM_NOT_FOUND);
+  assert_int_equal(element_count, 3);
+
+  // The last element is empty, as is the reported object.
+  assert_int_equal(
+      az_json_document_get_first_child(&document, element, &element), AZ_ERROR_ITEM_NOT_FOUND);
+  int32_t reported = 0;
+  assert_int_equal(
+      az_json_document_find_property(&document, 0, AZ_SPAN_FROM_STR("reported"), &reported),
+      AZ_OK);
+  assert_int_equal(
+      az_json_document_get_first_child(&document, reported, &element), AZ_ERROR_ITEM_NOT_FOUND);
+
+  // The root has no siblings.
+  assert_int_equal(
+      az_json_document_get_next_sibling(&document, 0, &element), AZ_ERROR_ITEM_NOT_FOUND);
+}
+
+static void test_json_document_reader_init(void** state)
+{
+  (void)state;
+  az_json_tape_entry tape[32] = { 0 };
+  az_json_document document = { 0 };
+  assert_int_equal(az_json_document_parse(&document, twin_json, tape, 32, NULL), AZ_OK);
+
+  int32_t desired = 0;
+  assert_int_equal(
+      az_json_document_find_property(&document, 0, AZ_SPAN_FROM_STR("desired"), &desired), AZ_OK);
+  assert_true(az_span_is_content_equal(
+      az_json_document_get_json_text(&document, desired),
+      AZ_SPAN_FROM_STR("{\"targetTemperature\":21.5,\"schedule\":[6,{\"at\":12},[]],\"n\\/me\":"
+                       "\"k\\\"itchen\",\"$version\":17}")));
+
+  // A subtree can be read again, as many times as needed, with a regular reader.
+  for (int32_t pass = 0; pass < 2; pass++)
+  {
+    az_json_reader reader = { 0 };
+    assert_int_equal(az_json_document_reader_init(&document, desired, &reader, NULL), AZ_OK);
+
+    int32_t index = desired;
+    az_result result = AZ_OK;
+    while (az_result_succeeded(result = az_json_reader_next_token(&reader)))
+    {
+      // The tokens are the same as those of the tape.
+      az_json_token const token = az_json_document_get_token(&document, index);
+      assert_int_equal(reader.token.kind, token.kind);
+      assert_true(az_span_is_content_equal(reader.token.slice, token.slice));
+      assert_true(az_span_ptr(reader.token.slice) == az_span_ptr(token.slice));
+      index++;
+    }
+    assert_int_equal(result, AZ_ERROR_JSON_READER_DONE);
+    assert_int_equal(index, tape[desired]._internal.next_sibling);
+  }
+
+  // Primitive values can also be read again.
+  int32_t version = 0;
+  assert_int_equal(
+      az_json_document_find_property(&document, 0, AZ_SPAN_FROM_STR("$version"), &version),
+      AZ_OK);
+  az_json_reader reader = { 0 };
+  assert_int_equal(az_json_document_reader_init(&document, version, &reader, NULL), AZ_OK);
+  assert_int_equal(az_json_reader_next_token(&reader), AZ_OK);
+  assert_int_equal(reader.token.kind, AZ_JSON_TOKEN_NUMBER);
+  assert_int_equal(az_json_reader_next_token(&reader), AZ_ERROR_JSON_READER_DONE);
+}
+
+static void test_json_document_parse_errors(void** state)
+{
+  (void)state;
+  az_json_tape_entry tape[8] = { 0 };
+  az_json_document document = { 0 };
+
+  // A single value, with surrounding whitespace.
+  assert_int_equal(
+      az_json_document_parse(&document, AZ_SPAN_FROM_STR(" \"a\\tb\" "), tape, 8, NULL), AZ_OK);
+  assert_int_equal(az_json_document_get_entry_count(&document), 1);
+  assert_true(az_span_is_content_equal(
+      az_json_document_get_json_text(&document, 0), AZ_SPAN_FROM_STR("\"a\\tb\"")));
+  int32_t sibling = 0;
+  assert_int_equal(
+      az_json_document_get_next_sibling(&document, 0, &sibling), AZ_ERROR_ITEM_NOT_FOUND);
+
+  // Exactly enough entries, then one too few.
+  az_span const json = AZ_SPAN_FROM_STR("[1,[true,null],{\"a\":\"b\"}]");
+  assert_int_equal(
+      az_json_document_parse(&document, json, tape, 8, NULL), AZ_ERROR_NOT_ENOUGH_SPACE);
+  az_json_tape_entry larger_tape[11] = { 0 };
+  assert_int_equal(az_json_document_parse(&document, json, larger_tape, 11, NULL), AZ_OK);
+  assert_int_equal(az_json_document_get_entry_count(&document), 11);
+  assert_int_equal(
+      az_json_document_parse(&document, json, larger_tape, 10, NULL), AZ_ERROR_NOT_ENOUGH_SPACE);
+
+  // Invalid JSON is reported as the reader reports it.
+  assert_int_equal(
+      az_json_document_parse(&document, AZ_SPAN_FROM_STR("{\"a\":1,}"), tape, 8, NULL),
+      AZ_ERROR_UNEXPECTED_CHAR);
+  assert_int_equal(
+      az_json_document_parse(&document, AZ_SPAN_FROM_STR("[1,2"), tape, 8, NULL),
+      AZ_ERROR_UNEXPECTED_END);
+  assert_int_equal(
+      az_json_document_parse(&document, AZ_SPAN_FROM_STR("[1] 2"), tape, 8, NULL),
+      AZ_ERROR_UNEXPECTED_CHAR);
+}
+
+int test_az_json_document()
+{
+  const struct CMUnitTest tests[] = {
+    cmocka_unit_test(test_json_document_navigate),
+    cmocka_unit_test(test_json_document_reader_init),
+    cmocka_unit_test(test_json_document_parse_errors),
+  };
+  return cmocka_run_group_tests_name("az_core_json_document", tests, NULL, NULL);
+}
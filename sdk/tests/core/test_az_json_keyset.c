@@ -0,0 +1,181 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "az_test_definitions.h"
+#include <azure/core/az_json_keyset.h>
+
+#include <stdarg.h>
+#include <stddef.h>
+
+#include <setjmp.h>
+#include <stdint.h>
+
+#include <cmocka.h>
+
+#include <azure/core/_az_cfg.h>
+
+static az_span const response_keys[] = {
+  AZ_SPAN_LITERAL_FROM_STR("operationId"), AZ_SPAN_LITERAL_FROM_STR("status"),
+  AZ_SPAN_LITERAL_FROM_STR("registrationState"), AZ_SPAN_LITERAL_FROM_STR("errorCode"),
+  AZ_SPAN_LITERAL_FROM_STR("message"), AZ_SPAN_LITERAL_FROM_STR("a/b"),
+};
+
+static az_span const response_json = AZ_SPAN_LITERAL_FROM_STR(
+    "{\"operationId\":\"4.d0a6\",\"registrationState\":{\"status\":\"assigned\",\"x\":[{},[]]},"
+    "\"tags\":[\"status\"],\"a\\/b\":true,\"status\":\"assigning\",\"status\":\"assigned\"}");
+
+static void test_json_keyset_find(void** state)
+{
+  (void)state;
+  az_json_keyset keyset = { 0 };
+
+  // Names that only differ in their middle bytes share a slot.
+  az_span const keys[] = {
+    AZ_SPAN_LITERAL_FROM_STR("k00z"), AZ_SPAN_LITERAL_FROM_STR("k01z"),
+    AZ_SPAN_LITERAL_FROM_STR("k02z"), AZ_SPAN_LITERAL_FROM_STR("k10z"),
+    AZ_SPAN_LITERAL_FROM_STR(""), AZ_SPAN_LITERAL_FROM_STR("k\tz"),
+  };
+  assert_int_equal(az_json_keyset_init(&keyset, keys, 6), AZ_OK);
+
+  az_json_reader reader = { 0 };
+  assert_int_equal(
+      az_json_reader_init(
+          &reader,
+          AZ_SPAN_FROM_STR("{\"k10z\":0,\"k00z\":0,\"\":0,\"k\\tz\":0,\"k02z\":0,\"k03z\":0,"
+                           "\"k01z\":0,\"k\\u0030z\":0}"),
+          NULL),
+      AZ_OK);
+  int32_t const expected_indices[] = { 3, 0, 4, 5, 2, -1, 1, -1 };
+  assert_int_equal(az_json_reader_next_token(&reader), AZ_OK);
+  for (int32_t i = 0; i < 8; i++)
+  {
+    assert_int_equal(az_json_reader_next_token(&reader), AZ_OK);
+    assert_int_equal(az_json_keyset_find(&keyset, &reader.token), expected_indices[i]);
+    assert_int_equal(az_json_reader_next_token(&reader), AZ_OK);
+  }
+
+  // A name can only be once in a keyset, and the keyset has a maximum size.
+  az_span const duplicate_keys[] = {
+    AZ_SPAN_LITERAL_FROM_STR("a"),
+    AZ_SPAN_LITERAL_FROM_STR("b"),
+    AZ_SPAN_LITERAL_FROM_STR("a"),
+  };
+  assert_int_equal(az_json_keyset_init(&keyset, duplicate_keys, 3), AZ_ERROR_ARG);
+
+  az_span many_keys[AZ_JSON_KEYSET_MAX_KEYS + 1];
+  uint8_t names[AZ_JSON_KEYSET_MAX_KEYS + 1][2];
+  for (int32_t i = 0; i < AZ_JSON_KEYSET_MAX_KEYS + 1; i++)
+  {
+    names[i][0] = (uint8_t)('a' + i / 26);
+    names[i][1] = (uint8_t)('a' + i % 26);
+    many_keys[i] = az_span_create(names[i], 2);
+  }
+  assert_int_equal(
+      az_json_keyset_init(&keyset, many_keys, AZ_JSON_KEYSET_MAX_KEYS + 1),
+      AZ_ERROR_NOT_ENOUGH_SPACE);
+  assert_int_equal(az_json_keyset_init(&keyset, many_keys, AZ_JSON_KEYSET_MAX_KEYS), AZ_OK);
+  for (int32_t i = 0; i < AZ_JSON_KEYSET_MAX_KEYS; i++)
+  {
+    az_json_token const name = {
+      .slice = many_keys[i],
+      .kind = AZ_JSON_TOKEN_PROPERTY_NAME,
+      .size = 2,
+    };
+    assert_int_equal(az_json_keyset_find(&keyset, &name), i);
+  }
+}
+
+static void _assert_response_values(az_json_token const values[])
+{
+  assert_true(az_json_token_is_text_equal(&values[0], AZ_SPAN_FROM_STR("4.d0a6")));
+
+  // The last value is kept, and nested properties aren't looked at.
+  assert_true(az_json_token_is_text_equal(&values[1], AZ_SPAN_FROM_STR("assigned")));
+  assert_int_equal(values[2].kind, AZ_JSON_TOKEN_BEGIN_OBJECT);
+  assert_int_equal(values[3].kind, AZ_JSON_TOKEN_NONE);
+  assert_int_equal(values[4].kind, AZ_JSON_TOKEN_NONE);
+  assert_int_equal(values[5].kind, AZ_JSON_TOKEN_TRUE);
+}
+
+static void test_json_keyset_extract(void** state)
+{
+  (void)state;
+  az_json_keyset keyset = { 0 };
+  assert_int_equal(az_json_keyset_init(&keyset, response_keys, 6), AZ_OK);
+
+  az_json_token values[6];
+  az_json_reader reader = { 0 };
+  assert_int_equal(az_json_reader_init(&reader, response_json, NULL), AZ_OK);
+  assert_int_equal(az_json_keyset_extract(&keyset, &reader, values), AZ_OK);
+  _assert_response_values(values);
+  assert_int_equal(reader.token.kind, AZ_JSON_TOKEN_END_OBJECT);
+  assert_int_equal(az_json_reader_next_token(&reader), AZ_ERROR_JSON_READER_DONE);
+
+  // The same object, read from several buffers.
+  az_span segments[] = {
+    az_span_slice(response_json, 0, 7),
+    az_span_slice(response_json, 7, 50),
+    az_span_slice(response_json, 50, 84),
+    az_span_slice_to_end(response_json, 84),
+  };
+  assert_int_equal(az_json_reader_chunked_init(&reader, segments, 4, NULL), AZ_OK);
+  assert_int_equal(az_json_keyset_extract(&keyset, &reader, values), AZ_OK);
+  _assert_response_values(values);
+  assert_int_equal(az_json_reader_next_token(&reader), AZ_ERROR_JSON_READER_DONE);
+
+  // A nested object, from its property name.
+  assert_int_equal(az_json_reader_init(&reader, response_json, NULL), AZ_OK);
+  assert_int_equal(az_json_reader_next_token(&reader), AZ_OK);
+  assert_int_equal(az_json_reader_next_token(&reader), AZ_OK);
+  assert_int_equal(az_json_reader_next_token(&reader), AZ_OK);
+  assert_int_equal(az_json_reader_next_token(&reader), AZ_OK);
+  assert_true(az_json_token_is_text_equal(&reader.token, AZ_SPAN_FROM_STR("registrationState")));
+  assert_int_equal(az_json_keyset_extract(&keyset, &reader, values), AZ_OK);
+  assert_int_equal(values[0].kind, AZ_JSON_TOKEN_NONE);
+  assert_true(az_json_token_is_text_equal(&values[1], AZ_SPAN_FROM_STR("assigned")));
+  assert_int_equal(reader.current_depth, 1);
+
+  // Values that aren't objects.
+  assert_int_equal(az_json_reader_init(&reader, AZ_SPAN_FROM_STR("[{}]"), NULL), AZ_OK);
+  assert_int_equal(az_json_keyset_extract(&keyset, &reader, values), AZ_ERROR_UNEXPECTED_CHAR);
+  assert_int_equal(az_json_reader_init(&reader, AZ_SPAN_FROM_STR("{\"a\":[}"), NULL), AZ_OK);
+  assert_int_equal(az_json_keyset_extract(&keyset, &reader, values), AZ_ERROR_UNEXPECTED_CHAR);
+}
+
+static void test_json_keyset_extract_from_document(void** state)
+{
+  (void)state;
+  az_json_keyset keyset = { 0 };
+  assert_int_equal(az_json_keyset_init(&keyset, response_keys, 6), AZ_OK);
+
+  az_json_tape_entry tape[32] = { 0 };
+  az_json_document document = { 0 };
+  assert_int_equal(az_json_document_parse(&document, response_json, tape, 32, NULL), AZ_OK);
+
+  int32_t indices[6] = { 0 };
+  assert_int_equal(az_json_keyset_extract_from_document(&keyset, &document, 0, indices), AZ_OK);
+  az_json_token values[6];
+  for (int32_t i = 0; i < 6; i++)
+  {
+    values[i] = indices[i] == -1 ? (az_json_token){ .kind = AZ_JSON_TOKEN_NONE }
+                                 : az_json_document_get_token(&document, indices[i]);
+  }
+  _assert_response_values(values);
+
+  // Nested objects can be looked into too.
+  assert_int_equal(
+      az_json_keyset_extract_from_document(&keyset, &document, indices[2], indices), AZ_OK);
+  assert_int_equal(indices[0], -1);
+  az_json_token const status = az_json_document_get_token(&document, indices[1]);
+  assert_true(az_json_token_is_text_equal(&status, AZ_SPAN_FROM_STR("assigned")));
+}
+
+int test_az_json_keyset()
+{
+  const struct CMUnitTest tests[] = {
+    cmocka_unit_test(test_json_keyset_find),
+    cmocka_unit_test(test_json_keyset_extract),
+    cmocka_unit_test(test_json_keyset_extract_from_document),
+  };
+  return cmocka_run_group_tests_name("az_core_json_keyset", tests, NULL, NULL);
+}
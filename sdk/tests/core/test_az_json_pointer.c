@@ -0,0 +1,245 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "az_test_definitions.h"
+#include <azure/core/az_json_pointer.h>
+
+#include <stdarg.h>
+#include <stddef.h>
+
+#include <setjmp.h>
+#include <stdint.h>
+
+#include <cmocka.h>
+
+#include <azure/core/_az_cfg.h>
+
+static az_span const twin_json = AZ_SPAN_LITERAL_FROM_STR(
+    "{\"desired\":{\"targetTemperature\":21.5,\"schedule\":[6,{\"at\":12,\"to\":\"]}\\\"\"},"
+    "[[]]],\"n\\/me\":\"kitchen\",\"a~b\":{\"\":true},\"$version\":17},\"reported\":{},"
+    "\"$version\":311}");
+
+static az_result _find_int32(az_span json, az_span pointer_text, int32_t* out_value)
+{
+  az_json_pointer pointer = { 0 };
+  az_result result = az_json_pointer_parse(&pointer, pointer_text);
+  if (az_result_failed(result))
+  {
+    return result;
+  }
+
+  // The value is the same whether it is found by a reader or within a document.
+  az_json_reader reader = { 0 };
+  assert_int_equal(az_json_reader_init(&reader, json, NULL), AZ_OK);
+  az_json_token token = { 0 };
+  result = az_json_pointer_find(&pointer, &reader, &token);
+
+  az_json_tape_entry tape[64] = { 0 };
+  az_json_document document = { 0 };
+  assert_int_equal(az_json_document_parse(&document, json, tape, 64, NULL), AZ_OK);
+  int32_t index = -1;
+  assert_int_equal(az_json_pointer_find_in_document(&pointer, &document, &index), result);
+  if (az_result_failed(result))
+  {
+    return result;
+  }
+
+  assert_int_equal(reader.token.kind, token.kind);
+  az_json_token const document_token = az_json_document_get_token(&document, index);
+  assert_true(az_span_ptr(token.slice) == az_span_ptr(document_token.slice));
+  return az_json_token_get_int32(&token, out_value);
+}
+
+static void test_json_pointer_parse(void** state)
+{
+  (void)state;
+  az_json_pointer pointer = { 0 };
+
+  assert_int_equal(az_json_pointer_parse(&pointer, AZ_SPAN_EMPTY), AZ_OK);
+  assert_int_equal(pointer._internal.token_count, 0);
+
+  // "/" is a single empty reference token.
+  assert_int_equal(az_json_pointer_parse(&pointer, AZ_SPAN_FROM_STR("/")), AZ_OK);
+  assert_int_equal(pointer._internal.token_count, 1);
+  assert_int_equal(az_span_size(pointer._internal.tokens[0].name), 0);
+
+  assert_int_equal(
+      az_json_pointer_parse(&pointer, AZ_SPAN_FROM_STR("/a~1b/0/10/01/-/~0/2147483648")), AZ_OK);
+  assert_int_equal(pointer._internal.token_count, 7);
+  assert_true(pointer._internal.tokens[0].has_escapes);
+  assert_false(pointer._internal.tokens[1].has_escapes);
+  int32_t const expected_indices[] = { -1, 0, 10, -1, -1, -1, -1 };
+  for (int32_t i = 0; i < 7; i++)
+  {
+    assert_int_equal(pointer._internal.tokens[i].array_index, expected_indices[i]);
+  }
+
+  assert_int_equal(
+      az_json_pointer_parse(&pointer, AZ_SPAN_FROM_STR("a/b")), AZ_ERROR_UNEXPECTED_CHAR);
+  assert_int_equal(
+      az_json_pointer_parse(&pointer, AZ_SPAN_FROM_STR("/a~2")), AZ_ERROR_UNEXPECTED_CHAR);
+  assert_int_equal(
+      az_json_pointer_parse(&pointer, AZ_SPAN_FROM_STR("/a~")), AZ_ERROR_UNEXPECTED_CHAR);
+  assert_int_equal(
+      az_json_pointer_parse(&pointer, AZ_SPAN_FROM_STR("/1/2/3/4/5/6/7/8")), AZ_OK);
+  assert_int_equal(
+      az_json_pointer_parse(&pointer, AZ_SPAN_FROM_STR("/1/2/3/4/5/6/7/8/9")),
+      AZ_ERROR_NOT_ENOUGH_SPACE);
+}
+
+static void test_json_pointer_find(void** state)
+{
+  (void)state;
+  int32_t value = 0;
+
+  assert_int_equal(_find_int32(twin_json, AZ_SPAN_FROM_STR("/$version"), &value), AZ_OK);
+  assert_int_equal(value, 311);
+  assert_int_equal(_find_int32(twin_json, AZ_SPAN_FROM_STR("/desired/$version"), &value), AZ_OK);
+  assert_int_equal(value, 17);
+  assert_int_equal(_find_int32(twin_json, AZ_SPAN_FROM_STR("/desired/schedule/0"), &value), AZ_OK);
+  assert_int_equal(value, 6);
+  assert_int_equal(
+      _find_int32(twin_json, AZ_SPAN_FROM_STR("/desired/schedule/1/at"), &value), AZ_OK);
+  assert_int_equal(value, 12);
+
+  // Missing values.
+  az_span const missing[] = {
+    AZ_SPAN_LITERAL_FROM_STR("/version"),
+    AZ_SPAN_LITERAL_FROM_STR("/reported/$version"),
+    AZ_SPAN_LITERAL_FROM_STR("/desired/schedule/3"),
+    AZ_SPAN_LITERAL_FROM_STR("/desired/schedule/-"),
+    AZ_SPAN_LITERAL_FROM_STR("/desired/schedule/01"),
+    AZ_SPAN_LITERAL_FROM_STR("/desired/schedule/0/0"),
+    AZ_SPAN_LITERAL_FROM_STR("/desired/schedule/2/0/0"),
+    AZ_SPAN_LITERAL_FROM_STR("/$version/0"),
+    AZ_SPAN_LITERAL_FROM_STR("/desired/a~0b/x"),
+  };
+  for (size_t i = 0; i < sizeof(missing) / sizeof(missing[0]); i++)
+  {
+    assert_int_equal(_find_int32(twin_json, missing[i], &value), AZ_ERROR_ITEM_NOT_FOUND);
+  }
+
+  // The whole document, and values that aren't numbers.
+  az_json_pointer pointer = { 0 };
+  az_json_reader reader = { 0 };
+  az_json_token token = { 0 };
+  assert_int_equal(az_json_pointer_parse(&pointer, AZ_SPAN_EMPTY), AZ_OK);
+  assert_int_equal(az_json_reader_init(&reader, twin_json, NULL), AZ_OK);
+  assert_int_equal(az_json_pointer_find(&pointer, &reader, &token), AZ_OK);
+  assert_int_equal(token.kind, AZ_JSON_TOKEN_BEGIN_OBJECT);
+
+  assert_int_equal(az_json_pointer_parse(&pointer, AZ_SPAN_FROM_STR("/desired/a~0b/")), AZ_OK);
+  assert_int_equal(az_json_reader_init(&reader, twin_json, NULL), AZ_OK);
+  assert_int_equal(az_json_pointer_find(&pointer, &reader, NULL), AZ_OK);
+  assert_int_equal(reader.token.kind, AZ_JSON_TOKEN_TRUE);
+}
+
+static void test_json_pointer_find_escaped_names(void** state)
+{
+  (void)state;
+  az_span const json
+      = AZ_SPAN_FROM_STR("{\"a/b\":1,\"a\\/b~\":2,\"~1\":3,\"\\t~\":4,\"\\u0061\":5}");
+  int32_t value = 0;
+
+  assert_int_equal(_find_int32(json, AZ_SPAN_FROM_STR("/a~1b"), &value), AZ_OK);
+  assert_int_equal(value, 1);
+  assert_int_equal(_find_int32(json, AZ_SPAN_FROM_STR("/a~1b~0"), &value), AZ_OK);
+  assert_int_equal(value, 2);
+  assert_int_equal(_find_int32(json, AZ_SPAN_FROM_STR("/~01"), &value), AZ_OK);
+  assert_int_equal(value, 3);
+  assert_int_equal(_find_int32(json, AZ_SPAN_FROM_STR("/\t~0"), &value), AZ_OK);
+  assert_int_equal(value, 4);
+  assert_int_equal(_find_int32(json, AZ_SPAN_FROM_STR("/a~1"), &value), AZ_ERROR_ITEM_NOT_FOUND);
+  assert_int_equal(_find_int32(json, AZ_SPAN_FROM_STR("/~1"), &value), AZ_ERROR_ITEM_NOT_FOUND);
+}
+
+static void test_json_pointer_find_reuse(void** state)
+{
+  (void)state;
+  az_json_pointer at = { 0 };
+  az_json_pointer version = { 0 };
+  assert_int_equal(az_json_pointer_parse(&at, AZ_SPAN_FROM_STR("/schedule/1/at")), AZ_OK);
+  assert_int_equal(az_json_pointer_parse(&version, AZ_SPAN_FROM_STR("/$version")), AZ_OK);
+
+  // Pointers are relative to the value the reader is on, so one can continue from another.
+  az_json_pointer desired = { 0 };
+  assert_int_equal(az_json_pointer_parse(&desired, AZ_SPAN_FROM_STR("/desired")), AZ_OK);
+  az_json_reader reader = { 0 };
+  assert_int_equal(az_json_reader_init(&reader, twin_json, NULL), AZ_OK);
+  assert_int_equal(az_json_pointer_find(&desired, &reader, NULL), AZ_OK);
+  assert_int_equal(reader.current_depth, 1);
+
+  az_json_token token = { 0 };
+  assert_int_equal(az_json_pointer_find(&at, &reader, &token), AZ_OK);
+  int32_t value = 0;
+  assert_int_equal(az_json_token_get_int32(&token, &value), AZ_OK);
+  assert_int_equal(value, 12);
+
+  // The reader carries on after the value, over the containers that were skipped.
+  assert_int_equal(az_json_reader_next_token(&reader), AZ_OK);
+  assert_true(az_json_token_is_text_equal(&reader.token, AZ_SPAN_FROM_STR("to")));
+  assert_int_equal(az_json_reader_skip_children(&reader), AZ_OK);
+  assert_int_equal(az_json_reader_next_token(&reader), AZ_OK);
+  assert_int_equal(reader.token.kind, AZ_JSON_TOKEN_END_OBJECT);
+  assert_int_equal(reader.current_depth, 3);
+
+  // A chunked reader, whose tokens straddle segments, reads every token instead.
+  az_span segments[] = {
+    az_span_slice(twin_json, 0, 20),
+    az_span_slice(twin_json, 20, 41),
+    az_span_slice(twin_json, 41, 120),
+    az_span_slice_to_end(twin_json, 120),
+  };
+  assert_int_equal(az_json_reader_chunked_init(&reader, segments, 4, NULL), AZ_OK);
+  assert_int_equal(az_json_pointer_find(&version, &reader, &token), AZ_OK);
+  assert_int_equal(az_json_token_get_int32(&token, &value), AZ_OK);
+  assert_int_equal(value, 311);
+  assert_int_equal(az_json_reader_next_token(&reader), AZ_OK);
+  assert_int_equal(az_json_reader_next_token(&reader), AZ_ERROR_JSON_READER_DONE);
+}
+
+static void test_json_pointer_find_skips_invalid(void** state)
+{
+  (void)state;
+  az_json_pointer pointer = { 0 };
+  assert_int_equal(az_json_pointer_parse(&pointer, AZ_SPAN_FROM_STR("/b")), AZ_OK);
+
+  // Skipped containers are only checked for balanced brackets and terminated strings.
+  struct
+  {
+    az_span json;
+    az_result expected;
+  } const cases[] = {
+    { AZ_SPAN_LITERAL_FROM_STR("{\"a\":[1 2 {,}],\"b\":3}"), AZ_OK },
+    { AZ_SPAN_LITERAL_FROM_STR("{\"a\":[\"]\\\"\"],\"b\":3}"), AZ_OK },
+    { AZ_SPAN_LITERAL_FROM_STR("{\"a\":[1},\"b\":3}"), AZ_ERROR_UNEXPECTED_CHAR },
+    { AZ_SPAN_LITERAL_FROM_STR("{\"a\":{\"x\n\":1},\"b\":3}"), AZ_ERROR_UNEXPECTED_CHAR },
+    { AZ_SPAN_LITERAL_FROM_STR("{\"a\":[[],\"b\":3"), AZ_ERROR_UNEXPECTED_END },
+    { AZ_SPAN_LITERAL_FROM_STR("{\"a\":[\"],\"b\":3}"), AZ_ERROR_UNEXPECTED_END },
+  };
+  for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++)
+  {
+    az_json_reader reader = { 0 };
+    assert_int_equal(az_json_reader_init(&reader, cases[i].json, NULL), AZ_OK);
+    az_json_token token = { 0 };
+    assert_int_equal(az_json_pointer_find(&pointer, &reader, &token), cases[i].expected);
+    if (cases[i].expected == AZ_OK)
+    {
+      assert_int_equal(token.kind, AZ_JSON_TOKEN_NUMBER);
+      assert_int_equal(az_json_reader_next_token(&reader), AZ_OK);
+      assert_int_equal(az_json_reader_next_token(&reader), AZ_ERROR_JSON_READER_DONE);
+    }
+  }
+}
+
+int test_az_json_pointer()
+{
+  const struct CMUnitTest tests[] = {
+    cmocka_unit_test(test_json_pointer_parse),
+    cmocka_unit_test(test_json_pointer_find),
+    cmocka_unit_test(test_json_pointer_find_escaped_names),
+    cmocka_unit_test(test_json_pointer_find_reuse),
+    cmocka_unit_test(test_json_pointer_find_skips_invalid),
+  };
+  return cmocka_run_group_tests_name("az_core_json_pointer", tests, NULL, NULL);
+}
@@ -10,6 +10,7 @@
 #include <stdarg.h>
 #include <stddef.h>
 
+#include <float.h>
 #include <limits.h>
 #include <math.h>
 #include <setjmp.h>
@@ -92,6 +93,80 @@ static void az_span_to_lower_test(void** state)
   assert_false(az_span_is_content_equal_ignoring_case(a, d));
 }
 
+static uint8_t _az_test_ascii_to_lower(uint8_t value)
+{
+  return (value >= 'A' && value <= 'Z') ? (uint8_t)(value + ('a' - 'A')) : value;
+}
+
+static void az_span_is_content_equal_ignoring_case_long_test(void** state)
+{
+  (void)state;
+
+  // Long enough to cover the vectorized, 8-bytes-at-a-time and byte-by-byte comparisons, with
+  // every pair of byte values placed at positions that fall within each of them.
+  uint8_t buffer1[67];
+  uint8_t buffer2[67];
+  int32_t const positions[] = { 0, 7, 8, 15, 16, 31, 32, 47, 63, 64, 66 };
+
+  for (size_t p = 0; p < _az_COUNTOF(positions); p++)
+  {
+    for (int32_t b1 = 0; b1 <= UINT8_MAX; b1++)
+    {
+      for (int32_t b2 = 0; b2 <= UINT8_MAX; b2++)
+      {
+        memset(buffer1, 'x', sizeof(buffer1));
+        memset(buffer2, 'X', sizeof(buffer2));
+        buffer1[positions[p]] = (uint8_t)b1;
+        buffer2[positions[p]] = (uint8_t)b2;
+
+        bool const expected
+            = _az_test_ascii_to_lower((uint8_t)b1) == _az_test_ascii_to_lower((uint8_t)b2);
+        assert_true(
+            az_span_is_content_equal_ignoring_case(
+                AZ_SPAN_FROM_BUFFER(buffer1), AZ_SPAN_FROM_BUFFER(buffer2))
+            == expected);
+      }
+    }
+  }
+}
+
+static void az_span_find_ignoring_case_test(void** state)
+{
+  (void)state;
+
+  az_span source = AZ_SPAN_FROM_STR("Content-Type: text/plain; Retry-After: 10");
+
+  assert_int_equal(az_span_find_ignoring_case(source, AZ_SPAN_FROM_STR("retry-after")), 26);
+  assert_int_equal(az_span_find_ignoring_case(source, AZ_SPAN_FROM_STR("RETRY-AFTER: 10")), 26);
+  assert_int_equal(az_span_find_ignoring_case(source, AZ_SPAN_FROM_STR("CONTENT")), 0);
+  assert_int_equal(az_span_find_ignoring_case(source, AZ_SPAN_FROM_STR("T")), 3);
+  assert_int_equal(az_span_find_ignoring_case(source, AZ_SPAN_FROM_STR("retry-after-ms")), -1);
+  assert_int_equal(az_span_find_ignoring_case(source, AZ_SPAN_EMPTY), 0);
+  assert_int_equal(az_span_find_ignoring_case(AZ_SPAN_EMPTY, AZ_SPAN_EMPTY), 0);
+  assert_int_equal(az_span_find_ignoring_case(AZ_SPAN_EMPTY, AZ_SPAN_FROM_STR("a")), -1);
+  assert_int_equal(az_span_find_ignoring_case(AZ_SPAN_FROM_STR("a"), source), -1);
+
+  // Only ASCII letters are case folded.
+  assert_int_equal(
+      az_span_find_ignoring_case(AZ_SPAN_FROM_STR("a@b"), AZ_SPAN_FROM_STR("A`B")), -1);
+  assert_int_equal(
+      az_span_find_ignoring_case(AZ_SPAN_FROM_STR("a[b"), AZ_SPAN_FROM_STR("A{B")), -1);
+
+  // The match must be found at every position of a source long enough to cover the vectorized
+  // search (when enabled).
+  uint8_t buffer[100];
+  az_span target = AZ_SPAN_FROM_STR("x-Ms-Retry-After-ms");
+  for (int32_t position = 0; position <= (int32_t)sizeof(buffer) - az_span_size(target); position++)
+  {
+    memset(buffer, 'X', sizeof(buffer));
+    az_span span = AZ_SPAN_FROM_BUFFER(buffer);
+    assert_int_equal(az_span_find_ignoring_case(span, target), -1);
+
+    az_span_copy(az_span_slice_to_end(span, position), AZ_SPAN_FROM_STR("X-MS-RETRY-AFTER-MS"));
+    assert_int_equal(az_span_find_ignoring_case(span, target), position);
+  }
+}
+
 static void test_az_span_is_content_equal(void** state)
 {
   (void)state;
@@ -352,6 +427,167 @@ static void az_span_atoi64_test(void** state)
       az_span_atoi64(AZ_SPAN_FROM_STR("-9223372036854775809"), &value), AZ_ERROR_UNEXPECTED_CHAR);
 }
 
+// Checks every integer parsing function against a number with the given sign and magnitude,
+// written with leading_zeros zeros in front of it and, if appended_digit is not -1, another digit
+// after it (so that magnitudes above UINT64_MAX can be represented).
+static void _az_span_atox_check(
+    bool is_negative,
+    uint64_t magnitude,
+    int32_t leading_zeros,
+    int32_t appended_digit)
+{
+  uint8_t raw_buffer[32] = { 0 };
+  az_span remainder = AZ_SPAN_FROM_BUFFER(raw_buffer);
+  if (is_negative)
+  {
+    remainder = az_span_copy_u8(remainder, '-');
+  }
+  for (int32_t i = 0; i < leading_zeros; i++)
+  {
+    remainder = az_span_copy_u8(remainder, '0');
+  }
+  assert_int_equal(az_span_u64toa(remainder, magnitude, &remainder), AZ_OK);
+
+  // With the appended digit, the number is magnitude * 10 + appended_digit, which only fits in a
+  // uint64_t up to UINT64_MAX.
+  bool fits_u64 = true;
+  if (appended_digit >= 0)
+  {
+    remainder = az_span_copy_u8(remainder, (uint8_t)('0' + appended_digit));
+    uint64_t const d = (uint64_t)appended_digit;
+    fits_u64 = magnitude <= (UINT64_MAX - d) / 10;
+    magnitude = fits_u64 ? magnitude * 10 + d : 0;
+  }
+  az_span const source = az_span_slice(
+      AZ_SPAN_FROM_BUFFER(raw_buffer), 0, (int32_t)(az_span_ptr(remainder) - raw_buffer));
+
+  uint32_t u32 = 0;
+  int32_t i32 = 0;
+  uint64_t u64 = 0;
+  int64_t i64 = 0;
+
+  bool const u64_ok = fits_u64 && !is_negative;
+  assert_int_equal(az_span_atou64(source, &u64), u64_ok ? AZ_OK : AZ_ERROR_UNEXPECTED_CHAR);
+  if (u64_ok)
+  {
+    assert_true(u64 == magnitude);
+  }
+
+  bool const u32_ok = u64_ok && magnitude <= UINT32_MAX;
+  assert_int_equal(az_span_atou32(source, &u32), u32_ok ? AZ_OK : AZ_ERROR_UNEXPECTED_CHAR);
+  if (u32_ok)
+  {
+    assert_true(u32 == magnitude);
+  }
+
+  bool const i64_ok = fits_u64 && magnitude <= (uint64_t)INT64_MAX + (is_negative ? 1 : 0);
+  assert_int_equal(az_span_atoi64(source, &i64), i64_ok ? AZ_OK : AZ_ERROR_UNEXPECTED_CHAR);
+  if (i64_ok)
+  {
+    assert_true(i64 == (is_negative ? -(int64_t)(magnitude - 1) - 1 : (int64_t)magnitude));
+  }
+
+  bool const i32_ok = fits_u64 && magnitude <= (uint64_t)INT32_MAX + (is_negative ? 1 : 0);
+  assert_int_equal(az_span_atoi32(source, &i32), i32_ok ? AZ_OK : AZ_ERROR_UNEXPECTED_CHAR);
+  if (i32_ok)
+  {
+    assert_true(
+        i32 == (is_negative ? -(int32_t)(uint32_t)(magnitude - 1) - 1 : (int32_t)magnitude));
+  }
+}
+
+static void az_span_atox_boundaries(void** state)
+{
+  (void)state;
+
+  // Every integer type limit, and every power of 10 (where the number of digits, and therefore how
+  // many of them are parsed 8 at a time, changes).
+  uint64_t limits[8 + 20] = {
+    0,
+    INT32_MAX,
+    (uint64_t)INT32_MAX + 1,
+    UINT32_MAX,
+    (uint64_t)UINT32_MAX + 1,
+    INT64_MAX,
+    (uint64_t)INT64_MAX + 1,
+    UINT64_MAX,
+  };
+  uint64_t power_of_10 = 1;
+  for (int32_t i = 0; i < 20; i++)
+  {
+    limits[8 + i] = power_of_10;
+    power_of_10 *= 10;
+  }
+
+  for (size_t l = 0; l < sizeof(limits) / sizeof(limits[0]); l++)
+  {
+    for (int32_t offset = -300; offset <= 300; offset++)
+    {
+      uint64_t const magnitude = limits[l] + (uint64_t)(int64_t)offset;
+      // Skip the values that wrapped around.
+      if ((offset < 0 && magnitude > limits[l]) || (offset > 0 && magnitude < limits[l]))
+      {
+        continue;
+      }
+      for (int32_t leading_zeros = 0; leading_zeros <= 9; leading_zeros += 3)
+      {
+        _az_span_atox_check(false, magnitude, leading_zeros, -1);
+        _az_span_atox_check(true, magnitude, leading_zeros, -1);
+      }
+    }
+  }
+
+  // Numbers around UINT64_MAX, and above it, written as UINT64_MAX / 10 + offset followed by one
+  // more digit.
+  for (int32_t offset = -300; offset <= 300; offset++)
+  {
+    for (int32_t digit = 0; digit <= 9; digit++)
+    {
+      uint64_t const magnitude = UINT64_MAX / 10 + (uint64_t)(int64_t)offset;
+      _az_span_atox_check(false, magnitude, 0, digit);
+      _az_span_atox_check(true, magnitude, 0, digit);
+      _az_span_atox_check(false, magnitude, 5, digit);
+    }
+  }
+}
+
+static void az_span_atox_invalid_byte_in_every_position_fails(void** state)
+{
+  (void)state;
+
+  uint8_t const invalid_bytes[] = { '/', ':', ' ', '.', 'a', '-', '+', 0x00, 0x80, 0xB0, 0xFF };
+
+  for (int32_t size = 1; size <= 24; size++)
+  {
+    for (int32_t position = 0; position < size; position++)
+    {
+      for (size_t b = 0; b < sizeof(invalid_bytes); b++)
+      {
+        uint8_t raw_buffer[24];
+        memset(raw_buffer, '1', sizeof(raw_buffer));
+        raw_buffer[position] = invalid_bytes[b];
+        az_span const source = az_span_create(raw_buffer, size);
+
+        // A leading sign is valid, as long as digits follow it.
+        bool const is_valid_sign
+            = position == 0 && size > 1 && (invalid_bytes[b] == '+' || invalid_bytes[b] == '-');
+
+        uint32_t u32 = 0;
+        int32_t i32 = 0;
+        uint64_t u64 = 0;
+        int64_t i64 = 0;
+        if (!is_valid_sign)
+        {
+          assert_int_equal(az_span_atou32(source, &u32), AZ_ERROR_UNEXPECTED_CHAR);
+          assert_int_equal(az_span_atoi32(source, &i32), AZ_ERROR_UNEXPECTED_CHAR);
+          assert_int_equal(az_span_atou64(source, &u64), AZ_ERROR_UNEXPECTED_CHAR);
+          assert_int_equal(az_span_atoi64(source, &i64), AZ_ERROR_UNEXPECTED_CHAR);
+        }
+      }
+    }
+  }
+}
+
 #define TEST_AZ_ISFINITE_HELPER(source, expected)      \
   do                                                   \
   {                                                    \
@@ -638,6 +874,89 @@ static void az_span_atod_test(void** state)
   assert_true(value == 0);
 }
 
+static void az_span_atod_correctly_rounded(void** state)
+{
+  (void)state;
+  double value = 0;
+
+  // Exactly halfway between two doubles, ties round to even.
+  assert_int_equal(az_span_atod(AZ_SPAN_FROM_STR("9007199254740993"), &value), AZ_OK);
+  assert_true(value == 9007199254740992.0);
+  assert_int_equal(az_span_atod(AZ_SPAN_FROM_STR("9007199254740995"), &value), AZ_OK);
+  assert_true(value == 9007199254740996.0);
+
+  // Just above halfway, only the digits past the first 19 tell them apart.
+  assert_int_equal(
+      az_span_atod(AZ_SPAN_FROM_STR("9007199254740993.00000000000000000000000001"), &value), AZ_OK);
+  assert_true(value == 9007199254740994.0);
+
+  // The exact decimal value of the double closest to 0.1.
+  assert_int_equal(
+      az_span_atod(
+          AZ_SPAN_FROM_STR("0.1000000000000000055511151231257827021181583404541015625"), &value),
+      AZ_OK);
+  assert_true(value == 0.1);
+
+  // Shortest round-trip representations, with 17 significant digits.
+  assert_int_equal(az_span_atod(AZ_SPAN_FROM_STR("0.30000000000000004"), &value), AZ_OK);
+  assert_true(value == 0.30000000000000004);
+  assert_int_equal(az_span_atod(AZ_SPAN_FROM_STR("2.2250738585072014e-308"), &value), AZ_OK);
+  assert_true(value == DBL_MIN);
+  assert_int_equal(az_span_atod(AZ_SPAN_FROM_STR("1.7976931348623157e308"), &value), AZ_OK);
+  assert_true(value == DBL_MAX);
+  assert_int_equal(az_span_atod(AZ_SPAN_FROM_STR("1.7976931348623158e308"), &value), AZ_OK);
+  assert_true(value == DBL_MAX);
+  assert_int_equal(
+      az_span_atod(AZ_SPAN_FROM_STR("1.7976931348623159e308"), &value), AZ_ERROR_UNEXPECTED_CHAR);
+
+  // Subnormal numbers, and the boundary below which values round to 0.
+  assert_int_equal(az_span_atod(AZ_SPAN_FROM_STR("2.2250738585072009e-308"), &value), AZ_OK);
+  assert_true(value == 2.2250738585072009e-308);
+  assert_int_equal(az_span_atod(AZ_SPAN_FROM_STR("4.9406564584124654e-324"), &value), AZ_OK);
+  assert_true(value == 4.9406564584124654e-324);
+  assert_int_equal(az_span_atod(AZ_SPAN_FROM_STR("1e-323"), &value), AZ_OK);
+  assert_true(value == 1e-323);
+  assert_int_equal(az_span_atod(AZ_SPAN_FROM_STR("2.4703282292062328e-324"), &value), AZ_OK);
+  assert_true(value == 4.9406564584124654e-324);
+  assert_int_equal(az_span_atod(AZ_SPAN_FROM_STR("-2.4703282292062328e-324"), &value), AZ_OK);
+  assert_true(value == -4.9406564584124654e-324);
+  assert_int_equal(az_span_atod(AZ_SPAN_FROM_STR("2.4703282292062327e-324"), &value), AZ_OK);
+  assert_true(value == 0);
+
+  // Large exponents paired with many digits.
+  assert_int_equal(
+      az_span_atod(AZ_SPAN_FROM_STR("123456789012345678901234567890e-339"), &value), AZ_OK);
+  assert_true(value == 123456789012345678901234567890e-339);
+  assert_int_equal(
+      az_span_atod(AZ_SPAN_FROM_STR("0.00000000000000000000000000000000000000001e308"), &value),
+      AZ_OK);
+  assert_true(value == 0.00000000000000000000000000000000000000001e308);
+  assert_int_equal(
+      az_span_atod(AZ_SPAN_FROM_STR("1e00000000000000000000000000000000000"), &value), AZ_OK);
+  assert_true(value == 1);
+  assert_int_equal(az_span_atod(AZ_SPAN_FROM_STR("0e999999999999"), &value), AZ_OK);
+  assert_true(value == 0);
+  assert_int_equal(az_span_atod(AZ_SPAN_FROM_STR("1e-999999999999"), &value), AZ_OK);
+  assert_true(value == 0);
+  assert_int_equal(
+      az_span_atod(AZ_SPAN_FROM_STR("1e999999999999"), &value), AZ_ERROR_UNEXPECTED_CHAR);
+
+  // Malformed exponents and decimal points.
+  assert_int_equal(az_span_atod(AZ_SPAN_FROM_STR("1e"), &value), AZ_ERROR_UNEXPECTED_CHAR);
+  assert_int_equal(az_span_atod(AZ_SPAN_FROM_STR("1E+"), &value), AZ_ERROR_UNEXPECTED_CHAR);
+  assert_int_equal(az_span_atod(AZ_SPAN_FROM_STR("1.5e-"), &value), AZ_ERROR_UNEXPECTED_CHAR);
+  assert_int_equal(az_span_atod(AZ_SPAN_FROM_STR("1e+-2"), &value), AZ_ERROR_UNEXPECTED_CHAR);
+  assert_int_equal(az_span_atod(AZ_SPAN_FROM_STR("1..2"), &value), AZ_ERROR_UNEXPECTED_CHAR);
+  assert_int_equal(az_span_atod(AZ_SPAN_FROM_STR("1.2.3"), &value), AZ_ERROR_UNEXPECTED_CHAR);
+  assert_int_equal(az_span_atod(AZ_SPAN_FROM_STR("+-1"), &value), AZ_ERROR_UNEXPECTED_CHAR);
+  assert_int_equal(az_span_atod(AZ_SPAN_FROM_STR("-"), &value), AZ_ERROR_UNEXPECTED_CHAR);
+
+  // Hexadecimal floating-point numbers, which sscanf used to read, aren't decimal notation.
+  assert_int_equal(az_span_atod(AZ_SPAN_FROM_STR("0x10"), &value), AZ_ERROR_UNEXPECTED_CHAR);
+  assert_int_equal(az_span_atod(AZ_SPAN_FROM_STR("0x1p3"), &value), AZ_ERROR_UNEXPECTED_CHAR);
+  assert_int_equal(az_span_atod(AZ_SPAN_FROM_STR("-0X1.8P-1"), &value), AZ_ERROR_UNEXPECTED_CHAR);
+}
+
 #ifdef __GNUC__
 #pragma GCC diagnostic pop
 #endif // __GNUC__
@@ -934,6 +1253,110 @@ static void az_span_find_overlapping_checks_success(void** state)
   assert_int_equal(az_span_find(source, az_span_slice(span, 2, 4)), 1);
 }
 
+static void az_span_find_long_source_success(void** state)
+{
+  (void)state;
+
+  // Long enough to cover the vectorized path (when enabled) and the scalar tail, with the target
+  // placed at every position and near-matches sharing either the first or the last byte.
+  uint8_t buffer[150];
+  az_span target = AZ_SPAN_FROM_STR("/?$rid=");
+  int32_t const target_size = az_span_size(target);
+
+  for (int32_t source_size = target_size; source_size <= (int32_t)sizeof(buffer); source_size++)
+  {
+    for (int32_t position = 0; position <= source_size - target_size; position++)
+    {
+      for (int32_t i = 0; i < source_size; i++)
+      {
+        buffer[i] = (uint8_t)((i % 2 == 0) ? '/' : '=');
+      }
+      az_span source = az_span_create(buffer, source_size);
+
+      assert_int_equal(az_span_find(source, target), -1);
+      assert_int_equal(az_span_find(source, AZ_SPAN_FROM_STR("/")), 0);
+      assert_int_equal(az_span_find(source, AZ_SPAN_FROM_STR("=")), source_size > 1 ? 1 : -1);
+
+      az_span_copy(az_span_slice_to_end(source, position), target);
+      assert_int_equal(az_span_find(source, target), position);
+      assert_int_equal(az_span_find(source, az_span_slice(target, 2, target_size)), position + 2);
+    }
+  }
+}
+
+static void az_span_searcher_find_success(void** state)
+{
+  (void)state;
+
+  az_span source = AZ_SPAN_FROM_STR("$iothub/methods/POST/TestMethod/?$rid=1");
+
+  az_span_searcher searcher = az_span_searcher_create(AZ_SPAN_FROM_STR("$iothub/methods/"));
+  assert_int_equal(az_span_searcher_find(&searcher, source), 0);
+
+  searcher = az_span_searcher_create(AZ_SPAN_FROM_STR("/?$rid="));
+  assert_int_equal(az_span_searcher_find(&searcher, source), 31);
+
+  searcher = az_span_searcher_create(AZ_SPAN_FROM_STR("=1"));
+  assert_int_equal(az_span_searcher_find(&searcher, source), 37);
+
+  searcher = az_span_searcher_create(AZ_SPAN_FROM_STR("/?$rid=2"));
+  assert_int_equal(az_span_searcher_find(&searcher, source), -1);
+
+  searcher = az_span_searcher_create(AZ_SPAN_FROM_STR("M"));
+  assert_int_equal(az_span_searcher_find(&searcher, source), 25);
+
+  searcher = az_span_searcher_create(AZ_SPAN_EMPTY);
+  assert_int_equal(az_span_searcher_find(&searcher, source), 0);
+  assert_int_equal(az_span_searcher_find(&searcher, AZ_SPAN_EMPTY), 0);
+
+  searcher = az_span_searcher_create(source);
+  assert_int_equal(az_span_searcher_find(&searcher, AZ_SPAN_EMPTY), -1);
+  assert_int_equal(az_span_searcher_find(&searcher, az_span_slice(source, 1, 10)), -1);
+  assert_int_equal(az_span_searcher_find(&searcher, source), 0);
+}
+
+static void az_span_searcher_find_matches_az_span_find(void** state)
+{
+  (void)state;
+
+  // Every source of up to 8 bytes over a 3-letter alphabet, against targets that exercise both
+  // the skip and the bloom filter paths.
+  az_span const targets[] = {
+    AZ_SPAN_LITERAL_FROM_STR("ab"),   AZ_SPAN_LITERAL_FROM_STR("aa"),
+    AZ_SPAN_LITERAL_FROM_STR("aba"),  AZ_SPAN_LITERAL_FROM_STR("abca"),
+    AZ_SPAN_LITERAL_FROM_STR("ccab"), AZ_SPAN_LITERAL_FROM_STR("abcabc"),
+    AZ_SPAN_LITERAL_FROM_STR("aaxa"), AZ_SPAN_LITERAL_FROM_STR("bbbbbbbb"),
+  };
+
+  uint8_t buffer[8];
+  for (int32_t size = 0; size <= (int32_t)sizeof(buffer); size++)
+  {
+    int32_t combinations = 1;
+    for (int32_t i = 0; i < size; i++)
+    {
+      combinations *= 3;
+    }
+
+    for (int32_t combination = 0; combination < combinations; combination++)
+    {
+      int32_t remaining = combination;
+      for (int32_t i = 0; i < size; i++)
+      {
+        buffer[i] = (uint8_t)('a' + (remaining % 3));
+        remaining /= 3;
+      }
+      az_span source = az_span_create(buffer, size);
+
+      for (size_t t = 0; t < _az_COUNTOF(targets); t++)
+      {
+        az_span_searcher const searcher = az_span_searcher_create(targets[t]);
+        assert_int_equal(
+            az_span_searcher_find(&searcher, source), az_span_find(source, targets[t]));
+      }
+    }
+  }
+}
+
 static void az_span_i64toa_test(void** state)
 {
   (void)state;
@@ -1187,6 +1610,82 @@ static void az_span_u32toa_overflow_fails(void** state)
   assert_true(az_span_u32toa(buffer, v, &out_span) == AZ_ERROR_NOT_ENOUGH_SPACE);
 }
 
+static void az_span_u64toa_size_succeeds(void** state)
+{
+  (void)state;
+
+  assert_int_equal(az_span_u64toa_size(0), 1);
+  assert_int_equal(az_span_u64toa_size(UINT32_MAX), 10);
+  assert_int_equal(az_span_u64toa_size(UINT64_MAX), 20);
+
+  uint64_t power_of_10 = 1;
+  for (int32_t digits = 1; digits <= 20; digits++)
+  {
+    assert_int_equal(az_span_u64toa_size(power_of_10), digits);
+    assert_int_equal(az_span_u64toa_size(power_of_10 - 1), digits == 1 ? 1 : digits - 1);
+    assert_int_equal(az_span_u64toa_size(power_of_10 + 1), digits);
+    power_of_10 *= 10;
+  }
+
+  assert_int_equal(az_span_i64toa_size(0), 1);
+  assert_int_equal(az_span_i64toa_size(-1), 2);
+  assert_int_equal(az_span_i64toa_size(-10), 3);
+  assert_int_equal(az_span_i64toa_size(INT64_MAX), 19);
+  assert_int_equal(az_span_i64toa_size(INT64_MIN), 20);
+  assert_int_equal(az_span_i64toa_size(INT32_MIN), 11);
+}
+
+static void az_span_u64toa_writes_exactly_size_bytes(void** state)
+{
+  (void)state;
+
+  uint8_t raw_buffer[20];
+
+  // Around every power of 10, and around UINT32_MAX, where the conversion switches from 64-bit to
+  // 32-bit arithmetic.
+  uint64_t bases[21] = { UINT32_MAX };
+  uint64_t power_of_10 = 1;
+  for (int32_t i = 1; i < 21; i++)
+  {
+    bases[i] = power_of_10;
+    power_of_10 *= 10;
+  }
+
+  for (size_t b = 0; b < sizeof(bases) / sizeof(bases[0]); b++)
+  {
+    for (uint64_t offset = 0; offset <= 200; offset++)
+    {
+      uint64_t const value = bases[b] - 100 + offset;
+      if (value > bases[b] + 100)
+      {
+        continue; // Wrapped around 0.
+      }
+      int32_t const size = az_span_u64toa_size(value);
+      az_span out_span;
+
+      assert_int_equal(
+          az_span_u64toa(az_span_create(raw_buffer, size - 1), value, &out_span),
+          AZ_ERROR_NOT_ENOUGH_SPACE);
+      assert_int_equal(az_span_u64toa(az_span_create(raw_buffer, size), value, &out_span), AZ_OK);
+      assert_int_equal(az_span_size(out_span), 0);
+
+      uint64_t reverse = 0;
+      assert_int_equal(az_span_atou64(az_span_create(raw_buffer, size), &reverse), AZ_OK);
+      assert_true(reverse == value);
+    }
+  }
+
+  az_span out_span;
+  assert_int_equal(az_span_i64toa(AZ_SPAN_FROM_BUFFER(raw_buffer), INT64_MIN, &out_span), AZ_OK);
+  assert_true(az_span_is_content_equal(
+      az_span_create(raw_buffer, az_span_i64toa_size(INT64_MIN)),
+      AZ_SPAN_FROM_STR("-9223372036854775808")));
+  assert_int_equal(az_span_i32toa(AZ_SPAN_FROM_BUFFER(raw_buffer), INT32_MIN, &out_span), AZ_OK);
+  assert_true(az_span_is_content_equal(
+      az_span_create(raw_buffer, az_span_i64toa_size(INT32_MIN)),
+      AZ_SPAN_FROM_STR("-2147483648")));
+}
+
 #define AZ_SPAN_DTOA_SUCCEEDS_HELPER(v, fractional_digits, expected)                         \
   do                                                                                         \
   {                                                                                          \
@@ -1493,6 +1992,114 @@ static void az_span_dtoa_too_large(void** state)
   assert_int_equal(az_span_dtoa(buff, 1.7e308, 15, &o), AZ_ERROR_NOT_SUPPORTED);
 }
 
+#define AZ_SPAN_DTOA_SHORTEST_SUCCEEDS_HELPER(v, expected)                                    \
+  do                                                                                         \
+  {                                                                                          \
+    uint8_t raw_buffer[25] = { 0 };                                                          \
+    az_span buffer = AZ_SPAN_FROM_BUFFER(raw_buffer);                                        \
+    az_span out_span = AZ_SPAN_EMPTY;                                                        \
+    double const value = v;                                                                  \
+    assert_int_equal(az_span_dtoa_shortest(buffer, value, &out_span), AZ_OK);                \
+    az_span output = az_span_slice(buffer, 0, _az_span_diff(out_span, buffer));              \
+    assert_true(az_span_is_content_equal(output, AZ_SPAN_FROM_STR(expected)));               \
+    double round_trip = 0;                                                                   \
+    assert_int_equal(az_span_atod(output, &round_trip), AZ_OK);                              \
+    assert_memory_equal(&round_trip, &value, sizeof(value));                                 \
+  } while (0)
+
+static void az_span_dtoa_shortest_succeeds(void** state)
+{
+  (void)state;
+
+  AZ_SPAN_DTOA_SHORTEST_SUCCEEDS_HELPER(0.0, "0");
+  AZ_SPAN_DTOA_SHORTEST_SUCCEEDS_HELPER(-0.0, "-0");
+  AZ_SPAN_DTOA_SHORTEST_SUCCEEDS_HELPER(1.0, "1");
+  AZ_SPAN_DTOA_SHORTEST_SUCCEEDS_HELPER(-12.5, "-12.5");
+  AZ_SPAN_DTOA_SHORTEST_SUCCEEDS_HELPER(0.1, "0.1");
+  AZ_SPAN_DTOA_SHORTEST_SUCCEEDS_HELPER(0.1 + 0.2, "0.30000000000000004");
+  AZ_SPAN_DTOA_SHORTEST_SUCCEEDS_HELPER(1013.25, "1013.25");
+  AZ_SPAN_DTOA_SHORTEST_SUCCEEDS_HELPER(47.641468, "47.641468");
+  AZ_SPAN_DTOA_SHORTEST_SUCCEEDS_HELPER(123456.789e3, "123456789");
+  AZ_SPAN_DTOA_SHORTEST_SUCCEEDS_HELPER(9007199254740993.0, "9007199254740992");
+  AZ_SPAN_DTOA_SHORTEST_SUCCEEDS_HELPER(1e20, "100000000000000000000");
+  AZ_SPAN_DTOA_SHORTEST_SUCCEEDS_HELPER(123456789012345680000.0, "123456789012345680000");
+  AZ_SPAN_DTOA_SHORTEST_SUCCEEDS_HELPER(1e21, "1e+21");
+  AZ_SPAN_DTOA_SHORTEST_SUCCEEDS_HELPER(1e23, "1e+23");
+  AZ_SPAN_DTOA_SHORTEST_SUCCEEDS_HELPER(0.000001, "0.000001");
+  AZ_SPAN_DTOA_SHORTEST_SUCCEEDS_HELPER(0.0000012345, "0.0000012345");
+  AZ_SPAN_DTOA_SHORTEST_SUCCEEDS_HELPER(1e-7, "1e-7");
+  AZ_SPAN_DTOA_SHORTEST_SUCCEEDS_HELPER(-1.5e-7, "-1.5e-7");
+  AZ_SPAN_DTOA_SHORTEST_SUCCEEDS_HELPER(
+      -0.0000012345678901234567, "-0.0000012345678901234567");
+
+  // The extremes: smallest subnormal, largest subnormal, smallest normal and largest double.
+  AZ_SPAN_DTOA_SHORTEST_SUCCEEDS_HELPER(4.9406564584124654e-324, "5e-324");
+  AZ_SPAN_DTOA_SHORTEST_SUCCEEDS_HELPER(2.2250738585072009e-308, "2.225073858507201e-308");
+  AZ_SPAN_DTOA_SHORTEST_SUCCEEDS_HELPER(DBL_MIN, "2.2250738585072014e-308");
+  AZ_SPAN_DTOA_SHORTEST_SUCCEEDS_HELPER(DBL_MAX, "1.7976931348623157e+308");
+  AZ_SPAN_DTOA_SHORTEST_SUCCEEDS_HELPER(-DBL_MAX, "-1.7976931348623157e+308");
+
+  // Powers of 2, where the next smaller double is closer than the next larger one.
+  AZ_SPAN_DTOA_SHORTEST_SUCCEEDS_HELPER(9007199254740992.0, "9007199254740992");
+  AZ_SPAN_DTOA_SHORTEST_SUCCEEDS_HELPER(5.9604644775390625e-8, "5.960464477539063e-8");
+  AZ_SPAN_DTOA_SHORTEST_SUCCEEDS_HELPER(8.98846567431158e307, "8.98846567431158e+307");
+}
+
+static void az_span_dtoa_shortest_round_trips(void** state)
+{
+  (void)state;
+
+  uint8_t raw_buffer[25] = { 0 };
+  az_span buffer = AZ_SPAN_FROM_BUFFER(raw_buffer);
+
+  // Arbitrary bit patterns, from a xorshift generator with a fixed seed.
+  uint64_t bits = 88172645463325252ULL;
+  for (int32_t i = 0; i < 100000; i++)
+  {
+    bits ^= bits << 13U;
+    bits ^= bits >> 7U;
+    bits ^= bits << 17U;
+
+    double value = 0;
+    memcpy(&value, &bits, sizeof(value));
+    if (!_az_isfinite(value))
+    {
+      continue;
+    }
+
+    az_span out_span = AZ_SPAN_EMPTY;
+    assert_int_equal(az_span_dtoa_shortest(buffer, value, &out_span), AZ_OK);
+
+    double round_trip = 0;
+    assert_int_equal(
+        az_span_atod(az_span_slice(buffer, 0, _az_span_diff(out_span, buffer)), &round_trip),
+        AZ_OK);
+    assert_memory_equal(&round_trip, &value, sizeof(value));
+  }
+}
+
+static void az_span_dtoa_shortest_overflow_fails(void** state)
+{
+  (void)state;
+
+  uint8_t raw_buffer[25];
+  az_span buff = AZ_SPAN_FROM_BUFFER(raw_buffer);
+  az_span o;
+
+  assert_int_equal(
+      az_span_dtoa_shortest(az_span_slice(buff, 0, 0), 0, &o), AZ_ERROR_NOT_ENOUGH_SPACE);
+  assert_int_equal(
+      az_span_dtoa_shortest(az_span_slice(buff, 0, 1), -1, &o), AZ_ERROR_NOT_ENOUGH_SPACE);
+  assert_int_equal(
+      az_span_dtoa_shortest(az_span_slice(buff, 0, 3), 1e-7, &o), AZ_ERROR_NOT_ENOUGH_SPACE);
+  assert_int_equal(
+      az_span_dtoa_shortest(az_span_slice(buff, 0, 18), 0.1 + 0.2, &o),
+      AZ_ERROR_NOT_ENOUGH_SPACE);
+  assert_int_equal(
+      az_span_dtoa_shortest(az_span_slice(buff, 0, 22), DBL_MAX, &o), AZ_ERROR_NOT_ENOUGH_SPACE);
+  assert_int_equal(az_span_dtoa_shortest(az_span_slice(buff, 0, 23), DBL_MAX, &o), AZ_OK);
+}
+
 static void az_span_copy_empty(void** state)
 {
   (void)state;
@@ -1758,6 +2365,8 @@ int test_az_span()
     cmocka_unit_test(az_span_to_lower_test),
     cmocka_unit_test(az_span_to_str_test),
     cmocka_unit_test(test_az_span_is_content_equal),
+    cmocka_unit_test(az_span_is_content_equal_ignoring_case_long_test),
+    cmocka_unit_test(az_span_find_ignoring_case_test),
     cmocka_unit_test(az_span_find_beginning_success),
     cmocka_unit_test(az_span_find_middle_success),
     cmocka_unit_test(az_span_find_end_success),
@@ -1771,13 +2380,19 @@ int test_az_span()
     cmocka_unit_test(az_span_find_embedded_NULLs_success),
     cmocka_unit_test(az_span_find_capacity_checks_success),
     cmocka_unit_test(az_span_find_overlapping_checks_success),
+    cmocka_unit_test(az_span_find_long_source_success),
+    cmocka_unit_test(az_span_searcher_find_success),
+    cmocka_unit_test(az_span_searcher_find_matches_az_span_find),
     cmocka_unit_test(az_span_atox_return_errors),
     cmocka_unit_test(az_span_atou32_test),
     cmocka_unit_test(az_span_atoi32_test),
     cmocka_unit_test(az_span_atou64_test),
     cmocka_unit_test(az_span_atoi64_test),
+    cmocka_unit_test(az_span_atox_boundaries),
+    cmocka_unit_test(az_span_atox_invalid_byte_in_every_position_fails),
     cmocka_unit_test(test_az_isfinite),
     cmocka_unit_test(az_span_atod_test),
+    cmocka_unit_test(az_span_atod_correctly_rounded),
     cmocka_unit_test(az_span_atod_non_finite_not_allowed),
     cmocka_unit_test(az_span_ato_number_whitespace_or_invalid_not_allowed),
     cmocka_unit_test(az_span_ato_number_no_out_of_bounds_reads),
@@ -1795,9 +2410,14 @@ int test_az_span()
     cmocka_unit_test(az_span_u32toa_zero_succeeds),
     cmocka_unit_test(az_span_u32toa_max_uint_succeeds),
     cmocka_unit_test(az_span_u32toa_overflow_fails),
+    cmocka_unit_test(az_span_u64toa_size_succeeds),
+    cmocka_unit_test(az_span_u64toa_writes_exactly_size_bytes),
     cmocka_unit_test(az_span_dtoa_succeeds),
     cmocka_unit_test(az_span_dtoa_overflow_fails),
     cmocka_unit_test(az_span_dtoa_too_large),
+    cmocka_unit_test(az_span_dtoa_shortest_succeeds),
+    cmocka_unit_test(az_span_dtoa_shortest_round_trips),
+    cmocka_unit_test(az_span_dtoa_shortest_overflow_fails),
     cmocka_unit_test(az_span_copy_empty),
     cmocka_unit_test(test_az_span_is_valid),
     cmocka_unit_test(test_az_span_overlap),
@@ -0,0 +1,228 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "az_test_definitions.h"
+#include <azure/core/az_json.h>
+#include <azure/core/az_span_arena.h>
+
+#include <stdarg.h>
+#include <stddef.h>
+
+#include <setjmp.h>
+#include <stdint.h>
+
+#include <cmocka.h>
+
+#include <azure/core/_az_cfg.h>
+
+static void test_span_arena_allocate(void** state)
+{
+  (void)state;
+  uint8_t buffer[16] = { 0 };
+  az_span_arena arena = { 0 };
+  assert_int_equal(az_span_arena_init(&arena, AZ_SPAN_FROM_BUFFER(buffer), NULL), AZ_OK);
+  assert_int_equal(az_span_arena_get_bytes_used(&arena), 0);
+
+  az_span first = AZ_SPAN_EMPTY;
+  az_span second = AZ_SPAN_EMPTY;
+  az_span empty = AZ_SPAN_EMPTY;
+  assert_int_equal(az_span_arena_allocate(&arena, 5, &first), AZ_OK);
+  assert_int_equal(az_span_arena_allocate(&arena, 0, &empty), AZ_OK);
+  assert_int_equal(az_span_arena_allocate(&arena, 11, &second), AZ_OK);
+
+  assert_ptr_equal(az_span_ptr(first), buffer);
+  assert_int_equal(az_span_size(first), 5);
+  assert_int_equal(az_span_size(empty), 0);
+  assert_ptr_equal(az_span_ptr(second), buffer + 5);
+  assert_int_equal(az_span_size(second), 11);
+  assert_int_equal(az_span_arena_get_bytes_used(&arena), 16);
+
+  // A failed allocation leaves the arena as it was.
+  az_span failed = AZ_SPAN_FROM_STR("untouched");
+  assert_int_equal(az_span_arena_allocate(&arena, 1, &failed), AZ_ERROR_NOT_ENOUGH_SPACE);
+  assert_true(az_span_is_content_equal(failed, AZ_SPAN_FROM_STR("untouched")));
+  assert_int_equal(az_span_arena_get_bytes_used(&arena), 16);
+  assert_int_equal(az_span_arena_allocate(&arena, 0, &empty), AZ_OK);
+}
+
+static void test_span_arena_alignment(void** state)
+{
+  (void)state;
+  uint64_t storage[8] = { 0 };
+  az_span const buffer = az_span_create((uint8_t*)storage, (int32_t)sizeof(storage));
+
+  az_span_arena_options options = az_span_arena_options_default();
+  assert_int_equal(options.alignment, 1);
+  options.alignment = 8;
+
+  az_span_arena arena = { 0 };
+  assert_int_equal(az_span_arena_init(&arena, buffer, &options), AZ_OK);
+
+  az_span span = AZ_SPAN_EMPTY;
+  assert_int_equal(az_span_arena_allocate(&arena, 3, &span), AZ_OK);
+  assert_ptr_equal(az_span_ptr(span), az_span_ptr(buffer));
+  assert_int_equal(az_span_arena_allocate(&arena, 3, &span), AZ_OK);
+  assert_ptr_equal(az_span_ptr(span), az_span_ptr(buffer) + 8);
+  assert_int_equal(az_span_arena_get_bytes_used(&arena), 11);
+
+  assert_int_equal(az_span_arena_allocate_aligned(&arena, 1, 1, &span), AZ_OK);
+  assert_ptr_equal(az_span_ptr(span), az_span_ptr(buffer) + 11);
+  assert_int_equal(az_span_arena_allocate_aligned(&arena, 4, 32, &span), AZ_OK);
+  assert_int_equal((uintptr_t)az_span_ptr(span) % 32, 0);
+
+  // The padding needed to align counts against the space left.
+  assert_int_equal(az_span_arena_init(&arena, az_span_slice(buffer, 1, 8), &options), AZ_OK);
+  assert_int_equal(az_span_arena_allocate(&arena, 1, &span), AZ_ERROR_NOT_ENOUGH_SPACE);
+  assert_int_equal(az_span_arena_allocate(&arena, 0, &span), AZ_OK);
+  assert_ptr_equal(az_span_ptr(span), az_span_ptr(buffer) + 8);
+}
+
+static void test_span_arena_blocks(void** state)
+{
+  (void)state;
+  uint8_t blocks[AZ_SPAN_ARENA_MAX_BLOCKS][8] = { { 0 } };
+
+  az_span_arena arena = { 0 };
+  assert_int_equal(az_span_arena_init(&arena, AZ_SPAN_EMPTY, NULL), AZ_OK);
+
+  az_span span = AZ_SPAN_EMPTY;
+  assert_int_equal(az_span_arena_allocate(&arena, 1, &span), AZ_ERROR_NOT_ENOUGH_SPACE);
+
+  for (int32_t i = 0; i < AZ_SPAN_ARENA_MAX_BLOCKS - 1; i++)
+  {
+    assert_int_equal(az_span_arena_add_block(&arena, AZ_SPAN_FROM_BUFFER(blocks[i])), AZ_OK);
+  }
+  assert_int_equal(
+      az_span_arena_add_block(&arena, AZ_SPAN_FROM_BUFFER(blocks[AZ_SPAN_ARENA_MAX_BLOCKS - 1])),
+      AZ_ERROR_NOT_ENOUGH_SPACE);
+
+  // An allocation that doesn't fit in the rest of a block skips to the next one.
+  assert_int_equal(az_span_arena_allocate(&arena, 6, &span), AZ_OK);
+  assert_ptr_equal(az_span_ptr(span), blocks[0]);
+  assert_int_equal(az_span_arena_allocate(&arena, 4, &span), AZ_OK);
+  assert_ptr_equal(az_span_ptr(span), blocks[1]);
+  assert_int_equal(az_span_arena_get_bytes_used(&arena), 12);
+
+  // An allocation larger than any block fails without skipping anything.
+  assert_int_equal(az_span_arena_allocate(&arena, 9, &span), AZ_ERROR_NOT_ENOUGH_SPACE);
+  assert_int_equal(az_span_arena_get_bytes_used(&arena), 12);
+  assert_int_equal(az_span_arena_allocate(&arena, 4, &span), AZ_OK);
+  assert_ptr_equal(az_span_ptr(span), blocks[1] + 4);
+}
+
+static void test_span_arena_mark_and_reset(void** state)
+{
+  (void)state;
+  uint8_t first_block[8] = { 0 };
+  uint8_t second_block[8] = { 0 };
+
+  az_span_arena arena = { 0 };
+  assert_int_equal(az_span_arena_init(&arena, AZ_SPAN_FROM_BUFFER(first_block), NULL), AZ_OK);
+  assert_int_equal(az_span_arena_add_block(&arena, AZ_SPAN_FROM_BUFFER(second_block)), AZ_OK);
+
+  az_span span = AZ_SPAN_EMPTY;
+  assert_int_equal(az_span_arena_allocate(&arena, 3, &span), AZ_OK);
+
+  az_span_arena_mark const mark = az_span_arena_get_mark(&arena);
+  assert_int_equal(az_span_arena_allocate(&arena, 4, &span), AZ_OK);
+  assert_int_equal(az_span_arena_allocate(&arena, 6, &span), AZ_OK);
+  assert_ptr_equal(az_span_ptr(span), second_block);
+  assert_int_equal(az_span_arena_get_bytes_used(&arena), 14);
+
+  az_span_arena_reset_to_mark(&arena, mark);
+  assert_int_equal(az_span_arena_get_bytes_used(&arena), 3);
+  assert_int_equal(az_span_arena_allocate(&arena, 5, &span), AZ_OK);
+  assert_ptr_equal(az_span_ptr(span), first_block + 3);
+
+  az_span_arena_reset(&arena);
+  assert_int_equal(az_span_arena_get_bytes_used(&arena), 0);
+  assert_int_equal(az_span_arena_get_high_water_mark(&arena), 14);
+  assert_int_equal(az_span_arena_allocate(&arena, 8, &span), AZ_OK);
+  assert_ptr_equal(az_span_ptr(span), first_block);
+  assert_int_equal(az_span_arena_get_high_water_mark(&arena), 14);
+}
+
+static void test_span_arena_json_writer_allocator(void** state)
+{
+  (void)state;
+  uint8_t buffer[64] = { 0 };
+
+  az_span_arena arena = { 0 };
+  assert_int_equal(az_span_arena_init(&arena, AZ_SPAN_FROM_BUFFER(buffer), NULL), AZ_OK);
+
+  az_span prefix = AZ_SPAN_EMPTY;
+  assert_int_equal(az_span_arena_allocate(&arena, 4, &prefix), AZ_OK);
+
+  az_json_writer writer = { 0 };
+  assert_int_equal(
+      az_json_writer_chunked_init(&writer, AZ_SPAN_EMPTY, az_span_arena_allocator, &arena, NULL),
+      AZ_OK);
+  assert_int_equal(az_json_writer_append_begin_object(&writer), AZ_OK);
+  assert_int_equal(az_json_writer_append_property_name(&writer, AZ_SPAN_FROM_STR("name")), AZ_OK);
+  assert_int_equal(az_json_writer_append_string(&writer, AZ_SPAN_FROM_STR("value")), AZ_OK);
+  assert_int_equal(az_json_writer_append_end_object(&writer), AZ_OK);
+
+  // The whole JSON text was written contiguously, right after the earlier allocation.
+  az_span const json = az_json_writer_get_bytes_used_in_destination(&writer);
+  assert_ptr_equal(az_span_ptr(json), buffer + 4);
+  assert_true(az_span_is_content_equal(json, AZ_SPAN_FROM_STR("{\"name\":\"value\"}")));
+
+  // Until committed, the rest of the buffer is considered used.
+  assert_int_equal(az_span_arena_get_bytes_used(&arena), 64);
+
+  // An allocation that doesn't fit leaves the span open, and the arena as it was.
+  az_span failed = AZ_SPAN_EMPTY;
+  assert_int_equal(az_span_arena_allocate(&arena, 64, &failed), AZ_ERROR_NOT_ENOUGH_SPACE);
+  assert_int_equal(az_span_arena_get_bytes_used(&arena), 64);
+  assert_int_equal(az_span_arena_get_high_water_mark(&arena), 4);
+
+  az_span_arena_commit(&arena, az_span_size(json));
+  assert_int_equal(az_span_arena_get_bytes_used(&arena), 4 + az_span_size(json));
+  assert_int_equal(az_span_arena_get_high_water_mark(&arena), 4 + az_span_size(json));
+
+  az_span next = AZ_SPAN_EMPTY;
+  assert_int_equal(az_span_arena_allocate(&arena, 1, &next), AZ_OK);
+  assert_ptr_equal(az_span_ptr(next), az_span_ptr(json) + az_span_size(json));
+}
+
+static void test_span_arena_json_writer_allocator_blocks(void** state)
+{
+  (void)state;
+  uint8_t first_block[16] = { 0 };
+  uint8_t second_block[128] = { 0 };
+
+  az_span_arena arena = { 0 };
+  assert_int_equal(az_span_arena_init(&arena, AZ_SPAN_FROM_BUFFER(first_block), NULL), AZ_OK);
+  assert_int_equal(az_span_arena_add_block(&arena, AZ_SPAN_FROM_BUFFER(second_block)), AZ_OK);
+
+  az_json_writer writer = { 0 };
+  assert_int_equal(
+      az_json_writer_chunked_init(&writer, AZ_SPAN_EMPTY, az_span_arena_allocator, &arena, NULL),
+      AZ_OK);
+  assert_int_equal(az_json_writer_append_begin_array(&writer), AZ_OK);
+  assert_int_equal(az_json_writer_append_int32(&writer, 12345), AZ_OK);
+  assert_int_equal(az_json_writer_append_string(&writer, AZ_SPAN_FROM_STR("abcdefghijkl")), AZ_OK);
+  assert_int_equal(az_json_writer_append_end_array(&writer), AZ_OK);
+
+  // The JSON text continues in the second block; the bytes written to the first one stay used.
+  assert_true(az_span_is_content_equal(az_span_create(first_block, 6), AZ_SPAN_FROM_STR("[12345")));
+  az_span const json = az_json_writer_get_bytes_used_in_destination(&writer);
+  assert_ptr_equal(az_span_ptr(json), second_block);
+  assert_true(az_span_is_content_equal(json, AZ_SPAN_FROM_STR(",\"abcdefghijkl\"]")));
+
+  az_span_arena_commit(&arena, az_span_size(json));
+  assert_int_equal(az_span_arena_get_bytes_used(&arena), 16 + az_span_size(json));
+}
+
+int test_az_span_arena()
+{
+  const struct CMUnitTest tests[] = {
+    cmocka_unit_test(test_span_arena_allocate),
+    cmocka_unit_test(test_span_arena_alignment),
+    cmocka_unit_test(test_span_arena_blocks),
+    cmocka_unit_test(test_span_arena_mark_and_reset),
+    cmocka_unit_test(test_span_arena_json_writer_allocator),
+    cmocka_unit_test(test_span_arena_json_writer_allocator_blocks),
+  };
+  return cmocka_run_group_tests_name("az_core_span_arena", tests, NULL, NULL);
+}
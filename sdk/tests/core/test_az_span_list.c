@@ -0,0 +1,111 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// SPDX-License-Identifier: MIT
+
+#include "az_test_definitions.h"
+#include <azure/core/az_span_list.h>
+
+#include <stdarg.h>
+#include <stddef.h>
+
+#include <setjmp.h>
+#include <stdint.h>
+
+#include <cmocka.h>
+
+#include <azure/core/_az_cfg.h>
+
+static void test_span_list_append_and_size(void** state)
+{
+  (void)state;
+  az_span storage[3] = { 0 };
+  az_span_list list = az_span_list_create_empty(storage, 3);
+  assert_int_equal(az_span_list_get_segment_count(list), 0);
+  assert_int_equal(az_span_list_size(list), 0);
+
+  assert_int_equal(az_span_list_append(&list, AZ_SPAN_FROM_STR("topic/")), AZ_OK);
+  assert_int_equal(az_span_list_append(&list, AZ_SPAN_EMPTY), AZ_OK);
+  assert_int_equal(az_span_list_append(&list, AZ_SPAN_FROM_STR("payload")), AZ_OK);
+  assert_int_equal(
+      az_span_list_append(&list, AZ_SPAN_FROM_STR("extra")), AZ_ERROR_NOT_ENOUGH_SPACE);
+
+  assert_int_equal(az_span_list_get_segment_count(list), 3);
+  assert_int_equal(az_span_list_size(list), 13);
+  assert_true(az_span_is_content_equal(
+      az_span_list_get_segment(list, 2), AZ_SPAN_FROM_STR("payload")));
+
+  uint8_t buffer[16] = { 0 };
+  az_span const remainder = az_span_list_copy(AZ_SPAN_FROM_BUFFER(buffer), list);
+  assert_int_equal(az_span_size(remainder), 3);
+  assert_true(az_span_is_content_equal(
+      az_span_create(buffer, 13), AZ_SPAN_FROM_STR("topic/payload")));
+}
+
+static void test_span_list_find(void** state)
+{
+  (void)state;
+  az_span segments[5] = {
+    AZ_SPAN_FROM_STR("abc"), AZ_SPAN_EMPTY,           AZ_SPAN_FROM_STR("d"),
+    AZ_SPAN_FROM_STR("ef"),  AZ_SPAN_FROM_STR("gabcx"),
+  };
+  az_span_list const list = az_span_list_create(segments, 5);
+
+  assert_int_equal(az_span_list_find(list, AZ_SPAN_EMPTY), 0);
+  assert_int_equal(az_span_list_find(list, AZ_SPAN_FROM_STR("abc")), 0);
+  assert_int_equal(az_span_list_find(list, AZ_SPAN_FROM_STR("bcd")), 1);
+  assert_int_equal(az_span_list_find(list, AZ_SPAN_FROM_STR("cdefg")), 2);
+  assert_int_equal(az_span_list_find(list, AZ_SPAN_FROM_STR("fga")), 5);
+  assert_int_equal(az_span_list_find(list, AZ_SPAN_FROM_STR("abcx")), 7);
+  assert_int_equal(az_span_list_find(list, AZ_SPAN_FROM_STR("x")), 10);
+  assert_int_equal(az_span_list_find(list, AZ_SPAN_FROM_STR("xy")), -1);
+  assert_int_equal(az_span_list_find(list, AZ_SPAN_FROM_STR("ce")), -1);
+  assert_int_equal(az_span_list_find(list, AZ_SPAN_FROM_STR("abcdefgabcx!")), -1);
+
+  assert_int_equal(
+      az_span_list_find(az_span_list_create(NULL, 0), AZ_SPAN_FROM_STR("a")), -1);
+}
+
+static void test_span_list_slice(void** state)
+{
+  (void)state;
+  az_span segments[3] = {
+    AZ_SPAN_FROM_STR("hello"),
+    AZ_SPAN_FROM_STR(", "),
+    AZ_SPAN_FROM_STR("world"),
+  };
+  az_span_list const list = az_span_list_create(segments, 3);
+
+  az_span storage[3] = { 0 };
+  az_span_list slice = az_span_list_create_empty(storage, 3);
+  assert_int_equal(az_span_list_slice(list, 3, 9, &slice), AZ_OK);
+  assert_int_equal(az_span_list_get_segment_count(slice), 3);
+  assert_true(az_span_is_content_equal(az_span_list_get_segment(slice, 0), AZ_SPAN_FROM_STR("lo")));
+  assert_true(az_span_is_content_equal(az_span_list_get_segment(slice, 2), AZ_SPAN_FROM_STR("wo")));
+  assert_ptr_equal(az_span_ptr(az_span_list_get_segment(slice, 0)), az_span_ptr(segments[0]) + 3);
+
+  // Segments outside of the slice are left out.
+  slice = az_span_list_create_empty(storage, 3);
+  assert_int_equal(az_span_list_slice(list, 7, 12, &slice), AZ_OK);
+  assert_int_equal(az_span_list_get_segment_count(slice), 1);
+  assert_true(
+      az_span_is_content_equal(az_span_list_get_segment(slice, 0), AZ_SPAN_FROM_STR("world")));
+
+  slice = az_span_list_create_empty(storage, 3);
+  assert_int_equal(az_span_list_slice(list, 4, 4, &slice), AZ_OK);
+  assert_int_equal(az_span_list_get_segment_count(slice), 0);
+
+  // The destination is left unchanged when it is too small.
+  slice = az_span_list_create_empty(storage, 2);
+  assert_int_equal(az_span_list_append(&slice, AZ_SPAN_FROM_STR(">")), AZ_OK);
+  assert_int_equal(az_span_list_slice(list, 0, 12, &slice), AZ_ERROR_NOT_ENOUGH_SPACE);
+  assert_int_equal(az_span_list_get_segment_count(slice), 1);
+}
+
+int test_az_span_list()
+{
+  const struct CMUnitTest tests[] = {
+    cmocka_unit_test(test_span_list_append_and_size),
+    cmocka_unit_test(test_span_list_find),
+    cmocka_unit_test(test_span_list_slice),
+  };
+  return cmocka_run_group_tests_name("az_core_span_list", tests, NULL, NULL);
+}
@@ -415,6 +415,74 @@ static void test_url_encode_usage(void** state)
   assert_int_equal(url_length, sizeof("https%3A%2F%2Fvault.azure.net") - 1);
 }
 
+// The byte-by-byte encoding that _az_span_url_encode is expected to match.
+static int32_t _reference_url_encode(uint8_t* destination, uint8_t const* source, int32_t size)
+{
+  static char const hex[] = "0123456789ABCDEF";
+  int32_t length = 0;
+  for (int32_t i = 0; i < size; i++)
+  {
+    uint8_t const c = source[i];
+    if (('0' <= c && c <= '9') || ('A' <= c && c <= 'Z') || ('a' <= c && c <= 'z') || c == '-'
+        || c == '_' || c == '.' || c == '~')
+    {
+      destination[length++] = c;
+    }
+    else
+    {
+      destination[length++] = '%';
+      destination[length++] = (uint8_t)hex[c >> 4];
+      destination[length++] = (uint8_t)hex[c & 0xF];
+    }
+  }
+  return length;
+}
+
+static void test_url_encode_matches_reference(void** state)
+{
+  (void)state;
+
+  // Mostly unreserved bytes, so that the inputs have runs of them of every length, both within and
+  // across vector boundaries.
+  uint8_t const alphabet[] = "abcXYZ019-_.~/:?#% \x7F\x80\xFF";
+  uint8_t source[100];
+  uint8_t expected[sizeof(source) * 3];
+  uint8_t actual[sizeof(source) * 3];
+
+  uint32_t random = 12345;
+  for (int32_t iteration = 0; iteration < 2000; iteration++)
+  {
+    int32_t const size = iteration % (int32_t)sizeof(source);
+    for (int32_t i = 0; i < size; i++)
+    {
+      random = random * 1103515245U + 12345U;
+      uint32_t const r = random >> 16U;
+      // Three quarters of the bytes are letters, the rest are anything in the alphabet.
+      source[i] = (r & 3U) != 0 ? (uint8_t)('a' + (r >> 2U) % 26U)
+                                : alphabet[(r >> 2U) % (sizeof(alphabet) - 1)];
+    }
+    az_span const source_span = az_span_create(source, size);
+
+    int32_t const expected_length = _reference_url_encode(expected, source, size);
+    assert_int_equal(_az_span_url_encode_calc_length(source_span), expected_length);
+
+    int32_t url_length = 0;
+    assert_true(az_result_succeeded(
+        _az_span_url_encode(az_span_create(actual, expected_length), source_span, &url_length)));
+    assert_int_equal(url_length, expected_length);
+    assert_memory_equal(actual, expected, (size_t)expected_length);
+
+    if (expected_length > size)
+    {
+      url_length = 0xFF;
+      az_span const too_small = az_span_create(actual, expected_length - 1);
+      assert_int_equal(
+          _az_span_url_encode(too_small, source_span, &url_length), AZ_ERROR_NOT_ENOUGH_SPACE);
+      assert_int_equal(url_length, 0);
+    }
+  }
+}
+
 static void test_url_encode_full(void** state)
 {
   // Go through all 256 values.
@@ -482,6 +550,7 @@ int test_az_url_encode()
     cmocka_unit_test(test_url_encode_preconditions),
     cmocka_unit_test(test_url_encode_usage),
     cmocka_unit_test(test_url_encode_full),
+    cmocka_unit_test(test_url_encode_matches_reference),
   };
 
   return cmocka_run_group_tests_name("az_core_encode", tests, NULL, NULL);